@@ -1,97 +1,578 @@
-/*----------------------------------------------------------------------------
- * Copyright  Microsoft Corp.
- *
- * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
- * use this file except in compliance with the License.  You may obtain a copy 
- * of the License at http://www.apache.org/licenses/LICENSE-2.0  
- * 
- * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
- * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
- * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
- * MERCHANTABLITY OR NON-INFRINGEMENT. 
- *
- * See the Apache Version 2.0 License for specific language governing 
- * permissions and limitations under the License.
- *---------------------------------------------------------------------------
- * 
- * LAPACK library header for AMP LAPACK.
- *
- *---------------------------------------------------------------------------*/
-
-#ifndef AMPCLAPACK_H
-#define AMPCLAPACK_H
-
-//----------------------------------------------------------------------------
-// DLL export/import specifiers
-//
-// The export/import mechanism used here is the __declspec(export) method 
-// supported by Microsoft Visual Studio, but any other export method supported
-// by your development environment may be substituted.
-//----------------------------------------------------------------------------
-
-#ifndef AMPLAPACK_DLL 
-#define AMPLAPACK_DLL __declspec(dllimport)
-#else
-#undef AMPLAPACK_DLL
-#define AMPLAPACK_DLL __declspec(dllexport)
-#endif
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-//----------------------------------------------------------------------------
-// Complex Types
-//---------------------------------------------------------------------------- 
-
-struct amplapack_fcomplex
-{
-    float real;
-    float imag;
-};
-
-struct amplapack_dcomplex
-{
-    double real;
-    double imag;
-};
-
-//----------------------------------------------------------------------------
-// Return Status Types
-//----------------------------------------------------------------------------
-
-enum amplapack_status
-{
-    amplapack_success,             // routine completed successfully
-    amplapack_data_error,          // an error with the data prevented completion; see specific routine for details
-    amplapack_argument_error,      // an argument was invalid; see info parameter for enumeration
-    amplapack_memory_error,        // insuffecient memory on the accelerator to complete the operation
-    amplapack_runtime_error,       // an error related to the C++ AMP runtime was encountered
-    amplapack_internal_error,      // an unexpected error was encountered (bad index, out of bounds, etc)
-    amplapack_unknown_error        // catch all 
-};
-
-//----------------------------------------------------------------------------
-// LAPACK Routines
-//---------------------------------------------------------------------------- 
-
-AMPLAPACK_DLL amplapack_status amplapack_sgetrf(int m, int n, float* a, int lda, int* ipiv, int* info);
-AMPLAPACK_DLL amplapack_status amplapack_dgetrf(int m, int n, double* a, int lda, int* ipiv, int* info);
-AMPLAPACK_DLL amplapack_status amplapack_cgetrf(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, int* info);
-AMPLAPACK_DLL amplapack_status amplapack_zgetrf(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, int* info);
-
-AMPLAPACK_DLL amplapack_status amplapack_sgeqrf(int m, int n, float* a, int lda, float* tau, int* info);
-AMPLAPACK_DLL amplapack_status amplapack_dgeqrf(int m, int n, double* a, int lda, double* tau, int* info);
-AMPLAPACK_DLL amplapack_status amplapack_cgeqrf(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, int* info);
-AMPLAPACK_DLL amplapack_status amplapack_zgeqrf(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, int* info);
-
-AMPLAPACK_DLL amplapack_status amplapack_spotrf(char uplo, int n, float* a, int lda, int* info);
-AMPLAPACK_DLL amplapack_status amplapack_dpotrf(char uplo, int n, double* a, int lda, int* info);
-AMPLAPACK_DLL amplapack_status amplapack_cpotrf(char uplo, int n, amplapack_fcomplex* a, int lda, int* info);
-AMPLAPACK_DLL amplapack_status amplapack_zpotrf(char uplo, int n, amplapack_dcomplex* a, int lda, int* info);
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif // AMPCLAPACK_H
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * LAPACK library header for AMP LAPACK.
+ *
+ *---------------------------------------------------------------------------*/
+
+#ifndef AMPCLAPACK_H
+#define AMPCLAPACK_H
+
+//----------------------------------------------------------------------------
+// DLL export/import specifiers
+//
+// The export/import mechanism used here is the __declspec(export) method 
+// supported by Microsoft Visual Studio, but any other export method supported
+// by your development environment may be substituted.
+//----------------------------------------------------------------------------
+
+#ifndef AMPLAPACK_DLL 
+#define AMPLAPACK_DLL __declspec(dllimport)
+#else
+#undef AMPLAPACK_DLL
+#define AMPLAPACK_DLL __declspec(dllexport)
+#endif
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------
+// Complex Types
+//---------------------------------------------------------------------------- 
+
+struct amplapack_fcomplex
+{
+    float real;
+    float imag;
+};
+
+struct amplapack_dcomplex
+{
+    double real;
+    double imag;
+};
+
+//----------------------------------------------------------------------------
+// Return Status Types
+//----------------------------------------------------------------------------
+
+enum amplapack_status
+{
+    amplapack_success,             // routine completed successfully
+    amplapack_data_error,          // an error with the data prevented completion; see specific routine for details
+    amplapack_argument_error,      // an argument was invalid; see info parameter for enumeration
+    amplapack_memory_error,        // insuffecient memory on the accelerator to complete the operation
+    amplapack_runtime_error,       // an error related to the C++ AMP runtime was encountered
+    amplapack_internal_error,      // an unexpected error was encountered (bad index, out of bounds, etc)
+    amplapack_unknown_error        // catch all 
+};
+
+//----------------------------------------------------------------------------
+// Library Handle
+//
+// A handle owns an accelerator view and a device workspace that are reused by
+// every routine called through it, avoiding per-call setup costs. A handle 
+// must not be used by more than one thread at a time.
+//----------------------------------------------------------------------------
+
+typedef struct amplapack_handle_t* amplapack_handle;
+
+AMPLAPACK_DLL amplapack_status amplapack_create_handle(amplapack_handle* handle);
+AMPLAPACK_DLL amplapack_status amplapack_destroy_handle(amplapack_handle handle);
+
+// device and staging memory held by a handle is pooled; reserve preallocates size bytes 
+// of device memory (see the workspace queries below) and trim releases all memory not 
+// used by a running routine
+AMPLAPACK_DLL amplapack_status amplapack_reserve_workspace(amplapack_handle handle, size_t size);
+AMPLAPACK_DLL amplapack_status amplapack_trim_workspace(amplapack_handle handle);
+
+// bytes moved between the host and the accelerator by the last routine called through the handle
+AMPLAPACK_DLL amplapack_status amplapack_get_transfer_bytes(amplapack_handle handle, size_t* to_host, size_t* to_accelerator);
+
+// how the host panels of getrf called through the handle choose their pivots: partial
+// pivoting over the whole panel (the default) or a tournament over row blocks factored in
+// parallel, which scales with the host cores for tall panels but picks different pivots
+enum amplapack_pivoting
+{
+    amplapack_partial_pivoting,
+    amplapack_tournament_pivoting
+};
+
+AMPLAPACK_DLL amplapack_status amplapack_set_panel_pivoting(amplapack_handle handle, amplapack_pivoting pivoting);
+
+//----------------------------------------------------------------------------
+// Execution Dispatch
+//
+// The LAPACK routines below run a problem entirely on the host LAPACK library, 
+// with the hybrid algorithm or entirely on the accelerator depending on its size:
+// problems smaller than the host crossover run on the host, problems at least as
+// large as the accelerator crossover run on the accelerator and all others use 
+// the hybrid algorithm. The size of a problem is min(m,n) (n for potrf). The
+// crossovers are kept per routine and precision ('S', 'D', 'C' or 'Z') and are 
+// shared by all threads and handles.
+//----------------------------------------------------------------------------
+
+enum amplapack_routine
+{
+    amplapack_getrf_routine,
+    amplapack_geqrf_routine,
+    amplapack_potrf_routine
+};
+
+AMPLAPACK_DLL amplapack_status amplapack_set_crossover(amplapack_routine routine, char precision, int host_crossover, int accelerator_crossover);
+AMPLAPACK_DLL amplapack_status amplapack_get_crossover(amplapack_routine routine, char precision, int* host_crossover, int* accelerator_crossover);
+
+//----------------------------------------------------------------------------
+// LAPACK Routines
+//---------------------------------------------------------------------------- 
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf(int m, int n, float* a, int lda, int* ipiv, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf(int m, int n, double* a, int lda, int* ipiv, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf(int m, int n, float* a, int lda, float* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf(int m, int n, double* a, int lda, double* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf(char uplo, int n, float* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf(char uplo, int n, double* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf(char uplo, int n, amplapack_fcomplex* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf(char uplo, int n, amplapack_dcomplex* a, int lda, int* info);
+
+//----------------------------------------------------------------------------
+// Workspace Queries
+//
+// Return the device memory in bytes a routine needs for the given problem size.
+//----------------------------------------------------------------------------
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf_workspace(int m, int n, size_t* size);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf_workspace(int m, int n, size_t* size);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf_workspace(int m, int n, size_t* size);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf_workspace(int m, int n, size_t* size);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf_workspace(int m, int n, size_t* size);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf_workspace(int m, int n, size_t* size);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf_workspace(int m, int n, size_t* size);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf_workspace(int m, int n, size_t* size);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_workspace(int n, size_t* size);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_workspace(int n, size_t* size);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_workspace(int n, size_t* size);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_workspace(int n, size_t* size);
+
+//----------------------------------------------------------------------------
+// LAPACK Routines (Handle Variants)
+//---------------------------------------------------------------------------- 
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf_h(amplapack_handle handle, int m, int n, float* a, int lda, int* ipiv, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf_h(amplapack_handle handle, int m, int n, double* a, int lda, int* ipiv, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf_h(amplapack_handle handle, int m, int n, float* a, int lda, float* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf_h(amplapack_handle handle, int m, int n, double* a, int lda, double* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_h(amplapack_handle handle, char uplo, int n, float* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_h(amplapack_handle handle, char uplo, int n, double* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_h(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_h(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, int* info);
+
+//----------------------------------------------------------------------------
+// Linear Solvers
+//
+// getrs solves op(a) * x = b with the factors and pivots of getrf; gesv factors a and 
+// solves a * x = b in one call, so the factors are moved to the host only once. Both 
+// follow the getrf crossovers of their precision. potrs and posv are the Cholesky 
+// counterparts and follow the potrf crossovers; their right hand sides are streamed 
+// through the accelerator in chunks, so b may be larger than the accelerator memory.
+//---------------------------------------------------------------------------- 
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrs(char trans, int n, int nrhs, const float* a, int lda, const int* ipiv, float* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrs(char trans, int n, int nrhs, const double* a, int lda, const int* ipiv, double* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrs(char trans, int n, int nrhs, const amplapack_fcomplex* a, int lda, const int* ipiv, amplapack_fcomplex* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrs(char trans, int n, int nrhs, const amplapack_dcomplex* a, int lda, const int* ipiv, amplapack_dcomplex* b, int ldb, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrs_h(amplapack_handle handle, char trans, int n, int nrhs, const float* a, int lda, const int* ipiv, float* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrs_h(amplapack_handle handle, char trans, int n, int nrhs, const double* a, int lda, const int* ipiv, double* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrs_h(amplapack_handle handle, char trans, int n, int nrhs, const amplapack_fcomplex* a, int lda, const int* ipiv, amplapack_fcomplex* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrs_h(amplapack_handle handle, char trans, int n, int nrhs, const amplapack_dcomplex* a, int lda, const int* ipiv, amplapack_dcomplex* b, int ldb, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgesv(int n, int nrhs, float* a, int lda, int* ipiv, float* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgesv(int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgesv(int n, int nrhs, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_fcomplex* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgesv(int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgesv_h(amplapack_handle handle, int n, int nrhs, float* a, int lda, int* ipiv, float* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgesv_h(amplapack_handle handle, int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgesv_h(amplapack_handle handle, int n, int nrhs, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_fcomplex* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgesv_h(amplapack_handle handle, int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrs(char uplo, int n, int nrhs, const float* a, int lda, float* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrs(char uplo, int n, int nrhs, const double* a, int lda, double* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrs(char uplo, int n, int nrhs, const amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrs(char uplo, int n, int nrhs, const amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrs_h(amplapack_handle handle, char uplo, int n, int nrhs, const float* a, int lda, float* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrs_h(amplapack_handle handle, char uplo, int n, int nrhs, const double* a, int lda, double* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrs_h(amplapack_handle handle, char uplo, int n, int nrhs, const amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrs_h(amplapack_handle handle, char uplo, int n, int nrhs, const amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sposv(char uplo, int n, int nrhs, float* a, int lda, float* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dposv(char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cposv(char uplo, int n, int nrhs, amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zposv(char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sposv_h(amplapack_handle handle, char uplo, int n, int nrhs, float* a, int lda, float* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dposv_h(amplapack_handle handle, char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cposv_h(amplapack_handle handle, char uplo, int n, int nrhs, amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zposv_h(amplapack_handle handle, char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info);
+
+//----------------------------------------------------------------------------
+// Orthogonal Factors
+//
+// ormqr (unmqr) applies Q from geqrf to c from the left (side 'L') or the right ('R'), 
+// transposed for trans 'T' or 'C' ('C' only for the complex types); orgqr (ungqr) 
+// overwrites the reflectors in a with the first n columns of Q. The reflectors stay on 
+// the accelerator for the whole update. Both follow the geqrf crossovers, with k as the 
+// problem size of ormqr.
+//---------------------------------------------------------------------------- 
+
+AMPLAPACK_DLL amplapack_status amplapack_sormqr(char side, char trans, int m, int n, int k, const float* a, int lda, const float* tau, float* c, int ldc, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dormqr(char side, char trans, int m, int n, int k, const double* a, int lda, const double* tau, double* c, int ldc, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cunmqr(char side, char trans, int m, int n, int k, const amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, amplapack_fcomplex* c, int ldc, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zunmqr(char side, char trans, int m, int n, int k, const amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, amplapack_dcomplex* c, int ldc, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sormqr_h(amplapack_handle handle, char side, char trans, int m, int n, int k, const float* a, int lda, const float* tau, float* c, int ldc, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dormqr_h(amplapack_handle handle, char side, char trans, int m, int n, int k, const double* a, int lda, const double* tau, double* c, int ldc, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cunmqr_h(amplapack_handle handle, char side, char trans, int m, int n, int k, const amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, amplapack_fcomplex* c, int ldc, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zunmqr_h(amplapack_handle handle, char side, char trans, int m, int n, int k, const amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, amplapack_dcomplex* c, int ldc, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sorgqr(int m, int n, int k, float* a, int lda, const float* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dorgqr(int m, int n, int k, double* a, int lda, const double* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cungqr(int m, int n, int k, amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zungqr(int m, int n, int k, amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sorgqr_h(amplapack_handle handle, int m, int n, int k, float* a, int lda, const float* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dorgqr_h(amplapack_handle handle, int m, int n, int k, double* a, int lda, const double* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cungqr_h(amplapack_handle handle, int m, int n, int k, amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zungqr_h(amplapack_handle handle, int m, int n, int k, amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, int* info);
+
+//----------------------------------------------------------------------------
+// Batched Routines
+//
+// Factor batch_count matrices of the same size, given either as an array of pointers or 
+// as a base pointer and a stride between consecutive matrices (and their outputs). info 
+// reports argument errors; the result of each factorization is written to info_array.
+//---------------------------------------------------------------------------- 
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf_batched(int m, int n, float** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf_batched(int m, int n, double** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf_batched(int m, int n, amplapack_fcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf_batched(int m, int n, amplapack_dcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf_batched_h(amplapack_handle handle, int m, int n, float** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf_batched_h(amplapack_handle handle, int m, int n, double** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf_batched_h(amplapack_handle handle, int m, int n, amplapack_fcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf_batched_h(amplapack_handle handle, int m, int n, amplapack_dcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf_strided_batched(int m, int n, float* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf_strided_batched(int m, int n, double* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf_strided_batched(int m, int n, amplapack_fcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf_strided_batched(int m, int n, amplapack_dcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf_strided_batched_h(amplapack_handle handle, int m, int n, float* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf_strided_batched_h(amplapack_handle handle, int m, int n, double* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf_strided_batched_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf_strided_batched_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_batched(char uplo, int n, float** a_array, int lda, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_batched(char uplo, int n, double** a_array, int lda, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_batched(char uplo, int n, amplapack_fcomplex** a_array, int lda, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_batched(char uplo, int n, amplapack_dcomplex** a_array, int lda, int* info_array, int batch_count, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_batched_h(amplapack_handle handle, char uplo, int n, float** a_array, int lda, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_batched_h(amplapack_handle handle, char uplo, int n, double** a_array, int lda, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_batched_h(amplapack_handle handle, char uplo, int n, amplapack_fcomplex** a_array, int lda, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_batched_h(amplapack_handle handle, char uplo, int n, amplapack_dcomplex** a_array, int lda, int* info_array, int batch_count, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_strided_batched(char uplo, int n, float* a, int lda, int stride_a, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_strided_batched(char uplo, int n, double* a, int lda, int stride_a, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_strided_batched(char uplo, int n, amplapack_fcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_strided_batched(char uplo, int n, amplapack_dcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_strided_batched_h(amplapack_handle handle, char uplo, int n, float* a, int lda, int stride_a, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_strided_batched_h(amplapack_handle handle, char uplo, int n, double* a, int lda, int stride_a, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_strided_batched_h(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_strided_batched_h(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf_batched(int m, int n, float** a_array, int lda, float** tau_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf_batched(int m, int n, double** a_array, int lda, double** tau_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf_batched(int m, int n, amplapack_fcomplex** a_array, int lda, amplapack_fcomplex** tau_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf_batched(int m, int n, amplapack_dcomplex** a_array, int lda, amplapack_dcomplex** tau_array, int* info_array, int batch_count, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf_batched_h(amplapack_handle handle, int m, int n, float** a_array, int lda, float** tau_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf_batched_h(amplapack_handle handle, int m, int n, double** a_array, int lda, double** tau_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf_batched_h(amplapack_handle handle, int m, int n, amplapack_fcomplex** a_array, int lda, amplapack_fcomplex** tau_array, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf_batched_h(amplapack_handle handle, int m, int n, amplapack_dcomplex** a_array, int lda, amplapack_dcomplex** tau_array, int* info_array, int batch_count, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf_strided_batched(int m, int n, float* a, int lda, int stride_a, float* tau, int stride_tau, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf_strided_batched(int m, int n, double* a, int lda, int stride_a, double* tau, int stride_tau, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf_strided_batched(int m, int n, amplapack_fcomplex* a, int lda, int stride_a, amplapack_fcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf_strided_batched(int m, int n, amplapack_dcomplex* a, int lda, int stride_a, amplapack_dcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf_strided_batched_h(amplapack_handle handle, int m, int n, float* a, int lda, int stride_a, float* tau, int stride_tau, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf_strided_batched_h(amplapack_handle handle, int m, int n, double* a, int lda, int stride_a, double* tau, int stride_tau, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf_strided_batched_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int stride_a, amplapack_fcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf_strided_batched_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int stride_a, amplapack_dcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info);
+
+//----------------------------------------------------------------------------
+// Mixed Precision Solvers
+//
+// Solve a * x = b for a double precision (complex) matrix with a single precision 
+// factorization refined to double precision accuracy, as LAPACK's dsgesv and dsposv do. 
+// On success iter is the number of refinement steps; a negative iter means the system was 
+// factored and solved in double precision instead (-2: an element overflows single 
+// precision, -3: the single precision factorization failed, -31: the refinement did not 
+// converge), in which case a and ipiv hold the double precision factorization. a is 
+// otherwise left unchanged.
+//---------------------------------------------------------------------------- 
+
+AMPLAPACK_DLL amplapack_status amplapack_dsgesv(int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, double* x, int ldx, int* iter, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zcgesv(int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_dsposv(char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, double* x, int ldx, int* iter, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zcposv(char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_dsgesv_h(amplapack_handle handle, int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, double* x, int ldx, int* iter, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zcgesv_h(amplapack_handle handle, int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_dsposv_h(amplapack_handle handle, char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, double* x, int ldx, int* iter, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zcposv_h(amplapack_handle handle, char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info);
+
+//----------------------------------------------------------------------------
+// Asynchronous Routines
+//
+// Queue a factorization entirely on the accelerator and return once a has been 
+// uploaded, leaving the host free until the results are needed. info only reports
+// argument errors; on success token receives a call that can be polled with 
+// amplapack_async_test and must be completed with amplapack_async_wait, which 
+// reports the data error of the routine, if any, and releases the token. a (and 
+// ipiv or tau) must not be accessed before the call completes. Problems below the 
+// host crossover are factored before the routine returns. The handle variants 
+// queue on the handle's view; the handle must outlive its pending calls. A null 
+// info is an argument error of amplapack_async_wait, which then keeps the token.
+//---------------------------------------------------------------------------- 
+
+typedef struct amplapack_async_t* amplapack_async;
+
+AMPLAPACK_DLL amplapack_status amplapack_async_test(amplapack_async token, int* done);
+AMPLAPACK_DLL amplapack_status amplapack_async_wait(amplapack_async token, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf_async(int m, int n, float* a, int lda, int* ipiv, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf_async(int m, int n, double* a, int lda, int* ipiv, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf_async(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf_async(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf_async(int m, int n, float* a, int lda, float* tau, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf_async(int m, int n, double* a, int lda, double* tau, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf_async(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf_async(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, amplapack_async* token, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_async(char uplo, int n, float* a, int lda, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_async(char uplo, int n, double* a, int lda, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_async(char uplo, int n, amplapack_fcomplex* a, int lda, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_async(char uplo, int n, amplapack_dcomplex* a, int lda, amplapack_async* token, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf_async_h(amplapack_handle handle, int m, int n, float* a, int lda, int* ipiv, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf_async_h(amplapack_handle handle, int m, int n, double* a, int lda, int* ipiv, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf_async_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf_async_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf_async_h(amplapack_handle handle, int m, int n, float* a, int lda, float* tau, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf_async_h(amplapack_handle handle, int m, int n, double* a, int lda, double* tau, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf_async_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf_async_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, amplapack_async* token, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_async_h(amplapack_handle handle, char uplo, int n, float* a, int lda, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_async_h(amplapack_handle handle, char uplo, int n, double* a, int lda, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_async_h(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, amplapack_async* token, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_async_h(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, amplapack_async* token, int* info);
+
+//----------------------------------------------------------------------------
+// Device Matrices
+//
+// A device matrix keeps an m by n column major matrix on the accelerator of a 
+// handle, so that a chain of routines (for example a factorization followed by
+// any number of solves) moves the matrix to the host only when it is asked for.
+// create uploads a (or zero fills the matrix if a is null), set replaces the
+// contents, and get downloads them. The routines below take device matrices in 
+// place of the array and leading dimension arguments and run on the handle of
+// their matrices; all matrices of a call must belong to the same handle and hold
+// the precision of the routine. Pivots and tau stay in host memory. Only the 
+// panel factorization follows the crossovers, since the matrix is already on the
+// accelerator. A matrix must be destroyed before its handle.
+//---------------------------------------------------------------------------- 
+
+typedef struct amplapack_matrix_t* amplapack_matrix;
+
+AMPLAPACK_DLL amplapack_status amplapack_screate_matrix(amplapack_handle handle, int m, int n, const float* a, int lda, amplapack_matrix* matrix, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dcreate_matrix(amplapack_handle handle, int m, int n, const double* a, int lda, amplapack_matrix* matrix, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_ccreate_matrix(amplapack_handle handle, int m, int n, const amplapack_fcomplex* a, int lda, amplapack_matrix* matrix, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zcreate_matrix(amplapack_handle handle, int m, int n, const amplapack_dcomplex* a, int lda, amplapack_matrix* matrix, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_destroy_matrix(amplapack_matrix matrix);
+AMPLAPACK_DLL amplapack_status amplapack_get_matrix_size(amplapack_matrix matrix, int* m, int* n);
+
+AMPLAPACK_DLL amplapack_status amplapack_sset_matrix(amplapack_matrix matrix, const float* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dset_matrix(amplapack_matrix matrix, const double* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cset_matrix(amplapack_matrix matrix, const amplapack_fcomplex* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zset_matrix(amplapack_matrix matrix, const amplapack_dcomplex* a, int lda, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sget_matrix(amplapack_matrix matrix, float* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dget_matrix(amplapack_matrix matrix, double* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cget_matrix(amplapack_matrix matrix, amplapack_fcomplex* a, int lda, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zget_matrix(amplapack_matrix matrix, amplapack_dcomplex* a, int lda, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf_m(amplapack_matrix a, int* ipiv, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf_m(amplapack_matrix a, int* ipiv, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf_m(amplapack_matrix a, int* ipiv, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf_m(amplapack_matrix a, int* ipiv, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrs_m(char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrs_m(char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrs_m(char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrs_m(char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_m(char uplo, amplapack_matrix a, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_m(char uplo, amplapack_matrix a, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_m(char uplo, amplapack_matrix a, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_m(char uplo, amplapack_matrix a, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrs_m(char uplo, amplapack_matrix a, amplapack_matrix b, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrs_m(char uplo, amplapack_matrix a, amplapack_matrix b, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrs_m(char uplo, amplapack_matrix a, amplapack_matrix b, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrs_m(char uplo, amplapack_matrix a, amplapack_matrix b, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf_m(amplapack_matrix a, float* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf_m(amplapack_matrix a, double* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf_m(amplapack_matrix a, amplapack_fcomplex* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf_m(amplapack_matrix a, amplapack_dcomplex* tau, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sormqr_m(char side, char trans, int k, amplapack_matrix a, const float* tau, amplapack_matrix c, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dormqr_m(char side, char trans, int k, amplapack_matrix a, const double* tau, amplapack_matrix c, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cunmqr_m(char side, char trans, int k, amplapack_matrix a, const amplapack_fcomplex* tau, amplapack_matrix c, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zunmqr_m(char side, char trans, int k, amplapack_matrix a, const amplapack_dcomplex* tau, amplapack_matrix c, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sorgqr_m(int k, amplapack_matrix a, const float* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dorgqr_m(int k, amplapack_matrix a, const double* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cungqr_m(int k, amplapack_matrix a, const amplapack_fcomplex* tau, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zungqr_m(int k, amplapack_matrix a, const amplapack_dcomplex* tau, int* info);
+
+//----------------------------------------------------------------------------
+// Out of Core Routines
+//
+// Factor a matrix that is larger than the accelerator's memory. a stays in host
+// memory and is moved through the accelerator one slab of block columns (block 
+// rows for an upper potrf) at a time, together with one factored block panel at
+// a time for the update of the slab. workspace bounds the device memory in bytes 
+// used for the slab and the streamed panels; the factorization of a slab draws a 
+// few more block sized arrays from the pool. The wider the slab the fewer times 
+// the factored panels are moved, so workspace should be as large as the 
+// accelerator allows. A workspace too small for a slab of a single block is an 
+// argument error. These routines do not follow the crossovers.
+//---------------------------------------------------------------------------- 
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf_ooc(int m, int n, float* a, int lda, int* ipiv, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf_ooc(int m, int n, double* a, int lda, int* ipiv, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf_ooc(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf_ooc(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, size_t workspace, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf_ooc(int m, int n, float* a, int lda, float* tau, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf_ooc(int m, int n, double* a, int lda, double* tau, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf_ooc(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf_ooc(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, size_t workspace, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_ooc(char uplo, int n, float* a, int lda, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_ooc(char uplo, int n, double* a, int lda, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_ooc(char uplo, int n, amplapack_fcomplex* a, int lda, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_ooc(char uplo, int n, amplapack_dcomplex* a, int lda, size_t workspace, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgetrf_ooc_h(amplapack_handle handle, int m, int n, float* a, int lda, int* ipiv, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgetrf_ooc_h(amplapack_handle handle, int m, int n, double* a, int lda, int* ipiv, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgetrf_ooc_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgetrf_ooc_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, size_t workspace, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_sgeqrf_ooc_h(amplapack_handle handle, int m, int n, float* a, int lda, float* tau, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dgeqrf_ooc_h(amplapack_handle handle, int m, int n, double* a, int lda, double* tau, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cgeqrf_ooc_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zgeqrf_ooc_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, size_t workspace, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_ooc_h(amplapack_handle handle, char uplo, int n, float* a, int lda, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_ooc_h(amplapack_handle handle, char uplo, int n, double* a, int lda, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_ooc_h(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_ooc_h(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, size_t workspace, int* info);
+
+//----------------------------------------------------------------------------
+// Streamed Cholesky Factorization
+//
+// Factor a matrix that is never held in host memory as a whole with the out of
+// core potrf. The stream routines call read for every block they need and write
+// for every block of the factor; blocks are m by n, column major with leading 
+// dimension ld, at zero based row i and column j. Blocks lie within the triangle
+// given by uplo except that the diagonal block of each slab is read whole, its
+// opposite triangle written back unchanged. The file routines map the column 
+// major matrix at byte offset of file_name (leading dimension lda) a few columns
+// at a time and write the factor back in place. Host memory holds at most one 
+// slab (about workspace bytes). If progress is not null it is called after each
+// slab with the columns (rows for upper) of the factor written so far out of n.
+// A nonzero return from read or write stops the factorization with 
+// amplapack_runtime_error.
+//---------------------------------------------------------------------------- 
+
+typedef int (*amplapack_read_block)(void* user_data, int i, int j, int m, int n, void* buffer, int ld);
+typedef int (*amplapack_write_block)(void* user_data, int i, int j, int m, int n, const void* buffer, int ld);
+typedef void (*amplapack_progress)(void* user_data, int done, int total);
+
+struct amplapack_tile_stream
+{
+    amplapack_read_block read;
+    amplapack_write_block write;
+    amplapack_progress progress;
+    void* user_data;
+};
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_stream(char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_stream(char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_stream(char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_stream(char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_stream_h(amplapack_handle handle, char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_stream_h(amplapack_handle handle, char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_stream_h(amplapack_handle handle, char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_stream_h(amplapack_handle handle, char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_file(char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_file(char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_file(char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_file(char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info);
+
+AMPLAPACK_DLL amplapack_status amplapack_spotrf_file_h(amplapack_handle handle, char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_dpotrf_file_h(amplapack_handle handle, char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_cpotrf_file_h(amplapack_handle handle, char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info);
+AMPLAPACK_DLL amplapack_status amplapack_zpotrf_file_h(amplapack_handle handle, char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AMPCLAPACK_H
@@ -1,30 +1,40 @@
-/*----------------------------------------------------------------------------
- * Copyright  Microsoft Corp.
- *
- * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
- * use this file except in compliance with the License.  You may obtain a copy 
- * of the License at http://www.apache.org/licenses/LICENSE-2.0  
- * 
- * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
- * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
- * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
- * MERCHANTABLITY OR NON-INFRINGEMENT. 
- *
- * See the Apache Version 2.0 License for specific language governing 
- * permissions and limitations under the License.
- *---------------------------------------------------------------------------
- * 
- * amplapack.h
- * 
- * This headers includes all of the functions contained within AMPLAPACK.
- *
- *---------------------------------------------------------------------------*/
-
-#ifndef AMPLAPACK_H
-#define AMPLAPACK_H
-
-#include "detail/geqrf.h"
-#include "detail/getrf.h"
-#include "detail/potrf.h"
-
-#endif // AMPLAPACK_H
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * amplapack.h
+ * 
+ * This headers includes all of the functions contained within AMPLAPACK.
+ *
+ *---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_H
+#define AMPLAPACK_H
+
+#include "detail/batched.h"
+#include "detail/geqrf.h"
+#include "detail/getrf.h"
+#include "detail/multi_device.h"
+#include "detail/out_of_core.h"
+#include "detail/potrf.h"
+#include "detail/refine.h"
+#include "detail/task_graph.h"
+#include "detail/tile_layout.h"
+#include "detail/tiled_geqrf.h"
+#include "detail/tiled_getrf.h"
+#include "detail/tiled_potrf.h"
+#include "detail/tsqr.h"
+
+#endif // AMPLAPACK_H
@@ -1,37 +1,37 @@
-/*----------------------------------------------------------------------------
- * Copyright  Microsoft Corp.
- *
- * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
- * use this file except in compliance with the License.  You may obtain a copy 
- * of the License at http://www.apache.org/licenses/LICENSE-2.0  
- * 
- * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
- * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
- * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
- * MERCHANTABLITY OR NON-INFRINGEMENT. 
- *
- * See the Apache Version 2.0 License for specific language governing 
- * permissions and limitations under the License.
- *---------------------------------------------------------------------------
- * 
- * amplapack_config.h
- *
- *---------------------------------------------------------------------------*/
-
-#ifndef AMPLAPACK_CONFIG_H
-#define AMPLAPACK_CONFIG_H
-
-#include <amp.h>
-#include "ampblas_static.h"
-#include "amplapack_runtime.h"
-#include "lapack_host.h"
-
-#ifdef max
-#undef max
-#endif
-
-#ifdef min
-#undef min
-#endif
-
-#endif // AMPLAPACK_CONFIG_H
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * amplapack_config.h
+ *
+ *---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_CONFIG_H
+#define AMPLAPACK_CONFIG_H
+
+#include <amp.h>
+#include "ampblas_static.h"
+#include "amplapack_runtime.h"
+#include "lapack_host.h"
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+#endif // AMPLAPACK_CONFIG_H
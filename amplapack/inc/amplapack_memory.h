@@ -0,0 +1,589 @@
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * amplapack_memory.h
+ *
+ *---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_MEMORY_H
+#define AMPLAPACK_MEMORY_H
+
+#include <algorithm>
+#include <climits>
+#include <map>
+#include <memory>
+#include <vector>
+#include <amp.h>
+
+namespace amplapack {
+
+//
+// Device Memory Pool
+//
+// Device memory is handed out from large slabs in size classes. A released block is
+// kept on the free list of its class and given to the next request of that class; once
+// every block of a slab is released the slab is reset so that it can be carved up again
+// for requests of any size. Repeated calls through the same pool therefore stop 
+// allocating on the accelerator after the first call. Slabs without live blocks are 
+// returned to the runtime by trim(). Word counts and offsets are size_t; a slab is a 1d
+// array and holds at most max_slab_words, so larger requests are not pooled (see 
+// pooled_array).
+//
+
+class device_pool
+{
+private:
+
+    struct slab
+    {
+        slab(size_t words, const concurrency::accelerator_view& av)
+            : data(static_cast<int>(words), av), top(0), live(0)
+        {}
+
+        concurrency::array<unsigned int,1> data;
+        size_t top;     // first word that has not been handed out
+        int live;       // number of blocks currently checked out
+    };
+
+public:
+
+    // the extent of a slab is an int
+    static const size_t max_slab_words = INT_MAX;
+
+    // a range of 32-bit words within a slab
+    struct block
+    {
+        std::shared_ptr<slab> source;
+        size_t offset;
+        size_t words;
+    };
+
+    explicit device_pool(const concurrency::accelerator_view& av)
+        : av(av)
+    {}
+
+    // number of 32-bit words needed to store count elements
+    template <typename value_type>
+    static size_t get_words(size_t count)
+    {
+        static_assert(sizeof(value_type) % sizeof(unsigned int) == 0, "pooled element size must be a multiple of 32 bits");
+        return count * (sizeof(value_type) / sizeof(unsigned int));
+    }
+
+    // rounds a request up to its size class
+    static size_t get_class_size(size_t words)
+    {
+        // smallest class is 1KB
+        const size_t min_class = 256;
+        if (words <= min_class)
+            return min_class;
+
+        // four classes per power of two bound the waste to 25%
+        size_t power = 1;
+        while (power <= words/2)
+            power *= 2;
+
+        const size_t step = power/4;
+        return ((words + step - 1) / step) * step;
+    }
+
+    // whether a request of words fits a slab
+    static bool is_poolable(size_t words)
+    {
+        return get_class_size(words) <= max_slab_words;
+    }
+
+    // words must be poolable
+    block allocate(size_t words)
+    {
+        const size_t class_words = get_class_size(words);
+
+        // reuse a released block of the same class
+        std::vector<block>& free_list = free_blocks[class_words];
+        if (!free_list.empty())
+        {
+            block b = free_list.back();
+            free_list.pop_back();
+            b.source->live++;
+            return b;
+        }
+
+        // carve from the first slab with enough room left
+        for (auto it = slabs.begin(); it != slabs.end(); ++it)
+        {
+            if (size_t((*it)->data.extent[0]) - (*it)->top >= class_words)
+                return carve(*it, class_words);
+        }
+
+        // small classes share a slab, large classes get their own
+        const size_t min_slab = 1 << 20;
+        return carve(add_slab(class_words > min_slab ? class_words : min_slab, false), class_words);
+    }
+
+    void release(const block& b)
+    {
+        b.source->live--;
+
+        if (b.source->live == 0)
+        {
+            // the whole slab is free again; drop its blocks from the free lists and start over
+            reset(b.source);
+        }
+        else
+        {
+            free_blocks[b.words].push_back(b);
+        }
+    }
+
+    // preallocates a slab that is used before any other slab (of at most max_slab_words)
+    void reserve(size_t bytes)
+    {
+        const size_t words = std::min((bytes + sizeof(unsigned int) - 1) / sizeof(unsigned int), size_t(max_slab_words));
+
+        if (words > 0)
+            add_slab(words, true);
+    }
+
+    // returns all slabs without live blocks to the runtime
+    void trim()
+    {
+        std::vector<std::shared_ptr<slab>> in_use;
+
+        for (auto it = slabs.begin(); it != slabs.end(); ++it)
+        {
+            if ((*it)->live > 0)
+                in_use.push_back(*it);
+            else
+                reset(*it);
+        }
+
+        slabs.swap(in_use);
+    }
+
+    // total device memory held by the pool in bytes
+    size_t get_reserved_bytes() const
+    {
+        size_t words = 0;
+        for (auto it = slabs.begin(); it != slabs.end(); ++it)
+            words += (*it)->data.extent[0];
+
+        return words * sizeof(unsigned int);
+    }
+
+    // the words of a block
+    concurrency::array_view<unsigned int,1> get_view(const block& b, size_t words) const
+    {
+        return b.source->data.section(static_cast<int>(b.offset), static_cast<int>(words));
+    }
+
+    const concurrency::accelerator_view& get_accelerator_view() const
+    {
+        return av;
+    }
+
+private:
+
+    // non-copyable
+    device_pool(const device_pool&);
+    device_pool& operator=(const device_pool&);
+
+    block carve(const std::shared_ptr<slab>& source, size_t class_words)
+    {
+        block b;
+        b.source = source;
+        b.offset = source->top;
+        b.words = class_words;
+
+        source->top += class_words;
+        source->live++;
+
+        return b;
+    }
+
+    std::shared_ptr<slab> add_slab(size_t words, bool front)
+    {
+        std::shared_ptr<slab> new_slab;
+
+        try
+        {
+            new_slab = std::make_shared<slab>(words, av);
+        }
+        catch (const concurrency::out_of_memory&)
+        {
+            // unused slabs may be what is standing in the way; release them and try once more
+            trim();
+            new_slab = std::make_shared<slab>(words, av);
+        }
+
+        slabs.insert(front ? slabs.begin() : slabs.end(), new_slab);
+        return new_slab;
+    }
+
+    void reset(const std::shared_ptr<slab>& source)
+    {
+        for (auto it = free_blocks.begin(); it != free_blocks.end(); ++it)
+        {
+            std::vector<block>& free_list = it->second;
+            auto last = std::remove_if(free_list.begin(), free_list.end(), [&](const block& b) { return b.source == source; });
+            free_list.erase(last, free_list.end());
+        }
+
+        source->top = 0;
+    }
+
+    concurrency::accelerator_view av;
+    std::vector<std::shared_ptr<slab>> slabs;
+    std::map<size_t,std::vector<block>> free_blocks;
+};
+
+//
+// Pooled Array
+//
+// A 2d accelerator array drawn from a device pool and returned to it on destruction. An
+// array too large for a slab is allocated on its own as a typed array instead.
+// 
+
+template <typename value_type>
+class pooled_array
+{
+public:
+    pooled_array(device_pool& pool, const concurrency::extent<2>& extent)
+        : pool(pool), 
+          pooled(device_pool::is_poolable(device_pool::get_words<value_type>(extent.size()))),
+          memory(pooled ? pool.allocate(device_pool::get_words<value_type>(extent.size())) : device_pool::block()),
+          dedicated(pooled ? nullptr : new concurrency::array<value_type,2>(extent, pool.get_accelerator_view())),
+          view(pooled ? make_view(pool, memory, extent) : concurrency::array_view<value_type,2>(*dedicated))
+    {}
+
+    ~pooled_array()
+    {
+        if (pooled)
+            pool.release(memory);
+    }
+
+    const concurrency::array_view<value_type,2>& get_view() const
+    {
+        return view;
+    }
+
+private:
+
+    // non-copyable
+    pooled_array(const pooled_array&);
+    pooled_array& operator=(const pooled_array&);
+
+    static concurrency::array_view<value_type,2> make_view(const device_pool& pool, const device_pool::block& memory, const concurrency::extent<2>& extent)
+    {
+        const size_t words = device_pool::get_words<value_type>(extent.size());
+        return pool.get_view(memory, words).reinterpret_as<value_type>().view_as(extent);
+    }
+
+    device_pool& pool;
+    bool pooled;
+    device_pool::block memory;
+    std::unique_ptr<concurrency::array<value_type,2>> dedicated;
+    concurrency::array_view<value_type,2> view;
+};
+
+//
+// Transfer Counter
+//
+// Bytes moved between the host and the accelerator by the host panel path. A counter is 
+// kept with the staging pool of each context and reset at the start of every call made
+// through a handle, so it reports the traffic of the last call.
+//
+
+class transfer_counter
+{
+public:
+    transfer_counter()
+        : to_host(0), to_accelerator(0)
+    {}
+
+    void add_to_host(size_t bytes)
+    {
+        to_host += bytes;
+    }
+
+    void add_to_accelerator(size_t bytes)
+    {
+        to_accelerator += bytes;
+    }
+
+    size_t get_bytes_to_host() const
+    {
+        return to_host;
+    }
+
+    size_t get_bytes_to_accelerator() const
+    {
+        return to_accelerator;
+    }
+
+    void reset()
+    {
+        to_host = 0;
+        to_accelerator = 0;
+    }
+
+private:
+    size_t to_host;
+    size_t to_accelerator;
+};
+
+template <typename value_type, int rank>
+size_t get_bytes(const concurrency::extent<rank>& extent)
+{
+    return extent.size() * sizeof(value_type);
+}
+
+//
+// Staging Buffer Pool
+//
+// Host memory used to move panels between the accelerator and the host LAPACK library.
+// The buffers are C++ AMP staging arrays, i.e. page-locked host memory associated with
+// the accelerator, so copies to and from them skip the runtime's intermediate buffer.
+// Released buffers are kept and grow to the largest panel requested, which makes the
+// per-panel round trip allocation free after the first panel.
+//
+
+class staging_pool
+{
+public:
+    typedef concurrency::array<unsigned int,1> buffer_type;
+
+    explicit staging_pool(const concurrency::accelerator_view& av)
+        : av(av), host_av(concurrency::accelerator(concurrency::accelerator::cpu_accelerator).default_view)
+    {}
+
+    std::shared_ptr<buffer_type> acquire(size_t words)
+    {
+        // the smallest free buffer that is large enough
+        auto best = free_buffers.end();
+        for (auto it = free_buffers.begin(); it != free_buffers.end(); ++it)
+        {
+            if (size_t((*it)->extent[0]) >= words && (best == free_buffers.end() || (*it)->extent[0] < (*best)->extent[0]))
+                best = it;
+        }
+
+        if (best != free_buffers.end())
+        {
+            std::shared_ptr<buffer_type> buffer = *best;
+            free_buffers.erase(best);
+            return buffer;
+        }
+
+        // every free buffer is too small; replace the largest rather than adding to them
+        if (!free_buffers.empty())
+        {
+            auto largest = free_buffers.begin();
+            for (auto it = free_buffers.begin(); it != free_buffers.end(); ++it)
+            {
+                if ((*it)->extent[0] > (*largest)->extent[0])
+                    largest = it;
+            }
+
+            free_buffers.erase(largest);
+        }
+
+        return std::make_shared<buffer_type>(static_cast<int>(words), host_av, av);
+    }
+
+    void release(const std::shared_ptr<buffer_type>& buffer)
+    {
+        free_buffers.push_back(buffer);
+    }
+
+    // frees all buffers not currently in use
+    void trim()
+    {
+        free_buffers.clear();
+    }
+
+    transfer_counter& get_transfers()
+    {
+        return transfers;
+    }
+
+private:
+
+    // non-copyable
+    staging_pool(const staging_pool&);
+    staging_pool& operator=(const staging_pool&);
+
+    concurrency::accelerator_view av;
+    concurrency::accelerator_view host_av;
+    transfer_counter transfers;
+    std::vector<std::shared_ptr<buffer_type>> free_buffers;
+};
+
+//
+// Staging Array
+//
+// A 2d host array drawn from a staging pool and returned to it on destruction. The view 
+// is used for copies to and from the accelerator and data() is the same memory in 
+// column major order with a leading dimension of extent[1], ready for a LAPACK call.
+// 
+
+template <typename value_type>
+class staging_array
+{
+public:
+    staging_array(staging_pool& pool, const concurrency::extent<2>& extent)
+        : pool(pool),
+          buffer(pool.acquire(device_pool::get_words<value_type>(extent.size()))),
+          view(make_view(*buffer, extent))
+    {}
+
+    ~staging_array()
+    {
+        pool.release(buffer);
+    }
+
+    const concurrency::array_view<value_type,2>& get_view() const
+    {
+        return view;
+    }
+
+    value_type* data() const
+    {
+        return reinterpret_cast<value_type*>(buffer->data());
+    }
+
+private:
+
+    // non-copyable
+    staging_array(const staging_array&);
+    staging_array& operator=(const staging_array&);
+
+    static concurrency::array_view<value_type,2> make_view(staging_pool::buffer_type& buffer, const concurrency::extent<2>& extent)
+    {
+        const int words = static_cast<int>(device_pool::get_words<value_type>(extent.size()));
+        return buffer.section(0, words).reinterpret_as<value_type>().view_as(extent);
+    }
+
+    staging_pool& pool;
+    std::shared_ptr<staging_pool::buffer_type> buffer;
+    concurrency::array_view<value_type,2> view;
+};
+
+//
+// Host Panel
+//
+// A block of a matrix on its way to the host. The download into a staging array is 
+// started on construction and runs asynchronously, so a panel can be requested ahead
+// of accelerator work that is queued after it (such as a trailing update) and factored
+// on the host while that work runs. get() waits for the data to arrive and upload() 
+// copies the host result back to the accelerator. Only the rectangle of the view is moved 
+// (one contiguous run per column) and the staging copy is packed, so its leading dimension
+// is the panel height rather than that of the matrix.
+//
+
+template <typename value_type>
+class host_panel
+{
+public:
+    host_panel(staging_pool& pool, const concurrency::array_view<value_type,2>& a)
+        : a(a),
+          host_a(pool, a.extent),
+          pool(pool),
+          transfers(pool.get_transfers()),
+          download(concurrency::copy_async(a, host_a.get_view()))
+    {
+        transfers.add_to_host(get_bytes<value_type>(a.extent));
+    }
+
+    ~host_panel()
+    {
+        // the staging buffer must not return to the pool while a copy into it is pending
+        download.wait();
+    }
+
+    // the accelerator side of the panel
+    const concurrency::array_view<value_type,2>& get_view() const
+    {
+        return a;
+    }
+
+    // waits for the download; the data is column major with a leading dimension of extent[1]
+    value_type* get()
+    {
+        download.get();
+        return host_a.data();
+    }
+
+    void upload()
+    {
+        concurrency::copy(host_a.get_view(), a);
+        transfers.add_to_accelerator(get_bytes<value_type>(a.extent));
+    }
+
+    // the pool the staging copy was drawn from (for host scratch of the same size)
+    staging_pool& get_pool() const
+    {
+        return pool;
+    }
+
+private:
+
+    // non-copyable
+    host_panel(const host_panel&);
+    host_panel& operator=(const host_panel&);
+
+    concurrency::array_view<value_type,2> a;
+    staging_array<value_type> host_a;
+    staging_pool& pool;
+    transfer_counter& transfers;
+    concurrency::completion_future download;
+};
+
+//
+// Workspace Query
+//
+// Accumulates the pooled device memory a routine will request, in the spirit of an
+// LAPACK lwork query. Reserving the resulting size on a pool up front means the 
+// routine will not allocate on the accelerator, except for arrays too large for a slab,
+// which are never pooled and are not counted.
+//
+
+class workspace_query
+{
+public:
+    workspace_query()
+        : words(0)
+    {}
+
+    template <typename value_type>
+    void add(const concurrency::extent<2>& extent)
+    {
+        const size_t request = device_pool::get_words<value_type>(extent.size());
+
+        if (device_pool::is_poolable(request))
+            words += device_pool::get_class_size(request);
+    }
+
+    size_t get_bytes() const
+    {
+        return words * sizeof(unsigned int);
+    }
+
+private:
+    size_t words;
+};
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_MEMORY_H
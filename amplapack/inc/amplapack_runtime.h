@@ -1,251 +1,586 @@
-/*----------------------------------------------------------------------------
- * Copyright  Microsoft Corp.
- *
- * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
- * use this file except in compliance with the License.  You may obtain a copy 
- * of the License at http://www.apache.org/licenses/LICENSE-2.0  
- * 
- * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
- * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
- * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
- * MERCHANTABLITY OR NON-INFRINGEMENT. 
- *
- * See the Apache Version 2.0 License for specific language governing 
- * permissions and limitations under the License.
- *---------------------------------------------------------------------------
- * 
- * amplapack_config.h
- *
- *---------------------------------------------------------------------------*/
-
-#ifndef AMPLAPACK_RUNTIME_H
-#define AMPLAPACK_RUNTIME_H
-
-#include <functional>
-#include <amp.h>
-
-#include "ampclapack.h"
-#include "ampblas_complex.h"
-
-namespace amplapack {
-
-// options
-enum class ordering {row_major, column_major};
-enum class transpose {no_trans, trans, conj_trans};
-enum class uplo {upper, lower};
-enum class diag {non_unit, unit};
-enum class side {left, right};
-enum class direction {forward, backward};
-enum class storage {column, row};
-
-// exeptions
-class argument_error_exception
-{
-public:
-    argument_error_exception(unsigned int index)
-        : index(index) 
-    {}
-
-    // return index of invalid parameter
-    unsigned int get() const
-    {
-        return index;
-    }
-
-private:
-    unsigned int index;
-};
-
-inline void argument_error(unsigned int index) { throw argument_error_exception(index); }
-
-class data_error_exception
-{
-public:
-    data_error_exception(unsigned int index)
-        : index(index) 
-    {}
-
-    // return location of data error
-    unsigned int get() const
-    {
-        return index;
-    }
-
-private:
-    unsigned int index;
-};
-
-inline void data_error(unsigned int index) { throw data_error_exception(index); }
-
-class runtime_error_exception {};
-
-inline void runtime_error() { throw runtime_error_exception(); }
-
-// casts to internal complex types
-inline ampblas::complex<float>* amplapack_cast(amplapack_fcomplex* ptr) 
-{ 
-    return reinterpret_cast<ampblas::complex<float>*>(ptr); 
-}
-
-inline ampblas::complex<double>* amplapack_cast(amplapack_dcomplex* ptr)
-{ 
-    return reinterpret_cast<ampblas::complex<double>*>(ptr); 
-}
-
-// exception safe execution wrapper
-amplapack_status safe_call_interface(std::function<void(concurrency::accelerator_view& av)>& functor, int& info);
-
-// creates a row or column vector from a 2d array with either the 1st or 2nd dimension being 1 
-template <typename value_type>
-class subvector_view
-{
-public:
-
-    // match some of the interface of array_view
-    typedef typename value_type value_type;
-    concurrency::extent<1> extent;
-
-    subvector_view(const concurrency::array_view<value_type,2>& base_view) restrict(cpu,amp)
-    : base_view(base_view)
-	{
-        //
-        if (base_view.extent[1] == 1)
-        {
-            direction = 0;
-        }
-        else if (base_view.extent[0] == 1)
-        {
-            direction = 1;            
-        }
-
-        extent = concurrency::extent<1>(base_view.extent[direction]);
-	}
-
-	~subvector_view() restrict(cpu,amp) {}
-
-	value_type& operator[] (const concurrency::index<1>& idx) const restrict(cpu,amp)
-	{
-        concurrency::index<2> idx_2d = (direction == 0 ? concurrency::index<2>(idx[0],0) : concurrency::index<2>(0,idx[0]));
-		return base_view[idx_2d];
-	}
-
-private:
-
-    // the dimension of the data:
-    //   0 is a row vector
-    //   1 is a column vector
-    unsigned int direction;
-    concurrency::array_view<value_type,2> base_view;
-};
-
-template <typename value_type>
-subvector_view<value_type> make_subvector_view(const concurrency::array_view<value_type,2>& base_view) restrict(cpu, amp)
-{
-    return subvector_view<value_type>(base_view);
-}
-
-// option used to specify where factorization takes place
-enum class block_factor_location { host, accelerator };
-
-// LAPACK character option casting
-inline char to_char(enum class uplo uplo)
-{
-    switch (uplo)
-    {
-    case uplo::upper:
-        return 'u';
-    case uplo::lower:
-    default:
-        return 'l';
-    }
-}
-
-inline enum class uplo to_option(const char& uplo)
-{
-    switch (uplo)
-    {
-    case 'L':
-    case 'l':
-        return uplo::lower;
-    case 'U':
-    case 'u':
-    default:
-        return uplo::upper;
-    }
-}
-
-// runtime checks
-template <typename value_type, template <typename,int> class container_type>
-int require_square(const container_type<value_type,2>& a)
-{
-    if (a.extent[0] != a.extent[1])
-        runtime_error();
-
-    return a.extent[0];
-}
-
-template <enum class ordering storage_type, typename value_type, template <typename,int> class container_type>
-int get_rows(const container_type<value_type,2>& a)
-{
-    if (storage_type == ordering::column_major)
-        return a.extent[1];
-    else
-        return a.extent[0];
-}
-
-template <enum class ordering storage_type, typename value_type, template <typename,int> class container_type>
-int get_cols(const container_type<value_type,2>& a)
-{
-    if (storage_type == ordering::column_major)
-        return a.extent[0];
-    else
-        return a.extent[1];
-}
-
-template <enum class ordering storage_type, typename value_type, template <typename,int> class container_type>
-int get_leading_dimension(const container_type<value_type,2>& a)
-{
-    if (storage_type == ordering::column_major)
-        return a.extent[1];
-    else
-        return a.extent[0];
-}
-
-// checks returns from a host LAPACK call
-inline void info_check(int info)
-{
-    if (info > 0)
-        data_error(info);
-    else if (info < 0)
-        argument_error(-info);
-}
-
-// a simple host array wrapper
-template <unsigned int rank, typename value_type>
-class host_array_view
-{
-public:
-    host_array_view(const concurrency::extent<rank>& extent, value_type* ptr)
-        : extent(extent), base_ptr(ptr)
-    {}
-
-private:
-    const concurrency::extent<rank> extent;
-    value_type const* base_ptr;
-};
-
-// data layout aware sub-matrix extraction method
-template <enum class ordering storage_type, typename value_type, template <typename,int> class container_type>
-concurrency::array_view<value_type,2> get_sub_matrix(const container_type<value_type,2>& matrix, const concurrency::index<2>& location, const concurrency::extent<2>& size)
-{
-    if (storage_type == ordering::row_major)
-        return matrix.section(location, size);
-    else
-        return matrix.section(concurrency::index<2>(location[1], location[0]), concurrency::extent<2>(size[1], size[0]));
-}
-
-} // namesapce amplapack
-
-#endif AMPLAPACK_RUNTIME_H
-
-
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * amplapack_config.h
+ *
+ *---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_RUNTIME_H
+#define AMPLAPACK_RUNTIME_H
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <amp.h>
+#include <amp_math.h>
+
+#include "ampclapack.h"
+#include "ampblas_complex.h"
+#include "amplapack_memory.h"
+
+namespace amplapack {
+
+// options
+enum class ordering {row_major, column_major};
+enum class transpose {no_trans, trans, conj_trans};
+enum class uplo {upper, lower};
+enum class diag {non_unit, unit};
+enum class side {left, right};
+enum class direction {forward, backward};
+enum class storage {column, row};
+
+// exeptions
+class argument_error_exception
+{
+public:
+    argument_error_exception(unsigned int index)
+        : index(index) 
+    {}
+
+    // return index of invalid parameter
+    unsigned int get() const
+    {
+        return index;
+    }
+
+private:
+    unsigned int index;
+};
+
+inline void argument_error(unsigned int index) { throw argument_error_exception(index); }
+
+class data_error_exception
+{
+public:
+    data_error_exception(unsigned int index)
+        : index(index) 
+    {}
+
+    // return location of data error
+    unsigned int get() const
+    {
+        return index;
+    }
+
+private:
+    unsigned int index;
+};
+
+inline void data_error(unsigned int index) { throw data_error_exception(index); }
+
+class runtime_error_exception {};
+
+inline void runtime_error() { throw runtime_error_exception(); }
+
+// casts to internal complex types
+inline ampblas::complex<float>* amplapack_cast(amplapack_fcomplex* ptr) 
+{ 
+    return reinterpret_cast<ampblas::complex<float>*>(ptr); 
+}
+
+inline ampblas::complex<double>* amplapack_cast(amplapack_dcomplex* ptr)
+{ 
+    return reinterpret_cast<ampblas::complex<double>*>(ptr); 
+}
+
+inline const ampblas::complex<float>* amplapack_cast(const amplapack_fcomplex* ptr) 
+{ 
+    return reinterpret_cast<const ampblas::complex<float>*>(ptr); 
+}
+
+inline const ampblas::complex<double>* amplapack_cast(const amplapack_dcomplex* ptr)
+{ 
+    return reinterpret_cast<const ampblas::complex<double>*>(ptr); 
+}
+
+// casts of pointer arrays (batched routines)
+inline ampblas::complex<float>** amplapack_cast(amplapack_fcomplex** ptr) 
+{ 
+    return reinterpret_cast<ampblas::complex<float>**>(ptr); 
+}
+
+inline ampblas::complex<double>** amplapack_cast(amplapack_dcomplex** ptr)
+{ 
+    return reinterpret_cast<ampblas::complex<double>**>(ptr); 
+}
+
+// option used to specify how the host panels of getrf choose their pivots: partial pivoting
+// over the whole panel, as LAPACK does, or a tournament over row blocks factored in parallel
+// (communication avoiding LU) for tall panels
+enum class panel_pivoting { partial, tournament };
+
+// execution context shared by consecutive calls
+//
+// A context owns the accelerator_view the routines run on, a pool of device memory that
+// all device workspaces are drawn from and a pool of staging buffers used for the host
+// panel factorizations. Routines called repeatedly through the same context reuse all of
+// them instead of creating a view and allocating memory for every call. A context is not
+// thread safe; use one per thread.
+class context
+{
+public:
+    explicit context(const concurrency::accelerator_view& av)
+        : av(av), pool(av), staging(av), pivoting(panel_pivoting::partial)
+    {}
+
+    concurrency::accelerator_view& get_view()
+    {
+        return av;
+    }
+
+    device_pool& get_pool()
+    {
+        return pool;
+    }
+
+    staging_pool& get_staging_pool()
+    {
+        return staging;
+    }
+
+    // host/accelerator traffic of the host panel path and the host interfaces
+    transfer_counter& get_transfers()
+    {
+        return staging.get_transfers();
+    }
+
+    panel_pivoting get_panel_pivoting() const
+    {
+        return pivoting;
+    }
+
+    void set_panel_pivoting(panel_pivoting value)
+    {
+        pivoting = value;
+    }
+
+private:
+    // non-copyable
+    context(const context&);
+    context& operator=(const context&);
+
+    concurrency::accelerator_view av;
+    device_pool pool;
+    staging_pool staging;
+    panel_pivoting pivoting;
+};
+
+// a context per accelerator view for the routines that spread one factorization over 
+// several views (see multi_device.h)
+class context_group
+{
+public:
+    explicit context_group(const std::vector<concurrency::accelerator_view>& views)
+    {
+        std::for_each(views.begin(), views.end(), [this] (const concurrency::accelerator_view& av) {
+            contexts.push_back(std::unique_ptr<context>(new context(av)));
+        });
+    }
+
+    int size() const
+    {
+        return static_cast<int>(contexts.size());
+    }
+
+    context& operator[](int device)
+    {
+        return *contexts[device];
+    }
+
+private:
+    // non-copyable
+    context_group(const context_group&);
+    context_group& operator=(const context_group&);
+
+    std::vector<std::unique_ptr<context>> contexts;
+};
+
+// work queued by an asynchronous routine
+//
+// The call keeps the device memory of its queued work alive and completes once all of its
+// copies back to the host have finished. A data error found by the queued work arrives with
+// those copies and is thrown by wait. The context the work was queued on must outlive the call.
+class async_call
+{
+public:
+    async_call()
+        : info(0)
+    {}
+
+    // takes ownership of memory used by the queued work
+    template <typename memory_type>
+    memory_type& hold(memory_type* memory)
+    {
+        std::shared_ptr<void> owner(memory);
+        held.push_back(owner);
+        return *memory;
+    }
+
+    void add(const concurrency::completion_future& copy)
+    {
+        copies.push_back(copy);
+    }
+
+    // destination of the data error (0 if none) 
+    int* get_info()
+    {
+        return &info;
+    }
+
+    bool is_done() const
+    {
+        return std::all_of(copies.begin(), copies.end(), [] (const concurrency::completion_future& copy) {
+            return copy.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        });
+    }
+
+    void wait()
+    {
+        // rethrows any runtime error of the copies
+        std::for_each(copies.begin(), copies.end(), [] (const concurrency::completion_future& copy) {
+            copy.get();
+        });
+
+        if (info)
+            data_error(info);
+    }
+
+private:
+    // non-copyable
+    async_call(const async_call&);
+    async_call& operator=(const async_call&);
+
+    std::vector<std::shared_ptr<void>> held;
+    std::vector<concurrency::completion_future> copies;
+    int info;
+};
+
+// exception safe execution wrapper
+amplapack_status safe_call_interface(std::function<void(concurrency::accelerator_view& av)>& functor, int& info);
+
+// exception safe execution wrappers for routines that take a context
+// the first creates a temporary context on the default view, the second uses the context owned by the handle
+amplapack_status safe_call_interface(std::function<void(context& ctx)>& functor, int& info);
+amplapack_status safe_call_interface(std::function<void(context& ctx)>& functor, amplapack_handle handle, int& info);
+
+// exception safe execution wrapper for functors that need neither a view nor a context
+amplapack_status safe_call_interface(std::function<void()>& functor, int& info);
+
+// exception safe execution wrappers for asynchronous routines; once the functor has queued 
+// its work the token takes over the call (and, without a handle, a context on the default view)
+amplapack_status safe_call_interface(std::function<void(context& ctx, async_call& call)>& functor, amplapack_async* token, int& info);
+amplapack_status safe_call_interface(std::function<void(context& ctx, async_call& call)>& functor, amplapack_handle handle, amplapack_async* token, int& info);
+
+// exception safe execution wrapper for routines on device matrices; the functor runs on the 
+// context of the handle that owns the matrix passed as the given argument
+amplapack_status safe_call_interface(std::function<void(context& ctx)>& functor, amplapack_matrix matrix, int argument, int& info);
+
+// creates a row or column vector from a 2d array with either the 1st or 2nd dimension being 1 
+template <typename value_type>
+class subvector_view
+{
+public:
+
+    // match some of the interface of array_view
+    typedef typename value_type value_type;
+    concurrency::extent<1> extent;
+
+    subvector_view(const concurrency::array_view<value_type,2>& base_view) restrict(cpu,amp)
+    : base_view(base_view)
+	{
+        //
+        if (base_view.extent[1] == 1)
+        {
+            direction = 0;
+        }
+        else if (base_view.extent[0] == 1)
+        {
+            direction = 1;            
+        }
+
+        extent = concurrency::extent<1>(base_view.extent[direction]);
+	}
+
+	~subvector_view() restrict(cpu,amp) {}
+
+	value_type& operator[] (const concurrency::index<1>& idx) const restrict(cpu,amp)
+	{
+        concurrency::index<2> idx_2d = (direction == 0 ? concurrency::index<2>(idx[0],0) : concurrency::index<2>(0,idx[0]));
+		return base_view[idx_2d];
+	}
+
+private:
+
+    // the dimension of the data:
+    //   0 is a row vector
+    //   1 is a column vector
+    unsigned int direction;
+    concurrency::array_view<value_type,2> base_view;
+};
+
+template <typename value_type>
+subvector_view<value_type> make_subvector_view(const concurrency::array_view<value_type,2>& base_view) restrict(cpu, amp)
+{
+    return subvector_view<value_type>(base_view);
+}
+
+// option used to specify where factorization takes place
+enum class block_factor_location { host, accelerator };
+
+// option used to specify where a host interface routine runs: entirely on the host LAPACK 
+// library, with the hybrid algorithm (host panels) or entirely on the accelerator
+enum class execution_target { host, hybrid, accelerator };
+
+// chooses the execution target of a problem of the given size from the crossover points of 
+// the routine and precision (see amplapack_set_crossover)
+execution_target select_target(amplapack_routine routine, char precision, int size);
+
+// LAPACK precision prefix of a value type
+template <typename value_type> char precision_of();
+template <> inline char precision_of<float>() { return 'S'; }
+template <> inline char precision_of<double>() { return 'D'; }
+template <> inline char precision_of<ampblas::complex<float>>() { return 'C'; }
+template <> inline char precision_of<ampblas::complex<double>>() { return 'Z'; }
+
+// LAPACK character option casting
+inline char to_char(enum class uplo uplo)
+{
+    switch (uplo)
+    {
+    case uplo::upper:
+        return 'u';
+    case uplo::lower:
+    default:
+        return 'l';
+    }
+}
+
+inline enum class uplo to_option(const char& uplo)
+{
+    switch (uplo)
+    {
+    case 'L':
+    case 'l':
+        return uplo::lower;
+    case 'U':
+    case 'u':
+    default:
+        return uplo::upper;
+    }
+}
+
+inline enum class transpose to_transpose_option(const char& trans)
+{
+    switch (trans)
+    {
+    case 'T':
+    case 't':
+        return transpose::trans;
+    case 'C':
+    case 'c':
+        return transpose::conj_trans;
+    case 'N':
+    case 'n':
+    default:
+        return transpose::no_trans;
+    }
+}
+
+// runtime checks
+template <typename value_type, template <typename,int> class container_type>
+int require_square(const container_type<value_type,2>& a)
+{
+    if (a.extent[0] != a.extent[1])
+        runtime_error();
+
+    return a.extent[0];
+}
+
+template <enum class ordering storage_type, typename value_type, template <typename,int> class container_type>
+int get_rows(const container_type<value_type,2>& a)
+{
+    if (storage_type == ordering::column_major)
+        return a.extent[1];
+    else
+        return a.extent[0];
+}
+
+template <enum class ordering storage_type, typename value_type, template <typename,int> class container_type>
+int get_cols(const container_type<value_type,2>& a)
+{
+    if (storage_type == ordering::column_major)
+        return a.extent[0];
+    else
+        return a.extent[1];
+}
+
+template <enum class ordering storage_type, typename value_type, template <typename,int> class container_type>
+int get_leading_dimension(const container_type<value_type,2>& a)
+{
+    if (storage_type == ordering::column_major)
+        return a.extent[1];
+    else
+        return a.extent[0];
+}
+
+// checks returns from a host LAPACK call
+inline void info_check(int info)
+{
+    if (info > 0)
+        data_error(info);
+    else if (info < 0)
+        argument_error(-info);
+}
+
+// a simple host array wrapper
+template <unsigned int rank, typename value_type>
+class host_array_view
+{
+public:
+    host_array_view(const concurrency::extent<rank>& extent, value_type* ptr)
+        : extent(extent), base_ptr(ptr)
+    {}
+
+private:
+    const concurrency::extent<rank> extent;
+    value_type const* base_ptr;
+};
+
+// data layout aware sub-matrix extraction method
+template <enum class ordering storage_type, typename value_type, template <typename,int> class container_type>
+concurrency::array_view<value_type,2> get_sub_matrix(const container_type<value_type,2>& matrix, const concurrency::index<2>& location, const concurrency::extent<2>& size)
+{
+    if (storage_type == ordering::row_major)
+        return matrix.section(location, size);
+    else
+        return matrix.section(concurrency::index<2>(location[1], location[0]), concurrency::extent<2>(size[1], size[0]));
+}
+
+// data layout aware extent of a rows by cols matrix
+template <enum class ordering storage_type>
+concurrency::extent<2> make_extent(int rows, int cols)
+{
+    if (storage_type == ordering::row_major)
+        return concurrency::extent<2>(rows, cols);
+    else
+        return concurrency::extent<2>(cols, rows);
+}
+
+// data layout aware element access (row i, column j), usable in accelerator kernels
+template <enum class ordering storage_type, typename value_type>
+value_type& get_element(const concurrency::array_view<value_type,2>& a, int i, int j) restrict(cpu,amp)
+{
+    return (storage_type == ordering::row_major ? a(i,j) : a(j,i));
+}
+
+//
+// Accelerator Math Helpers
+//
+
+inline float real_part(float x) restrict(cpu,amp) { return x; }
+inline double real_part(double x) restrict(cpu,amp) { return x; }
+template <typename T> T real_part(const ampblas::complex<T>& x) restrict(cpu,amp) { return x.real(); }
+
+inline float imag_part(float) restrict(cpu,amp) { return 0.0f; }
+inline double imag_part(double) restrict(cpu,amp) { return 0.0; }
+template <typename T> T imag_part(const ampblas::complex<T>& x) restrict(cpu,amp) { return x.imag(); }
+
+inline float conjugate(float x) restrict(cpu,amp) { return x; }
+inline double conjugate(double x) restrict(cpu,amp) { return x; }
+template <typename T> ampblas::complex<T> conjugate(const ampblas::complex<T>& x) restrict(cpu,amp) { return ampblas::complex<T>(x.real(), -x.imag()); }
+
+// builds a value from its real and imaginary parts (the imaginary part is dropped for real types)
+inline void from_parts(float& x, float re, float) restrict(cpu,amp) { x = re; }
+inline void from_parts(double& x, double re, double) restrict(cpu,amp) { x = re; }
+template <typename T> void from_parts(ampblas::complex<T>& x, T re, T im) restrict(cpu,amp) { x = ampblas::complex<T>(re, im); }
+
+// |re(x)| + |im(x)| as used by the LAPACK i?amax pivot search
+inline float abs1(float x) restrict(cpu,amp) { return x < 0.0f ? -x : x; }
+inline double abs1(double x) restrict(cpu,amp) { return x < 0.0 ? -x : x; }
+template <typename T> T abs1(const ampblas::complex<T>& x) restrict(cpu,amp) { return abs1(x.real()) + abs1(x.imag()); }
+
+// |x|^2
+template <typename value_type> 
+typename ampblas::real_type<value_type>::type abs_squared(const value_type& x) restrict(cpu,amp)
+{
+    return real_part(x)*real_part(x) + imag_part(x)*imag_part(x);
+}
+
+// 1/x (computed through the conjugate for complex values)
+inline float reciprocal(float x) restrict(cpu,amp) { return 1.0f / x; }
+inline double reciprocal(double x) restrict(cpu,amp) { return 1.0 / x; }
+template <typename T> ampblas::complex<T> reciprocal(const ampblas::complex<T>& x) restrict(cpu,amp) { return conjugate(x) * ampblas::complex<T>(T(1) / abs_squared(x)); }
+
+// double precision square roots require an accelerator with full double precision support
+inline float square_root(float x) restrict(amp) { return concurrency::fast_math::sqrt(x); }
+inline double square_root(double x) restrict(amp) { return concurrency::precise_math::sqrt(x); }
+
+} // namesapce amplapack
+
+// the opaque library handle exposed through the C interface
+struct amplapack_handle_t
+{
+    explicit amplapack_handle_t(const concurrency::accelerator_view& av)
+        : ctx(av)
+    {}
+
+    amplapack::context ctx;
+};
+
+// the opaque token of an asynchronous call exposed through the C interface
+struct amplapack_async_t
+{
+    // the context of a call made without a handle (destroyed after the call)
+    std::unique_ptr<amplapack::context> ctx;
+    amplapack::async_call call;
+};
+
+// the opaque device matrix exposed through the C interface
+struct amplapack_matrix_t
+{
+    amplapack_matrix_t(amplapack_handle handle, char precision, int m, int n, const std::shared_ptr<void>& data)
+        : handle(handle), precision(precision), m(m), n(n), data(data)
+    {}
+
+    amplapack_handle handle;
+    char precision;
+    int m;
+    int n;
+
+    // a column major concurrency::array<value_type,2> of extent (n,m) on the handle's view
+    std::shared_ptr<void> data;
+};
+
+namespace amplapack {
+
+// the device matrix passed as the given argument of a routine running on ctx; the matrix must 
+// belong to the handle owning ctx and hold values of the routine's precision
+template <typename value_type>
+concurrency::array_view<value_type,2> get_matrix_view(context& ctx, amplapack_matrix matrix, int argument)
+{
+    if (matrix == nullptr || &matrix->handle->ctx != &ctx || matrix->precision != precision_of<value_type>())
+        argument_error(argument);
+
+    return *static_cast<concurrency::array<value_type,2>*>(matrix->data.get());
+}
+
+} // namespace amplapack
+
+#endif AMPLAPACK_RUNTIME_H
+
+
@@ -1,99 +1,1143 @@
-/*----------------------------------------------------------------------------
- * Copyright  Microsoft Corp.
- *
- * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
- * use this file except in compliance with the License.  You may obtain a copy 
- * of the License at http://www.apache.org/licenses/LICENSE-2.0  
- * 
- * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
- * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
- * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
- * MERCHANTABLITY OR NON-INFRINGEMENT. 
- *
- * See the Apache Version 2.0 License for specific language governing 
- * permissions and limitations under the License.
- *---------------------------------------------------------------------------
- * 
- * Overloaded C++ headers
- *
- *---------------------------------------------------------------------------*/
-
-#pragma once
-#ifndef AMPXLAPACK_H
-#define AMPXLAPACK_H
-
-#include "ampclapack.h"
-
-//
-// GETRF
-//
-
-inline amplapack_status amplapack_getrf(int m, int n, float* a, int lda, int* ipiv, int* info) 
-{
-    return amplapack_sgetrf(m, n, a, lda, ipiv, info);
-}
-
-inline amplapack_status amplapack_getrf(int m, int n, double* a, int lda, int* ipiv, int* info) 
-{
-    return amplapack_dgetrf(m, n, a, lda, ipiv, info);
-}
-
-inline amplapack_status amplapack_getrf(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, int* info) 
-{
-    return amplapack_cgetrf(m, n, a, lda, ipiv, info);
-}
-
-inline amplapack_status amplapack_getrf(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, int* info) 
-{
-    return amplapack_zgetrf(m, n, a, lda, ipiv, info);
-}
-
-//
-// GEQRF
-//
-
-inline amplapack_status amplapack_geqrf(int m, int n, float* a, int lda, float* tau, int* info)
-{
-    return amplapack_sgeqrf(m, n, a, lda, tau, info);
-}
-
-inline amplapack_status amplapack_geqrf(int m, int n, double* a, int lda, double* tau, int* info)
-{
-    return amplapack_dgeqrf(m, n, a, lda, tau, info);
-}
-
-inline amplapack_status amplapack_geqrf(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, int* info)
-{
-    return amplapack_cgeqrf(m, n, a, lda, tau, info);
-}
-
-inline amplapack_status amplapack_geqrf(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, int* info)
-{
-    return amplapack_zgeqrf(m, n, a, lda, tau, info);
-}
-
-//
-// POTRF
-//
-
-inline amplapack_status amplapack_potrf(char uplo, int n, float* a, int lda, int* info) 
-{
-    return amplapack_spotrf(uplo, n, a, lda, info);
-}
-
-inline amplapack_status amplapack_potrf(char uplo, int n, double* a, int lda, int* info) 
-{
-    return amplapack_dpotrf(uplo, n, a, lda, info);
-}
-
-inline amplapack_status amplapack_potrf(char uplo, int n, amplapack_fcomplex* a, int lda, int* info) 
-{
-    return amplapack_cpotrf(uplo, n, a, lda, info);
-}
-
-inline amplapack_status amplapack_potrf(char uplo, int n, amplapack_dcomplex* a, int lda, int* info) 
-{
-    return amplapack_zpotrf(uplo, n, a, lda, info);
-}
-
-#endif // AMPXLAPACK_H
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * Overloaded C++ headers
+ *
+ *---------------------------------------------------------------------------*/
+
+#pragma once
+#ifndef AMPXLAPACK_H
+#define AMPXLAPACK_H
+
+#include "ampclapack.h"
+
+//
+// GETRF
+//
+
+inline amplapack_status amplapack_getrf(int m, int n, float* a, int lda, int* ipiv, int* info) 
+{
+    return amplapack_sgetrf(m, n, a, lda, ipiv, info);
+}
+
+inline amplapack_status amplapack_getrf(int m, int n, double* a, int lda, int* ipiv, int* info) 
+{
+    return amplapack_dgetrf(m, n, a, lda, ipiv, info);
+}
+
+inline amplapack_status amplapack_getrf(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, int* info) 
+{
+    return amplapack_cgetrf(m, n, a, lda, ipiv, info);
+}
+
+inline amplapack_status amplapack_getrf(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, int* info) 
+{
+    return amplapack_zgetrf(m, n, a, lda, ipiv, info);
+}
+
+inline amplapack_status amplapack_getrf(amplapack_handle handle, int m, int n, float* a, int lda, int* ipiv, int* info) 
+{
+    return amplapack_sgetrf_h(handle, m, n, a, lda, ipiv, info);
+}
+
+inline amplapack_status amplapack_getrf(amplapack_handle handle, int m, int n, double* a, int lda, int* ipiv, int* info) 
+{
+    return amplapack_dgetrf_h(handle, m, n, a, lda, ipiv, info);
+}
+
+inline amplapack_status amplapack_getrf(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, int* info) 
+{
+    return amplapack_cgetrf_h(handle, m, n, a, lda, ipiv, info);
+}
+
+inline amplapack_status amplapack_getrf(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, int* info) 
+{
+    return amplapack_zgetrf_h(handle, m, n, a, lda, ipiv, info);
+}
+
+//
+// GEQRF
+//
+
+inline amplapack_status amplapack_geqrf(int m, int n, float* a, int lda, float* tau, int* info)
+{
+    return amplapack_sgeqrf(m, n, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_geqrf(int m, int n, double* a, int lda, double* tau, int* info)
+{
+    return amplapack_dgeqrf(m, n, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_geqrf(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, int* info)
+{
+    return amplapack_cgeqrf(m, n, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_geqrf(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, int* info)
+{
+    return amplapack_zgeqrf(m, n, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_geqrf(amplapack_handle handle, int m, int n, float* a, int lda, float* tau, int* info)
+{
+    return amplapack_sgeqrf_h(handle, m, n, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_geqrf(amplapack_handle handle, int m, int n, double* a, int lda, double* tau, int* info)
+{
+    return amplapack_dgeqrf_h(handle, m, n, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_geqrf(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, int* info)
+{
+    return amplapack_cgeqrf_h(handle, m, n, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_geqrf(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, int* info)
+{
+    return amplapack_zgeqrf_h(handle, m, n, a, lda, tau, info);
+}
+
+//
+// POTRF
+//
+
+inline amplapack_status amplapack_potrf(char uplo, int n, float* a, int lda, int* info) 
+{
+    return amplapack_spotrf(uplo, n, a, lda, info);
+}
+
+inline amplapack_status amplapack_potrf(char uplo, int n, double* a, int lda, int* info) 
+{
+    return amplapack_dpotrf(uplo, n, a, lda, info);
+}
+
+inline amplapack_status amplapack_potrf(char uplo, int n, amplapack_fcomplex* a, int lda, int* info) 
+{
+    return amplapack_cpotrf(uplo, n, a, lda, info);
+}
+
+inline amplapack_status amplapack_potrf(char uplo, int n, amplapack_dcomplex* a, int lda, int* info) 
+{
+    return amplapack_zpotrf(uplo, n, a, lda, info);
+}
+
+inline amplapack_status amplapack_potrf(amplapack_handle handle, char uplo, int n, float* a, int lda, int* info) 
+{
+    return amplapack_spotrf_h(handle, uplo, n, a, lda, info);
+}
+
+inline amplapack_status amplapack_potrf(amplapack_handle handle, char uplo, int n, double* a, int lda, int* info) 
+{
+    return amplapack_dpotrf_h(handle, uplo, n, a, lda, info);
+}
+
+inline amplapack_status amplapack_potrf(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, int* info) 
+{
+    return amplapack_cpotrf_h(handle, uplo, n, a, lda, info);
+}
+
+inline amplapack_status amplapack_potrf(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, int* info) 
+{
+    return amplapack_zpotrf_h(handle, uplo, n, a, lda, info);
+}
+
+//
+// GETRS
+//
+
+inline amplapack_status amplapack_getrs(char trans, int n, int nrhs, const float* a, int lda, const int* ipiv, float* b, int ldb, int* info)
+{
+    return amplapack_sgetrs(trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_getrs(char trans, int n, int nrhs, const double* a, int lda, const int* ipiv, double* b, int ldb, int* info)
+{
+    return amplapack_dgetrs(trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_getrs(char trans, int n, int nrhs, const amplapack_fcomplex* a, int lda, const int* ipiv, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return amplapack_cgetrs(trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_getrs(char trans, int n, int nrhs, const amplapack_dcomplex* a, int lda, const int* ipiv, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return amplapack_zgetrs(trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_getrs(amplapack_handle handle, char trans, int n, int nrhs, const float* a, int lda, const int* ipiv, float* b, int ldb, int* info)
+{
+    return amplapack_sgetrs_h(handle, trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_getrs(amplapack_handle handle, char trans, int n, int nrhs, const double* a, int lda, const int* ipiv, double* b, int ldb, int* info)
+{
+    return amplapack_dgetrs_h(handle, trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_getrs(amplapack_handle handle, char trans, int n, int nrhs, const amplapack_fcomplex* a, int lda, const int* ipiv, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return amplapack_cgetrs_h(handle, trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_getrs(amplapack_handle handle, char trans, int n, int nrhs, const amplapack_dcomplex* a, int lda, const int* ipiv, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return amplapack_zgetrs_h(handle, trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+//
+// GESV
+//
+
+inline amplapack_status amplapack_gesv(int n, int nrhs, float* a, int lda, int* ipiv, float* b, int ldb, int* info)
+{
+    return amplapack_sgesv(n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_gesv(int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, int* info)
+{
+    return amplapack_dgesv(n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_gesv(int n, int nrhs, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return amplapack_cgesv(n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_gesv(int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return amplapack_zgesv(n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_gesv(amplapack_handle handle, int n, int nrhs, float* a, int lda, int* ipiv, float* b, int ldb, int* info)
+{
+    return amplapack_sgesv_h(handle, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_gesv(amplapack_handle handle, int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, int* info)
+{
+    return amplapack_dgesv_h(handle, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_gesv(amplapack_handle handle, int n, int nrhs, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return amplapack_cgesv_h(handle, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+inline amplapack_status amplapack_gesv(amplapack_handle handle, int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return amplapack_zgesv_h(handle, n, nrhs, a, lda, ipiv, b, ldb, info);
+}
+
+//
+// POTRS
+//
+
+inline amplapack_status amplapack_potrs(char uplo, int n, int nrhs, const float* a, int lda, float* b, int ldb, int* info)
+{
+    return amplapack_spotrs(uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_potrs(char uplo, int n, int nrhs, const double* a, int lda, double* b, int ldb, int* info)
+{
+    return amplapack_dpotrs(uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_potrs(char uplo, int n, int nrhs, const amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return amplapack_cpotrs(uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_potrs(char uplo, int n, int nrhs, const amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return amplapack_zpotrs(uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_potrs(amplapack_handle handle, char uplo, int n, int nrhs, const float* a, int lda, float* b, int ldb, int* info)
+{
+    return amplapack_spotrs_h(handle, uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_potrs(amplapack_handle handle, char uplo, int n, int nrhs, const double* a, int lda, double* b, int ldb, int* info)
+{
+    return amplapack_dpotrs_h(handle, uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_potrs(amplapack_handle handle, char uplo, int n, int nrhs, const amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return amplapack_cpotrs_h(handle, uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_potrs(amplapack_handle handle, char uplo, int n, int nrhs, const amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return amplapack_zpotrs_h(handle, uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+//
+// POSV
+//
+
+inline amplapack_status amplapack_posv(char uplo, int n, int nrhs, float* a, int lda, float* b, int ldb, int* info)
+{
+    return amplapack_sposv(uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_posv(char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, int* info)
+{
+    return amplapack_dposv(uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_posv(char uplo, int n, int nrhs, amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return amplapack_cposv(uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_posv(char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return amplapack_zposv(uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_posv(amplapack_handle handle, char uplo, int n, int nrhs, float* a, int lda, float* b, int ldb, int* info)
+{
+    return amplapack_sposv_h(handle, uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_posv(amplapack_handle handle, char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, int* info)
+{
+    return amplapack_dposv_h(handle, uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_posv(amplapack_handle handle, char uplo, int n, int nrhs, amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return amplapack_cposv_h(handle, uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+inline amplapack_status amplapack_posv(amplapack_handle handle, char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return amplapack_zposv_h(handle, uplo, n, nrhs, a, lda, b, ldb, info);
+}
+
+//
+// ORMQR/UNMQR
+//
+
+inline amplapack_status amplapack_ormqr(char side, char trans, int m, int n, int k, const float* a, int lda, const float* tau, float* c, int ldc, int* info)
+{
+    return amplapack_sormqr(side, trans, m, n, k, a, lda, tau, c, ldc, info);
+}
+
+inline amplapack_status amplapack_ormqr(char side, char trans, int m, int n, int k, const double* a, int lda, const double* tau, double* c, int ldc, int* info)
+{
+    return amplapack_dormqr(side, trans, m, n, k, a, lda, tau, c, ldc, info);
+}
+
+inline amplapack_status amplapack_ormqr(char side, char trans, int m, int n, int k, const amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, amplapack_fcomplex* c, int ldc, int* info)
+{
+    return amplapack_cunmqr(side, trans, m, n, k, a, lda, tau, c, ldc, info);
+}
+
+inline amplapack_status amplapack_ormqr(char side, char trans, int m, int n, int k, const amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, amplapack_dcomplex* c, int ldc, int* info)
+{
+    return amplapack_zunmqr(side, trans, m, n, k, a, lda, tau, c, ldc, info);
+}
+
+inline amplapack_status amplapack_ormqr(amplapack_handle handle, char side, char trans, int m, int n, int k, const float* a, int lda, const float* tau, float* c, int ldc, int* info)
+{
+    return amplapack_sormqr_h(handle, side, trans, m, n, k, a, lda, tau, c, ldc, info);
+}
+
+inline amplapack_status amplapack_ormqr(amplapack_handle handle, char side, char trans, int m, int n, int k, const double* a, int lda, const double* tau, double* c, int ldc, int* info)
+{
+    return amplapack_dormqr_h(handle, side, trans, m, n, k, a, lda, tau, c, ldc, info);
+}
+
+inline amplapack_status amplapack_ormqr(amplapack_handle handle, char side, char trans, int m, int n, int k, const amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, amplapack_fcomplex* c, int ldc, int* info)
+{
+    return amplapack_cunmqr_h(handle, side, trans, m, n, k, a, lda, tau, c, ldc, info);
+}
+
+inline amplapack_status amplapack_ormqr(amplapack_handle handle, char side, char trans, int m, int n, int k, const amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, amplapack_dcomplex* c, int ldc, int* info)
+{
+    return amplapack_zunmqr_h(handle, side, trans, m, n, k, a, lda, tau, c, ldc, info);
+}
+
+//
+// ORGQR/UNGQR
+//
+
+inline amplapack_status amplapack_orgqr(int m, int n, int k, float* a, int lda, const float* tau, int* info)
+{
+    return amplapack_sorgqr(m, n, k, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_orgqr(int m, int n, int k, double* a, int lda, const double* tau, int* info)
+{
+    return amplapack_dorgqr(m, n, k, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_orgqr(int m, int n, int k, amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, int* info)
+{
+    return amplapack_cungqr(m, n, k, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_orgqr(int m, int n, int k, amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, int* info)
+{
+    return amplapack_zungqr(m, n, k, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_orgqr(amplapack_handle handle, int m, int n, int k, float* a, int lda, const float* tau, int* info)
+{
+    return amplapack_sorgqr_h(handle, m, n, k, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_orgqr(amplapack_handle handle, int m, int n, int k, double* a, int lda, const double* tau, int* info)
+{
+    return amplapack_dorgqr_h(handle, m, n, k, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_orgqr(amplapack_handle handle, int m, int n, int k, amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, int* info)
+{
+    return amplapack_cungqr_h(handle, m, n, k, a, lda, tau, info);
+}
+
+inline amplapack_status amplapack_orgqr(amplapack_handle handle, int m, int n, int k, amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, int* info)
+{
+    return amplapack_zungqr_h(handle, m, n, k, a, lda, tau, info);
+}
+
+//
+// GETRF BATCHED
+//
+
+inline amplapack_status amplapack_getrf_batched(int m, int n, float** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_sgetrf_batched(m, n, a_array, lda, ipiv_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_batched(int m, int n, double** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dgetrf_batched(m, n, a_array, lda, ipiv_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_batched(int m, int n, amplapack_fcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cgetrf_batched(m, n, a_array, lda, ipiv_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_batched(int m, int n, amplapack_dcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zgetrf_batched(m, n, a_array, lda, ipiv_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_batched(amplapack_handle handle, int m, int n, float** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_sgetrf_batched_h(handle, m, n, a_array, lda, ipiv_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_batched(amplapack_handle handle, int m, int n, double** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dgetrf_batched_h(handle, m, n, a_array, lda, ipiv_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_batched(amplapack_handle handle, int m, int n, amplapack_fcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cgetrf_batched_h(handle, m, n, a_array, lda, ipiv_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_batched(amplapack_handle handle, int m, int n, amplapack_dcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zgetrf_batched_h(handle, m, n, a_array, lda, ipiv_array, info_array, batch_count, info);
+}
+
+//
+// GETRF STRIDED BATCHED
+//
+
+inline amplapack_status amplapack_getrf_strided_batched(int m, int n, float* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return amplapack_sgetrf_strided_batched(m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_strided_batched(int m, int n, double* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dgetrf_strided_batched(m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_strided_batched(int m, int n, amplapack_fcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cgetrf_strided_batched(m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_strided_batched(int m, int n, amplapack_dcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zgetrf_strided_batched(m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_strided_batched(amplapack_handle handle, int m, int n, float* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return amplapack_sgetrf_strided_batched_h(handle, m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_strided_batched(amplapack_handle handle, int m, int n, double* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dgetrf_strided_batched_h(handle, m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_strided_batched(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cgetrf_strided_batched_h(handle, m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_getrf_strided_batched(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zgetrf_strided_batched_h(handle, m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, info);
+}
+
+//
+// POTRF BATCHED
+//
+
+inline amplapack_status amplapack_potrf_batched(char uplo, int n, float** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return amplapack_spotrf_batched(uplo, n, a_array, lda, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_batched(char uplo, int n, double** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dpotrf_batched(uplo, n, a_array, lda, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_batched(char uplo, int n, amplapack_fcomplex** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cpotrf_batched(uplo, n, a_array, lda, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_batched(char uplo, int n, amplapack_dcomplex** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zpotrf_batched(uplo, n, a_array, lda, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_batched(amplapack_handle handle, char uplo, int n, float** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return amplapack_spotrf_batched_h(handle, uplo, n, a_array, lda, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_batched(amplapack_handle handle, char uplo, int n, double** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dpotrf_batched_h(handle, uplo, n, a_array, lda, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_batched(amplapack_handle handle, char uplo, int n, amplapack_fcomplex** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cpotrf_batched_h(handle, uplo, n, a_array, lda, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_batched(amplapack_handle handle, char uplo, int n, amplapack_dcomplex** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zpotrf_batched_h(handle, uplo, n, a_array, lda, info_array, batch_count, info);
+}
+
+//
+// POTRF STRIDED BATCHED
+//
+
+inline amplapack_status amplapack_potrf_strided_batched(char uplo, int n, float* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return amplapack_spotrf_strided_batched(uplo, n, a, lda, stride_a, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_strided_batched(char uplo, int n, double* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dpotrf_strided_batched(uplo, n, a, lda, stride_a, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_strided_batched(char uplo, int n, amplapack_fcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cpotrf_strided_batched(uplo, n, a, lda, stride_a, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_strided_batched(char uplo, int n, amplapack_dcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zpotrf_strided_batched(uplo, n, a, lda, stride_a, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_strided_batched(amplapack_handle handle, char uplo, int n, float* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return amplapack_spotrf_strided_batched_h(handle, uplo, n, a, lda, stride_a, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_strided_batched(amplapack_handle handle, char uplo, int n, double* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dpotrf_strided_batched_h(handle, uplo, n, a, lda, stride_a, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_strided_batched(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cpotrf_strided_batched_h(handle, uplo, n, a, lda, stride_a, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_potrf_strided_batched(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zpotrf_strided_batched_h(handle, uplo, n, a, lda, stride_a, info_array, batch_count, info);
+}
+
+//
+// GEQRF BATCHED
+//
+
+inline amplapack_status amplapack_geqrf_batched(int m, int n, float** a_array, int lda, float** tau_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_sgeqrf_batched(m, n, a_array, lda, tau_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_batched(int m, int n, double** a_array, int lda, double** tau_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dgeqrf_batched(m, n, a_array, lda, tau_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_batched(int m, int n, amplapack_fcomplex** a_array, int lda, amplapack_fcomplex** tau_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cgeqrf_batched(m, n, a_array, lda, tau_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_batched(int m, int n, amplapack_dcomplex** a_array, int lda, amplapack_dcomplex** tau_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zgeqrf_batched(m, n, a_array, lda, tau_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_batched(amplapack_handle handle, int m, int n, float** a_array, int lda, float** tau_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_sgeqrf_batched_h(handle, m, n, a_array, lda, tau_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_batched(amplapack_handle handle, int m, int n, double** a_array, int lda, double** tau_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dgeqrf_batched_h(handle, m, n, a_array, lda, tau_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_batched(amplapack_handle handle, int m, int n, amplapack_fcomplex** a_array, int lda, amplapack_fcomplex** tau_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cgeqrf_batched_h(handle, m, n, a_array, lda, tau_array, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_batched(amplapack_handle handle, int m, int n, amplapack_dcomplex** a_array, int lda, amplapack_dcomplex** tau_array, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zgeqrf_batched_h(handle, m, n, a_array, lda, tau_array, info_array, batch_count, info);
+}
+
+//
+// GEQRF STRIDED BATCHED
+//
+
+inline amplapack_status amplapack_geqrf_strided_batched(int m, int n, float* a, int lda, int stride_a, float* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return amplapack_sgeqrf_strided_batched(m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_strided_batched(int m, int n, double* a, int lda, int stride_a, double* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dgeqrf_strided_batched(m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_strided_batched(int m, int n, amplapack_fcomplex* a, int lda, int stride_a, amplapack_fcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cgeqrf_strided_batched(m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_strided_batched(int m, int n, amplapack_dcomplex* a, int lda, int stride_a, amplapack_dcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zgeqrf_strided_batched(m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_strided_batched(amplapack_handle handle, int m, int n, float* a, int lda, int stride_a, float* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return amplapack_sgeqrf_strided_batched_h(handle, m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_strided_batched(amplapack_handle handle, int m, int n, double* a, int lda, int stride_a, double* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return amplapack_dgeqrf_strided_batched_h(handle, m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_strided_batched(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int stride_a, amplapack_fcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return amplapack_cgeqrf_strided_batched_h(handle, m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, info);
+}
+
+inline amplapack_status amplapack_geqrf_strided_batched(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int stride_a, amplapack_dcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return amplapack_zgeqrf_strided_batched_h(handle, m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, info);
+}
+
+//
+// GESV (MIXED PRECISION)
+//
+
+inline amplapack_status amplapack_gesv_mixed(int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, double* x, int ldx, int* iter, int* info)
+{
+    return amplapack_dsgesv(n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter, info);
+}
+
+inline amplapack_status amplapack_gesv_mixed(int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info)
+{
+    return amplapack_zcgesv(n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter, info);
+}
+
+inline amplapack_status amplapack_gesv_mixed(amplapack_handle handle, int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, double* x, int ldx, int* iter, int* info)
+{
+    return amplapack_dsgesv_h(handle, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter, info);
+}
+
+inline amplapack_status amplapack_gesv_mixed(amplapack_handle handle, int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info)
+{
+    return amplapack_zcgesv_h(handle, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter, info);
+}
+
+//
+// POSV (MIXED PRECISION)
+//
+
+inline amplapack_status amplapack_posv_mixed(char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, double* x, int ldx, int* iter, int* info)
+{
+    return amplapack_dsposv(uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter, info);
+}
+
+inline amplapack_status amplapack_posv_mixed(char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info)
+{
+    return amplapack_zcposv(uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter, info);
+}
+
+inline amplapack_status amplapack_posv_mixed(amplapack_handle handle, char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, double* x, int ldx, int* iter, int* info)
+{
+    return amplapack_dsposv_h(handle, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter, info);
+}
+
+inline amplapack_status amplapack_posv_mixed(amplapack_handle handle, char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info)
+{
+    return amplapack_zcposv_h(handle, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter, info);
+}
+
+//
+// GETRF ASYNC
+//
+
+inline amplapack_status amplapack_getrf_async(int m, int n, float* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return amplapack_sgetrf_async(m, n, a, lda, ipiv, token, info);
+}
+
+inline amplapack_status amplapack_getrf_async(int m, int n, double* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return amplapack_dgetrf_async(m, n, a, lda, ipiv, token, info);
+}
+
+inline amplapack_status amplapack_getrf_async(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return amplapack_cgetrf_async(m, n, a, lda, ipiv, token, info);
+}
+
+inline amplapack_status amplapack_getrf_async(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return amplapack_zgetrf_async(m, n, a, lda, ipiv, token, info);
+}
+
+inline amplapack_status amplapack_getrf_async(amplapack_handle handle, int m, int n, float* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return amplapack_sgetrf_async_h(handle, m, n, a, lda, ipiv, token, info);
+}
+
+inline amplapack_status amplapack_getrf_async(amplapack_handle handle, int m, int n, double* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return amplapack_dgetrf_async_h(handle, m, n, a, lda, ipiv, token, info);
+}
+
+inline amplapack_status amplapack_getrf_async(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return amplapack_cgetrf_async_h(handle, m, n, a, lda, ipiv, token, info);
+}
+
+inline amplapack_status amplapack_getrf_async(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return amplapack_zgetrf_async_h(handle, m, n, a, lda, ipiv, token, info);
+}
+
+//
+// GEQRF ASYNC
+//
+
+inline amplapack_status amplapack_geqrf_async(int m, int n, float* a, int lda, float* tau, amplapack_async* token, int* info)
+{
+    return amplapack_sgeqrf_async(m, n, a, lda, tau, token, info);
+}
+
+inline amplapack_status amplapack_geqrf_async(int m, int n, double* a, int lda, double* tau, amplapack_async* token, int* info)
+{
+    return amplapack_dgeqrf_async(m, n, a, lda, tau, token, info);
+}
+
+inline amplapack_status amplapack_geqrf_async(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, amplapack_async* token, int* info)
+{
+    return amplapack_cgeqrf_async(m, n, a, lda, tau, token, info);
+}
+
+inline amplapack_status amplapack_geqrf_async(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, amplapack_async* token, int* info)
+{
+    return amplapack_zgeqrf_async(m, n, a, lda, tau, token, info);
+}
+
+inline amplapack_status amplapack_geqrf_async(amplapack_handle handle, int m, int n, float* a, int lda, float* tau, amplapack_async* token, int* info)
+{
+    return amplapack_sgeqrf_async_h(handle, m, n, a, lda, tau, token, info);
+}
+
+inline amplapack_status amplapack_geqrf_async(amplapack_handle handle, int m, int n, double* a, int lda, double* tau, amplapack_async* token, int* info)
+{
+    return amplapack_dgeqrf_async_h(handle, m, n, a, lda, tau, token, info);
+}
+
+inline amplapack_status amplapack_geqrf_async(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, amplapack_async* token, int* info)
+{
+    return amplapack_cgeqrf_async_h(handle, m, n, a, lda, tau, token, info);
+}
+
+inline amplapack_status amplapack_geqrf_async(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, amplapack_async* token, int* info)
+{
+    return amplapack_zgeqrf_async_h(handle, m, n, a, lda, tau, token, info);
+}
+
+//
+// POTRF ASYNC
+//
+
+inline amplapack_status amplapack_potrf_async(char uplo, int n, float* a, int lda, amplapack_async* token, int* info)
+{
+    return amplapack_spotrf_async(uplo, n, a, lda, token, info);
+}
+
+inline amplapack_status amplapack_potrf_async(char uplo, int n, double* a, int lda, amplapack_async* token, int* info)
+{
+    return amplapack_dpotrf_async(uplo, n, a, lda, token, info);
+}
+
+inline amplapack_status amplapack_potrf_async(char uplo, int n, amplapack_fcomplex* a, int lda, amplapack_async* token, int* info)
+{
+    return amplapack_cpotrf_async(uplo, n, a, lda, token, info);
+}
+
+inline amplapack_status amplapack_potrf_async(char uplo, int n, amplapack_dcomplex* a, int lda, amplapack_async* token, int* info)
+{
+    return amplapack_zpotrf_async(uplo, n, a, lda, token, info);
+}
+
+inline amplapack_status amplapack_potrf_async(amplapack_handle handle, char uplo, int n, float* a, int lda, amplapack_async* token, int* info)
+{
+    return amplapack_spotrf_async_h(handle, uplo, n, a, lda, token, info);
+}
+
+inline amplapack_status amplapack_potrf_async(amplapack_handle handle, char uplo, int n, double* a, int lda, amplapack_async* token, int* info)
+{
+    return amplapack_dpotrf_async_h(handle, uplo, n, a, lda, token, info);
+}
+
+inline amplapack_status amplapack_potrf_async(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, amplapack_async* token, int* info)
+{
+    return amplapack_cpotrf_async_h(handle, uplo, n, a, lda, token, info);
+}
+
+inline amplapack_status amplapack_potrf_async(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, amplapack_async* token, int* info)
+{
+    return amplapack_zpotrf_async_h(handle, uplo, n, a, lda, token, info);
+}
+
+//
+// CREATE MATRIX
+//
+
+inline amplapack_status amplapack_create_matrix(amplapack_handle handle, int m, int n, const float* a, int lda, amplapack_matrix* matrix, int* info)
+{
+    return amplapack_screate_matrix(handle, m, n, a, lda, matrix, info);
+}
+
+inline amplapack_status amplapack_create_matrix(amplapack_handle handle, int m, int n, const double* a, int lda, amplapack_matrix* matrix, int* info)
+{
+    return amplapack_dcreate_matrix(handle, m, n, a, lda, matrix, info);
+}
+
+inline amplapack_status amplapack_create_matrix(amplapack_handle handle, int m, int n, const amplapack_fcomplex* a, int lda, amplapack_matrix* matrix, int* info)
+{
+    return amplapack_ccreate_matrix(handle, m, n, a, lda, matrix, info);
+}
+
+inline amplapack_status amplapack_create_matrix(amplapack_handle handle, int m, int n, const amplapack_dcomplex* a, int lda, amplapack_matrix* matrix, int* info)
+{
+    return amplapack_zcreate_matrix(handle, m, n, a, lda, matrix, info);
+}
+
+//
+// SET MATRIX
+//
+
+inline amplapack_status amplapack_set_matrix(amplapack_matrix matrix, const float* a, int lda, int* info)
+{
+    return amplapack_sset_matrix(matrix, a, lda, info);
+}
+
+inline amplapack_status amplapack_set_matrix(amplapack_matrix matrix, const double* a, int lda, int* info)
+{
+    return amplapack_dset_matrix(matrix, a, lda, info);
+}
+
+inline amplapack_status amplapack_set_matrix(amplapack_matrix matrix, const amplapack_fcomplex* a, int lda, int* info)
+{
+    return amplapack_cset_matrix(matrix, a, lda, info);
+}
+
+inline amplapack_status amplapack_set_matrix(amplapack_matrix matrix, const amplapack_dcomplex* a, int lda, int* info)
+{
+    return amplapack_zset_matrix(matrix, a, lda, info);
+}
+
+//
+// GET MATRIX
+//
+
+inline amplapack_status amplapack_get_matrix(amplapack_matrix matrix, float* a, int lda, int* info)
+{
+    return amplapack_sget_matrix(matrix, a, lda, info);
+}
+
+inline amplapack_status amplapack_get_matrix(amplapack_matrix matrix, double* a, int lda, int* info)
+{
+    return amplapack_dget_matrix(matrix, a, lda, info);
+}
+
+inline amplapack_status amplapack_get_matrix(amplapack_matrix matrix, amplapack_fcomplex* a, int lda, int* info)
+{
+    return amplapack_cget_matrix(matrix, a, lda, info);
+}
+
+inline amplapack_status amplapack_get_matrix(amplapack_matrix matrix, amplapack_dcomplex* a, int lda, int* info)
+{
+    return amplapack_zget_matrix(matrix, a, lda, info);
+}
+
+//
+// GEQRF (DEVICE MATRIX)
+//
+
+inline amplapack_status amplapack_geqrf(amplapack_matrix a, float* tau, int* info)
+{
+    return amplapack_sgeqrf_m(a, tau, info);
+}
+
+inline amplapack_status amplapack_geqrf(amplapack_matrix a, double* tau, int* info)
+{
+    return amplapack_dgeqrf_m(a, tau, info);
+}
+
+inline amplapack_status amplapack_geqrf(amplapack_matrix a, amplapack_fcomplex* tau, int* info)
+{
+    return amplapack_cgeqrf_m(a, tau, info);
+}
+
+inline amplapack_status amplapack_geqrf(amplapack_matrix a, amplapack_dcomplex* tau, int* info)
+{
+    return amplapack_zgeqrf_m(a, tau, info);
+}
+
+//
+// ORMQR/UNMQR (DEVICE MATRIX)
+//
+
+inline amplapack_status amplapack_ormqr(char side, char trans, int k, amplapack_matrix a, const float* tau, amplapack_matrix c, int* info)
+{
+    return amplapack_sormqr_m(side, trans, k, a, tau, c, info);
+}
+
+inline amplapack_status amplapack_ormqr(char side, char trans, int k, amplapack_matrix a, const double* tau, amplapack_matrix c, int* info)
+{
+    return amplapack_dormqr_m(side, trans, k, a, tau, c, info);
+}
+
+inline amplapack_status amplapack_ormqr(char side, char trans, int k, amplapack_matrix a, const amplapack_fcomplex* tau, amplapack_matrix c, int* info)
+{
+    return amplapack_cunmqr_m(side, trans, k, a, tau, c, info);
+}
+
+inline amplapack_status amplapack_ormqr(char side, char trans, int k, amplapack_matrix a, const amplapack_dcomplex* tau, amplapack_matrix c, int* info)
+{
+    return amplapack_zunmqr_m(side, trans, k, a, tau, c, info);
+}
+
+//
+// ORGQR/UNGQR (DEVICE MATRIX)
+//
+
+inline amplapack_status amplapack_orgqr(int k, amplapack_matrix a, const float* tau, int* info)
+{
+    return amplapack_sorgqr_m(k, a, tau, info);
+}
+
+inline amplapack_status amplapack_orgqr(int k, amplapack_matrix a, const double* tau, int* info)
+{
+    return amplapack_dorgqr_m(k, a, tau, info);
+}
+
+inline amplapack_status amplapack_orgqr(int k, amplapack_matrix a, const amplapack_fcomplex* tau, int* info)
+{
+    return amplapack_cungqr_m(k, a, tau, info);
+}
+
+inline amplapack_status amplapack_orgqr(int k, amplapack_matrix a, const amplapack_dcomplex* tau, int* info)
+{
+    return amplapack_zungqr_m(k, a, tau, info);
+}
+
+//
+// GETRF_OOC
+//
+
+inline amplapack_status amplapack_getrf_ooc(int m, int n, float* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return amplapack_sgetrf_ooc(m, n, a, lda, ipiv, workspace, info);
+}
+
+inline amplapack_status amplapack_getrf_ooc(int m, int n, double* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return amplapack_dgetrf_ooc(m, n, a, lda, ipiv, workspace, info);
+}
+
+inline amplapack_status amplapack_getrf_ooc(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return amplapack_cgetrf_ooc(m, n, a, lda, ipiv, workspace, info);
+}
+
+inline amplapack_status amplapack_getrf_ooc(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return amplapack_zgetrf_ooc(m, n, a, lda, ipiv, workspace, info);
+}
+
+inline amplapack_status amplapack_getrf_ooc(amplapack_handle handle, int m, int n, float* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return amplapack_sgetrf_ooc_h(handle, m, n, a, lda, ipiv, workspace, info);
+}
+
+inline amplapack_status amplapack_getrf_ooc(amplapack_handle handle, int m, int n, double* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return amplapack_dgetrf_ooc_h(handle, m, n, a, lda, ipiv, workspace, info);
+}
+
+inline amplapack_status amplapack_getrf_ooc(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return amplapack_cgetrf_ooc_h(handle, m, n, a, lda, ipiv, workspace, info);
+}
+
+inline amplapack_status amplapack_getrf_ooc(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return amplapack_zgetrf_ooc_h(handle, m, n, a, lda, ipiv, workspace, info);
+}
+
+//
+// GEQRF_OOC
+//
+
+inline amplapack_status amplapack_geqrf_ooc(int m, int n, float* a, int lda, float* tau, size_t workspace, int* info)
+{
+    return amplapack_sgeqrf_ooc(m, n, a, lda, tau, workspace, info);
+}
+
+inline amplapack_status amplapack_geqrf_ooc(int m, int n, double* a, int lda, double* tau, size_t workspace, int* info)
+{
+    return amplapack_dgeqrf_ooc(m, n, a, lda, tau, workspace, info);
+}
+
+inline amplapack_status amplapack_geqrf_ooc(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, size_t workspace, int* info)
+{
+    return amplapack_cgeqrf_ooc(m, n, a, lda, tau, workspace, info);
+}
+
+inline amplapack_status amplapack_geqrf_ooc(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, size_t workspace, int* info)
+{
+    return amplapack_zgeqrf_ooc(m, n, a, lda, tau, workspace, info);
+}
+
+inline amplapack_status amplapack_geqrf_ooc(amplapack_handle handle, int m, int n, float* a, int lda, float* tau, size_t workspace, int* info)
+{
+    return amplapack_sgeqrf_ooc_h(handle, m, n, a, lda, tau, workspace, info);
+}
+
+inline amplapack_status amplapack_geqrf_ooc(amplapack_handle handle, int m, int n, double* a, int lda, double* tau, size_t workspace, int* info)
+{
+    return amplapack_dgeqrf_ooc_h(handle, m, n, a, lda, tau, workspace, info);
+}
+
+inline amplapack_status amplapack_geqrf_ooc(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, size_t workspace, int* info)
+{
+    return amplapack_cgeqrf_ooc_h(handle, m, n, a, lda, tau, workspace, info);
+}
+
+inline amplapack_status amplapack_geqrf_ooc(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, size_t workspace, int* info)
+{
+    return amplapack_zgeqrf_ooc_h(handle, m, n, a, lda, tau, workspace, info);
+}
+
+//
+// POTRF_OOC
+//
+
+inline amplapack_status amplapack_potrf_ooc(char uplo, int n, float* a, int lda, size_t workspace, int* info)
+{
+    return amplapack_spotrf_ooc(uplo, n, a, lda, workspace, info);
+}
+
+inline amplapack_status amplapack_potrf_ooc(char uplo, int n, double* a, int lda, size_t workspace, int* info)
+{
+    return amplapack_dpotrf_ooc(uplo, n, a, lda, workspace, info);
+}
+
+inline amplapack_status amplapack_potrf_ooc(char uplo, int n, amplapack_fcomplex* a, int lda, size_t workspace, int* info)
+{
+    return amplapack_cpotrf_ooc(uplo, n, a, lda, workspace, info);
+}
+
+inline amplapack_status amplapack_potrf_ooc(char uplo, int n, amplapack_dcomplex* a, int lda, size_t workspace, int* info)
+{
+    return amplapack_zpotrf_ooc(uplo, n, a, lda, workspace, info);
+}
+
+inline amplapack_status amplapack_potrf_ooc(amplapack_handle handle, char uplo, int n, float* a, int lda, size_t workspace, int* info)
+{
+    return amplapack_spotrf_ooc_h(handle, uplo, n, a, lda, workspace, info);
+}
+
+inline amplapack_status amplapack_potrf_ooc(amplapack_handle handle, char uplo, int n, double* a, int lda, size_t workspace, int* info)
+{
+    return amplapack_dpotrf_ooc_h(handle, uplo, n, a, lda, workspace, info);
+}
+
+inline amplapack_status amplapack_potrf_ooc(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, size_t workspace, int* info)
+{
+    return amplapack_cpotrf_ooc_h(handle, uplo, n, a, lda, workspace, info);
+}
+
+inline amplapack_status amplapack_potrf_ooc(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, size_t workspace, int* info)
+{
+    return amplapack_zpotrf_ooc_h(handle, uplo, n, a, lda, workspace, info);
+}
+
+#endif // AMPXLAPACK_H
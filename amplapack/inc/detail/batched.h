@@ -0,0 +1,840 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* batched.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_BATCHED_H
+#define AMPLAPACK_BATCHED_H
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "amplapack_config.h"
+#include "getrf.h"
+
+namespace amplapack {
+namespace _detail {
+
+//
+// Batched Layout
+//
+// A batch of m by n matrices is packed column major into a single view of extent 
+// (batch_count*n, m), matrix b occupying the columns b*n:(b+1)*n. The whole batch moves to 
+// the accelerator and back with one copy each way, and each factorization is a single
+// kernel that assigns one tile to a matrix. The matrices are expected to be small enough
+// for one tile to factor; per-matrix results (pivots, tau and info) are packed in the same
+// way, one row per matrix.
+//
+
+// threads per matrix
+const int batched_tile_size = 256;
+
+// upper bound on the number of tiles launched for a batch; tiles loop over larger batches
+const int batched_max_tiles = 65535;
+
+// element (i,j) of matrix b of a packed batch of matrices with n columns
+template <typename value_type>
+value_type& batch_element(const concurrency::array_view<value_type,2>& a, int n, int b, int i, int j) restrict(cpu,amp)
+{
+    return a(b*n + j, i);
+}
+
+// a packed accelerator copy of a batch of host matrices
+template <typename value_type>
+class batch_matrix
+{
+public:
+    // gathers the matrices into a staging buffer and uploads them
+    batch_matrix(context& ctx, int m, int n, value_type** a_array, int lda, int batch_count)
+        : ctx(ctx), m(m), n(n), a_array(a_array), lda(lda), batch_count(batch_count),
+          host_a(ctx.get_staging_pool(), concurrency::extent<2>(batch_count*n, m)),
+          accl_a(ctx.get_pool(), concurrency::extent<2>(batch_count*n, m))
+    {
+        value_type* packed = host_a.data();
+
+        for (int b = 0; b < batch_count; b++)
+            for (int j = 0; j < n; j++)
+                std::memcpy(packed + (b*n + j)*m, a_array[b] + j*lda, m*sizeof(value_type));
+
+        concurrency::copy(host_a.get_view(), accl_a.get_view());
+        ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(host_a.get_view().extent));
+    }
+
+    const concurrency::array_view<value_type,2>& get_view() const
+    {
+        return accl_a.get_view();
+    }
+
+    // downloads the batch and scatters it back to the host matrices
+    void download()
+    {
+        concurrency::copy(accl_a.get_view(), host_a.get_view());
+        ctx.get_transfers().add_to_host(get_bytes<value_type>(host_a.get_view().extent));
+
+        const value_type* packed = host_a.data();
+
+        for (int b = 0; b < batch_count; b++)
+            for (int j = 0; j < n; j++)
+                std::memcpy(a_array[b] + j*lda, packed + (b*n + j)*m, m*sizeof(value_type));
+    }
+
+private:
+
+    // non-copyable
+    batch_matrix(const batch_matrix&);
+    batch_matrix& operator=(const batch_matrix&);
+
+    context& ctx;
+    int m;
+    int n;
+    value_type** a_array;
+    int lda;
+    int batch_count;
+    staging_array<value_type> host_a;
+    pooled_array<value_type> accl_a;
+};
+
+// downloads per-matrix results (one row per matrix) to out_array[b]
+template <typename T>
+void scatter_rows(context& ctx, const concurrency::array_view<T,2>& results, T** out_array)
+{
+    const int batch_count = results.extent[0];
+    const int k = results.extent[1];
+
+    std::vector<T> host_results(results.extent.size());
+    concurrency::copy(results, host_results.begin());
+    ctx.get_transfers().add_to_host(get_bytes<T>(results.extent));
+
+    for (int b = 0; b < batch_count; b++)
+        std::memcpy(out_array[b], host_results.data() + b*k, k*sizeof(T));
+}
+
+// downloads the per-matrix info codes
+inline void scatter_info(context& ctx, const concurrency::array_view<int,2>& info, int* info_array)
+{
+    std::vector<int> host_info(info.extent.size());
+    concurrency::copy(info, host_info.begin());
+    ctx.get_transfers().add_to_host(get_bytes<int>(info.extent));
+
+    for (int b = 0; b < info.extent[0]; b++)
+        info_array[b] = host_info[b];
+}
+
+//
+// Batched Accelerator Factorizations
+//
+
+namespace accl {
+
+// unblocked LU with partial pivoting of every matrix of a packed batch
+//
+// For each column the tile reduces the pivot search, interchanges the rows and then updates 
+// the trailing matrix a row per thread, so neighbouring threads touch neighbouring elements.
+// A zero pivot is recorded in info (as getf2 does) and the factorization continues.
+template <typename value_type>
+void getf2_batched(const concurrency::accelerator_view& av, int n, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<int,2>& ipiv, const concurrency::array_view<int,2>& info)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    static const int tile_size = batched_tile_size;
+
+    const int m = a.extent[1];
+    const int k = std::min(m,n);
+    const int batch_count = a.extent[0] / n;
+    const int tiles = std::min(batch_count, batched_max_tiles);
+
+    concurrency::parallel_for_each(
+        av,
+        concurrency::extent<1>(tiles*tile_size).tile<tile_size>(),
+        [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        {
+            tile_static real_type max_value[tile_size];
+            tile_static int max_row[tile_size];
+
+            const int tid = tidx.local[0];
+
+            for (int b = tidx.tile[0]; b < batch_count; b += tiles)
+            {
+                if (tid == 0)
+                    info(b,0) = 0;
+
+                for (int jj = 0; jj < k; jj++)
+                {
+                    // pivot search (the first of equal values wins, as in i?amax)
+                    real_type value = real_type(-1);
+                    int row = jj;
+
+                    for (int i = jj + tid; i < m; i += tile_size)
+                    {
+                        const real_type v = abs1(batch_element(a, n, b, i, jj));
+
+                        if (v > value)
+                        {
+                            value = v;
+                            row = i;
+                        }
+                    }
+
+                    max_value[tid] = value;
+                    max_row[tid] = row;
+                    tidx.barrier.wait();
+
+                    for (int stride = tile_size/2; stride > 0; stride /= 2)
+                    {
+                        if (tid < stride)
+                        {
+                            const real_type other_value = max_value[tid+stride];
+                            const int other_row = max_row[tid+stride];
+
+                            if (other_value > max_value[tid] || (other_value == max_value[tid] && other_row < max_row[tid]))
+                            {
+                                max_value[tid] = other_value;
+                                max_row[tid] = other_row;
+                            }
+                        }
+
+                        tidx.barrier.wait();
+                    }
+
+                    const int p = max_row[0];
+                    const bool singular = (max_value[0] == real_type(0));
+
+                    if (tid == 0)
+                    {
+                        ipiv(b,jj) = p + 1;
+
+                        if (singular && info(b,0) == 0)
+                            info(b,0) = jj + 1;
+                    }
+
+                    // interchange rows jj and p
+                    if (p != jj)
+                    {
+                        for (int c = tid; c < n; c += tile_size)
+                            swap(batch_element(a, n, b, jj, c), batch_element(a, n, b, p, c));
+                    }
+
+                    tidx.barrier.wait_with_global_memory_fence();
+
+                    // multipliers and rank one update, a row per thread
+                    const value_type pivot = batch_element(a, n, b, jj, jj);
+
+                    for (int i = jj + 1 + tid; i < m; i += tile_size)
+                    {
+                        value_type l = batch_element(a, n, b, i, jj);
+
+                        if (!singular)
+                        {
+                            l = l * reciprocal(pivot);
+                            batch_element(a, n, b, i, jj) = l;
+                        }
+
+                        for (int c = jj + 1; c < n; c++)
+                            batch_element(a, n, b, i, c) -= l * batch_element(a, n, b, jj, c);
+                    }
+
+                    tidx.barrier.wait_with_global_memory_fence();
+                }
+            }
+        }
+    );
+}
+
+// unblocked Cholesky of every matrix of a packed batch
+//
+// As accl::potf2, the factorization of a matrix stops at its first non-positive pivot, 
+// which is recorded in info.
+template <typename value_type>
+void potf2_batched(const concurrency::accelerator_view& av, enum class uplo uplo, int n, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<int,2>& info)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    static const int tile_size = batched_tile_size;
+
+    const int batch_count = a.extent[0] / n;
+    const int tiles = std::min(batch_count, batched_max_tiles);
+    const bool upper = (uplo == uplo::upper);
+
+    concurrency::parallel_for_each(
+        av,
+        concurrency::extent<1>(tiles*tile_size).tile<tile_size>(),
+        [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        {
+            tile_static real_type pivot;
+            tile_static int failed;
+
+            const int tid = tidx.local[0];
+
+            for (int b = tidx.tile[0]; b < batch_count; b += tiles)
+            {
+                if (tid == 0)
+                    info(b,0) = 0;
+
+                for (int c = 0; c < n; c++)
+                {
+                    // pivot
+                    if (tid == 0)
+                    {
+                        const real_type d = real_part(batch_element(a, n, b, c, c));
+
+                        // also catches NaN
+                        failed = !(d > real_type(0));
+
+                        if (failed)
+                        {
+                            info(b,0) = c + 1;
+                        }
+                        else
+                        {
+                            pivot = square_root(d);
+                            batch_element(a, n, b, c, c) = value_type(pivot);
+                        }
+                    }
+
+                    tidx.barrier.wait_with_global_memory_fence();
+
+                    if (failed)
+                        break;
+
+                    // scale column (lower) or row (upper)
+                    const value_type scale = value_type(real_type(1) / pivot);
+
+                    for (int i = c + 1 + tid; i < n; i += tile_size)
+                    {
+                        if (upper)
+                            batch_element(a, n, b, c, i) *= scale;
+                        else
+                            batch_element(a, n, b, i, c) *= scale;
+                    }
+
+                    tidx.barrier.wait_with_global_memory_fence();
+
+                    // trailing update of the triangle
+                    for (int i = c + 1 + tid; i < n; i += tile_size)
+                    {
+                        if (upper)
+                        {
+                            const value_type aci = conjugate(batch_element(a, n, b, c, i));
+
+                            for (int j = i; j < n; j++)
+                                batch_element(a, n, b, i, j) -= aci * batch_element(a, n, b, c, j);
+                        }
+                        else
+                        {
+                            const value_type aic = batch_element(a, n, b, i, c);
+
+                            for (int j = c + 1; j <= i; j++)
+                                batch_element(a, n, b, i, j) -= aic * conjugate(batch_element(a, n, b, j, c));
+                        }
+                    }
+
+                    tidx.barrier.wait_with_global_memory_fence();
+                }
+
+                // failed is shared by the tile and is reset before the next matrix
+                tidx.barrier.wait();
+            }
+        }
+    );
+}
+
+// unblocked Householder QR of every matrix of a packed batch
+//
+// For each column the tile reduces the norm and forms the reflector as accl::geqr2 does, then
+// applies it to the remaining columns a column per thread.
+template <typename value_type>
+void geqr2_batched(const concurrency::accelerator_view& av, int n, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,2>& tau)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    static const int tile_size = batched_tile_size;
+
+    const int m = a.extent[1];
+    const int k = std::min(m,n);
+    const int batch_count = a.extent[0] / n;
+    const int tiles = std::min(batch_count, batched_max_tiles);
+
+    concurrency::parallel_for_each(
+        av,
+        concurrency::extent<1>(tiles*tile_size).tile<tile_size>(),
+        [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        {
+            tile_static real_type partial[tile_size];
+
+            const int tid = tidx.local[0];
+
+            for (int b = tidx.tile[0]; b < batch_count; b += tiles)
+            {
+                for (int jj = 0; jj < k; jj++)
+                {
+                    // read before the diagonal is overwritten below
+                    const value_type alpha = batch_element(a, n, b, jj, jj);
+
+                    // squared norm of x
+                    real_type sum = real_type(0);
+
+                    for (int i = jj + 1 + tid; i < m; i += tile_size)
+                        sum += abs_squared(batch_element(a, n, b, i, jj));
+
+                    partial[tid] = sum;
+                    tidx.barrier.wait();
+
+                    for (int stride = tile_size/2; stride > 0; stride /= 2)
+                    {
+                        if (tid < stride)
+                            partial[tid] += partial[tid+stride];
+
+                        tidx.barrier.wait();
+                    }
+
+                    const real_type xnorm2 = partial[0];
+
+                    // H = I unless there is something to annihilate
+                    const bool reflect = !(xnorm2 == real_type(0) && imag_part(alpha) == real_type(0));
+
+                    real_type beta = real_type(0);
+                    value_type tau_jj = value_type();
+
+                    if (reflect)
+                    {
+                        beta = square_root(abs_squared(alpha) + xnorm2);
+                        if (real_part(alpha) >= real_type(0))
+                            beta = -beta;
+
+                        tau_jj = (value_type(beta) - alpha) * value_type(real_type(1) / beta);
+
+                        const value_type scale = reciprocal(alpha - value_type(beta));
+
+                        for (int i = jj + 1 + tid; i < m; i += tile_size)
+                            batch_element(a, n, b, i, jj) = batch_element(a, n, b, i, jj) * scale;
+                    }
+
+                    if (tid == 0)
+                    {
+                        tau(b,jj) = tau_jj;
+
+                        if (reflect)
+                            batch_element(a, n, b, jj, jj) = value_type(beta);
+                    }
+
+                    tidx.barrier.wait_with_global_memory_fence();
+
+                    // apply H(jj)' to a(jj:m,jj+1:n), a column per thread
+                    if (reflect)
+                    {
+                        for (int c = jj + 1 + tid; c < n; c += tile_size)
+                        {
+                            // w = v' * a(:,c) where v(jj) = 1
+                            value_type w = batch_element(a, n, b, jj, c);
+
+                            for (int i = jj + 1; i < m; i++)
+                                w += conjugate(batch_element(a, n, b, i, jj)) * batch_element(a, n, b, i, c);
+
+                            const value_type f = conjugate(tau_jj) * w;
+
+                            batch_element(a, n, b, jj, c) -= f;
+
+                            for (int i = jj + 1; i < m; i++)
+                                batch_element(a, n, b, i, c) -= batch_element(a, n, b, i, jj) * f;
+                        }
+                    }
+
+                    tidx.barrier.wait_with_global_memory_fence();
+                }
+            }
+        }
+    );
+}
+
+} // namespace accl
+
+// this is a work around until VS std::bind can accept more paramaters
+template <typename value_type>
+struct getrf_batched_params
+{
+    int m;
+    int n;
+    value_type** a_array;
+    int lda;
+    int** ipiv_array;
+    int* info_array;
+    int batch_count;
+
+    getrf_batched_params(int m, int n, value_type** a_array, int lda, int** ipiv_array, int* info_array, int batch_count)
+        : m(m), n(n), a_array(a_array), lda(lda), ipiv_array(ipiv_array), info_array(info_array), batch_count(batch_count)
+    {}
+};
+
+template <typename value_type>
+struct getrf_strided_batched_params
+{
+    int m;
+    int n;
+    value_type* a;
+    int lda;
+    int stride_a;
+    int* ipiv;
+    int stride_ipiv;
+    int* info_array;
+    int batch_count;
+
+    getrf_strided_batched_params(int m, int n, value_type* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count)
+        : m(m), n(n), a(a), lda(lda), stride_a(stride_a), ipiv(ipiv), stride_ipiv(stride_ipiv), info_array(info_array), batch_count(batch_count)
+    {}
+};
+
+template <typename value_type>
+struct potrf_batched_params
+{
+    char uplo;
+    int n;
+    value_type** a_array;
+    int lda;
+    int* info_array;
+    int batch_count;
+
+    potrf_batched_params(char uplo, int n, value_type** a_array, int lda, int* info_array, int batch_count)
+        : uplo(uplo), n(n), a_array(a_array), lda(lda), info_array(info_array), batch_count(batch_count)
+    {}
+};
+
+template <typename value_type>
+struct potrf_strided_batched_params
+{
+    char uplo;
+    int n;
+    value_type* a;
+    int lda;
+    int stride_a;
+    int* info_array;
+    int batch_count;
+
+    potrf_strided_batched_params(char uplo, int n, value_type* a, int lda, int stride_a, int* info_array, int batch_count)
+        : uplo(uplo), n(n), a(a), lda(lda), stride_a(stride_a), info_array(info_array), batch_count(batch_count)
+    {}
+};
+
+template <typename value_type>
+struct geqrf_batched_params
+{
+    int m;
+    int n;
+    value_type** a_array;
+    int lda;
+    value_type** tau_array;
+    int* info_array;
+    int batch_count;
+
+    geqrf_batched_params(int m, int n, value_type** a_array, int lda, value_type** tau_array, int* info_array, int batch_count)
+        : m(m), n(n), a_array(a_array), lda(lda), tau_array(tau_array), info_array(info_array), batch_count(batch_count)
+    {}
+};
+
+template <typename value_type>
+struct geqrf_strided_batched_params
+{
+    int m;
+    int n;
+    value_type* a;
+    int lda;
+    int stride_a;
+    value_type* tau;
+    int stride_tau;
+    int* info_array;
+    int batch_count;
+
+    geqrf_strided_batched_params(int m, int n, value_type* a, int lda, int stride_a, value_type* tau, int stride_tau, int* info_array, int batch_count)
+        : m(m), n(n), a(a), lda(lda), stride_a(stride_a), tau(tau), stride_tau(stride_tau), info_array(info_array), batch_count(batch_count)
+    {}
+};
+
+template <typename value_type>
+void getrf_batched_unpack(context& ctx, const getrf_batched_params<value_type>& p)
+{
+    amplapack::getrf_batched(ctx, p.m, p.n, p.a_array, p.lda, p.ipiv_array, p.info_array, p.batch_count);
+}
+
+template <typename value_type>
+void getrf_strided_batched_unpack(context& ctx, const getrf_strided_batched_params<value_type>& p)
+{
+    amplapack::getrf_strided_batched(ctx, p.m, p.n, p.a, p.lda, p.stride_a, p.ipiv, p.stride_ipiv, p.info_array, p.batch_count);
+}
+
+template <typename value_type>
+void potrf_batched_unpack(context& ctx, const potrf_batched_params<value_type>& p)
+{
+    amplapack::potrf_batched(ctx, p.uplo, p.n, p.a_array, p.lda, p.info_array, p.batch_count);
+}
+
+template <typename value_type>
+void potrf_strided_batched_unpack(context& ctx, const potrf_strided_batched_params<value_type>& p)
+{
+    amplapack::potrf_strided_batched(ctx, p.uplo, p.n, p.a, p.lda, p.stride_a, p.info_array, p.batch_count);
+}
+
+template <typename value_type>
+void geqrf_batched_unpack(context& ctx, const geqrf_batched_params<value_type>& p)
+{
+    amplapack::geqrf_batched(ctx, p.m, p.n, p.a_array, p.lda, p.tau_array, p.info_array, p.batch_count);
+}
+
+template <typename value_type>
+void geqrf_strided_batched_unpack(context& ctx, const geqrf_strided_batched_params<value_type>& p)
+{
+    amplapack::geqrf_strided_batched(ctx, p.m, p.n, p.a, p.lda, p.stride_a, p.tau, p.stride_tau, p.info_array, p.batch_count);
+}
+
+// pointers to the matrices of a strided batch
+template <typename T>
+std::vector<T*> make_pointer_array(T* base, int stride, int batch_count)
+{
+    std::vector<T*> pointers(batch_count);
+
+    for (int b = 0; b < batch_count; b++)
+        pointers[b] = base + static_cast<size_t>(b)*stride;
+
+    return pointers;
+}
+
+} // namespace _detail
+
+//
+// Host Interface Functions
+//
+// Every matrix of a batch has the same size and leading dimension. The status reflects only
+// argument errors; the outcome of each factorization is returned in info_array with the 
+// meaning info has for the corresponding single matrix routine.
+//
+
+template <typename value_type>
+void getrf_batched(context& ctx, int m, int n, value_type** a_array, int lda, int** ipiv_array, int* info_array, int batch_count)
+{
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a_array == nullptr)
+        argument_error(4);
+    if (lda < std::max(1,m))
+        argument_error(5);
+    if (ipiv_array == nullptr)
+        argument_error(6);
+    if (info_array == nullptr)
+        argument_error(7);
+    if (batch_count < 0)
+        argument_error(8);
+
+    for (int b = 0; b < batch_count; b++)
+    {
+        if (a_array[b] == nullptr)
+            argument_error(4);
+        if (ipiv_array[b] == nullptr)
+            argument_error(6);
+    }
+
+    // quick return
+    std::fill(info_array, info_array + batch_count, 0);
+
+    if (batch_count == 0 || m == 0 || n == 0)
+        return;
+
+    _detail::batch_matrix<value_type> a(ctx, m, n, a_array, lda, batch_count);
+
+    pooled_array<int> ipiv(ctx.get_pool(), concurrency::extent<2>(batch_count, std::min(m,n)));
+    pooled_array<int> info(ctx.get_pool(), concurrency::extent<2>(batch_count, 1));
+
+    _detail::accl::getf2_batched(ctx.get_view(), n, a.get_view(), ipiv.get_view(), info.get_view());
+
+    a.download();
+    _detail::scatter_rows(ctx, ipiv.get_view(), ipiv_array);
+    _detail::scatter_info(ctx, info.get_view(), info_array);
+}
+
+template <typename value_type>
+void getrf_strided_batched(context& ctx, int m, int n, value_type* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count)
+{
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < std::max(1,m))
+        argument_error(5);
+    if (stride_a < lda*n)
+        argument_error(6);
+    if (ipiv == nullptr)
+        argument_error(7);
+    if (stride_ipiv < std::min(m,n))
+        argument_error(8);
+    if (info_array == nullptr)
+        argument_error(9);
+    if (batch_count < 0)
+        argument_error(10);
+
+    std::vector<value_type*> a_array = _detail::make_pointer_array(a, stride_a, batch_count);
+    std::vector<int*> ipiv_array = _detail::make_pointer_array(ipiv, stride_ipiv, batch_count);
+
+    getrf_batched(ctx, m, n, a_array.data(), lda, ipiv_array.data(), info_array, batch_count);
+}
+
+template <typename value_type>
+void potrf_batched(context& ctx, char uplo, int n, value_type** a_array, int lda, int* info_array, int batch_count)
+{
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a_array == nullptr)
+        argument_error(4);
+    if (lda < std::max(1,n))
+        argument_error(5);
+    if (info_array == nullptr)
+        argument_error(6);
+    if (batch_count < 0)
+        argument_error(7);
+
+    for (int b = 0; b < batch_count; b++)
+    {
+        if (a_array[b] == nullptr)
+            argument_error(4);
+    }
+
+    // quick return
+    std::fill(info_array, info_array + batch_count, 0);
+
+    if (batch_count == 0 || n == 0)
+        return;
+
+    _detail::batch_matrix<value_type> a(ctx, n, n, a_array, lda, batch_count);
+
+    pooled_array<int> info(ctx.get_pool(), concurrency::extent<2>(batch_count, 1));
+
+    _detail::accl::potf2_batched(ctx.get_view(), to_option(uplo), n, a.get_view(), info.get_view());
+
+    a.download();
+    _detail::scatter_info(ctx, info.get_view(), info_array);
+}
+
+template <typename value_type>
+void potrf_strided_batched(context& ctx, char uplo, int n, value_type* a, int lda, int stride_a, int* info_array, int batch_count)
+{
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < std::max(1,n))
+        argument_error(5);
+    if (stride_a < lda*n)
+        argument_error(6);
+    if (info_array == nullptr)
+        argument_error(7);
+    if (batch_count < 0)
+        argument_error(8);
+
+    std::vector<value_type*> a_array = _detail::make_pointer_array(a, stride_a, batch_count);
+
+    potrf_batched(ctx, uplo, n, a_array.data(), lda, info_array, batch_count);
+}
+
+template <typename value_type>
+void geqrf_batched(context& ctx, int m, int n, value_type** a_array, int lda, value_type** tau_array, int* info_array, int batch_count)
+{
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a_array == nullptr)
+        argument_error(4);
+    if (lda < std::max(1,m))
+        argument_error(5);
+    if (tau_array == nullptr)
+        argument_error(6);
+    if (info_array == nullptr)
+        argument_error(7);
+    if (batch_count < 0)
+        argument_error(8);
+
+    for (int b = 0; b < batch_count; b++)
+    {
+        if (a_array[b] == nullptr)
+            argument_error(4);
+        if (tau_array[b] == nullptr)
+            argument_error(6);
+    }
+
+    // quick return
+    std::fill(info_array, info_array + batch_count, 0);
+
+    if (batch_count == 0 || m == 0 || n == 0)
+        return;
+
+    _detail::batch_matrix<value_type> a(ctx, m, n, a_array, lda, batch_count);
+
+    pooled_array<value_type> tau(ctx.get_pool(), concurrency::extent<2>(batch_count, std::min(m,n)));
+
+    _detail::accl::geqr2_batched(ctx.get_view(), n, a.get_view(), tau.get_view());
+
+    a.download();
+    _detail::scatter_rows(ctx, tau.get_view(), tau_array);
+}
+
+template <typename value_type>
+void geqrf_strided_batched(context& ctx, int m, int n, value_type* a, int lda, int stride_a, value_type* tau, int stride_tau, int* info_array, int batch_count)
+{
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < std::max(1,m))
+        argument_error(5);
+    if (stride_a < lda*n)
+        argument_error(6);
+    if (tau == nullptr)
+        argument_error(7);
+    if (stride_tau < std::min(m,n))
+        argument_error(8);
+    if (info_array == nullptr)
+        argument_error(9);
+    if (batch_count < 0)
+        argument_error(10);
+
+    std::vector<value_type*> a_array = _detail::make_pointer_array(a, stride_a, batch_count);
+    std::vector<value_type*> tau_array = _detail::make_pointer_array(tau, stride_tau, batch_count);
+
+    geqrf_batched(ctx, m, n, a_array.data(), lda, tau_array.data(), info_array, batch_count);
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_BATCHED_H
@@ -1,421 +1,1475 @@
-/*----------------------------------------------------------------------------
- * Copyright  Microsoft Corp.
- *
- * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
- * use this file except in compliance with the License.  You may obtain a copy 
- * of the License at http://www.apache.org/licenses/LICENSE-2.0  
- * 
- * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
- * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
- * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
- * MERCHANTABLITY OR NON-INFRINGEMENT. 
- *
- * See the Apache Version 2.0 License for specific language governing 
- * permissions and limitations under the License.
- *---------------------------------------------------------------------------
- * 
- * geqrf.h
- *
- *---------------------------------------------------------------------------*/
-
-#ifndef AMPLAPACK_GEQRF_H
-#define AMPLAPACK_GEQRF_H
-
-#include "amplapack_config.h"
-
-// external lapack functions
-namespace amplapack {
-namespace _detail {
-
-//
-// External LAPACK Wrappers
-// 
-
-namespace lapack {
-
-template <typename value_type>
-void geqrf(int m, int n, value_type* a, int lda, value_type* tau, int& info);
-
-template <>
-void geqrf<float>(int m, int n, float* a, int lda, float* tau, int& info)
-{ 
-    // work query
-    int lwork = -1;
-    float work_size;
-    LAPACK_SGEQRF(&m, &n, a, &lda, tau, &work_size, &lwork, &info);
-    lwork = int(work_size);
-    std::vector<float> work(lwork);
-
-    LAPACK_SGEQRF(&m, &n, a, &lda, tau, work.data(), &lwork, &info); 
-}
-
-template <>
-void geqrf<double>(int m, int n, double* a, int lda, double* tau, int& info)
-{ 
-    // work query
-    int lwork = -1;
-    double work_size;
-    LAPACK_DGEQRF(&m, &n, a, &lda, tau, &work_size, &lwork, &info);
-    lwork = int(work_size);
-    std::vector<double> work(lwork);
-
-    LAPACK_DGEQRF(&m, &n, a, &lda, tau, work.data(), &lwork, &info); 
-}
-
-// template <>
-void geqrf(int m, int n, ampblas::complex<float>* a, int lda, ampblas::complex<float>* tau, int& info)
-{
-    // work query
-    int lwork = -1;
-    ampblas::complex<float> work_size;
-    LAPACK_CGEQRF(&m, &n, a, &lda, tau, &work_size, &lwork, &info);
-    lwork = int(work_size.real());
-    std::vector<ampblas::complex<float>> work(lwork);
-
-    LAPACK_CGEQRF(&m, &n, a, &lda, tau, work.data(), &lwork, &info);
-}
-
-// template <>
-void geqrf(int m, int n, ampblas::complex<double>* a, int lda, ampblas::complex<double>* tau, int& info)
-{
-    // work query
-    int lwork = -1;
-    ampblas::complex<double> work_size;
-    LAPACK_ZGEQRF(&m, &n, a, &lda, tau, &work_size, &lwork, &info);
-    lwork = int(work_size.real());
-    std::vector<ampblas::complex<double>> work(lwork);
-
-    LAPACK_ZGEQRF(&m, &n, a, &lda, tau, work.data(), &lwork, &info);
-}
-
-template <typename value_type>
-void larft(char direct, char storev, int n, int k, value_type* v, int ldv, value_type* tau, value_type* t, int ldt);
-
-template <>
-void larft(char direct, char storev, int n, int k, float* v, int ldv, float* tau, float* t, int ldt)
-{
-    LAPACK_SLARFT(&direct, &storev, &n, &k, v, &ldv, tau, t, &ldt);
-}
-
-template <>
-void larft(char direct, char storev, int n, int k, double* v, int ldv, double* tau, double* t, int ldt)
-{
-    LAPACK_DLARFT(&direct, &storev, &n, &k, v, &ldv, tau, t, &ldt);
-}
-
-template <>
-void larft(char direct, char storev, int n, int k, ampblas::complex<float>* v, int ldv, ampblas::complex<float>* tau, ampblas::complex<float>* t, int ldt)
-{
-    LAPACK_CLARFT(&direct, &storev, &n, &k, v, &ldv, tau, t, &ldt);
-}
-
-template <>
-void larft(char direct, char storev, int n, int k, ampblas::complex<double>* v, int ldv,  ampblas::complex<double>* tau,  ampblas::complex<double>* t, int ldt)
-{
-    LAPACK_ZLARFT(&direct, &storev, &n, &k, v, &ldv, tau, t, &ldt);
-}
-
-} // namespace lapack
-
-//
-// Host Wrapper
-//
-
-namespace host {
-
-template <enum class ordering storage_type, typename value_type>
-void geqrf(const concurrency::accelerator_view& /*av*/, concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,1>& tau)
-{
-    static_assert(storage_type == ordering::column_major, "hybrid functionality requires column major ordering");
-
-    const int m = get_rows<storage_type>(a);
-    const int n = get_cols<storage_type>(a);
-   
-    // TODO: take from a pool
-    const int lda = get_leading_dimension<storage_type>(a);
-    std::vector<value_type> host_a(lda*n);
-
-    // copy from acclerator to host
-    concurrency::copy(a, host_a.begin());
-
-    // run host function
-    int info = 0;
-    lapack::geqrf(m, n, host_a.data(), lda, tau.data(), info);
-
-    // check for errors
-    info_check(info);
-
-    // copy from host to accelerator
-    // requires -D_SCL_SECURE_NO_WARNINGS
-    concurrency::copy(host_a.begin(), host_a.end(), a);
-}
-
-template <enum class ordering storage_type, typename value_type>
-void larft(const concurrency::accelerator_view& /*av*/, enum class direction /*direct*/, enum class storage storev, concurrency::array_view<value_type,2>& v, concurrency::array_view<value_type,1>& tau, concurrency::array_view<value_type,2>& t)
-{
-    static_assert(storage_type == ordering::column_major, "hybrid functionality requires column major ordering");
-
-    const int n = (storev == storage::column ? get_rows<storage_type>(v) : get_cols<storage_type>(v));
-    const int k = (storev == storage::column ? get_cols<storage_type>(v) : get_rows<storage_type>(v));
-
-    // host v
-    const int ldv = n;
-    std::vector<value_type> host_v(ldv*k);
-    concurrency::copy(v, host_v.begin());
-
-    // host t
-    const int ldt = k;
-    std::vector<value_type> host_t(ldt*k);
-    concurrency::copy(t, host_t.begin());
-
-    // run host function
-    lapack::larft('f', 'c', n, k, host_v.data(), ldv, tau.data(), host_t.data(), ldt);
-
-    // copy from host to accelerator
-    // requires -D_SCL_SECURE_NO_WARNINGS
-    concurrency::copy(host_t.begin(), host_t.end(), t);
-}
-
-} // namespace host
-
-//
-// Accelerator Helper Functions
-//
-
-template <enum class ordering storage_type, typename value_type>
-void make_unit_lower(const concurrency::accelerator_view& av, concurrency::array_view<value_type,2>& a)
-{
-    concurrency::parallel_for_each(av, a.extent, [=] (concurrency::index<2> idx) restrict(amp) 
-    {
-        // TODO: this is only column major
-        unsigned int i = idx[1];
-        unsigned int j = idx[0];
-
-        if (i < j)
-        {
-            a[idx] = value_type();
-        }
-        else if (i == j)
-        {
-            a[idx] = value_type(1);
-        }
-    });
-}
-
-//
-// Blocked Factorization
-//
-
-template <int block_size, int look_ahead_depth, enum class ordering storage_type, enum class block_factor_location location, typename value_type>
-void geqrf(const concurrency::accelerator_view& av, concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,1>& tau)
-{
-    using concurrency::array;
-    using concurrency::array_view;
-    using concurrency::index;
-    using concurrency::extent;
-    
-    // sizes
-    const int m = get_rows<storage_type>(a);
-    const int n = get_cols<storage_type>(a);
-    const int k = std::min(m,n);
-
-    // working array for v1 storage (accelerator)
-    // TODO: not needed for host-only interface
-    array<value_type,2> array_v1(block_size, block_size);
-    array_view<value_type,2> v1(array_v1);
-
-    // working array for triangular factor (accelerator)
-    array<value_type,2> array_t(block_size, block_size);
-    array_view<value_type,2> t(array_t);
-
-    // working array for w (accelerator)
-    // TODO: this is only column major
-    array<value_type,2> array_w(n, block_size);
-    array_view<value_type,2> w(array_w);
-
-    // working array for w_t (accelerator)
-    // TODO: this is only column major
-    array<value_type,2> array_wt(block_size, m);
-    array_view<value_type,2> wt(array_wt);
-
-    // panel stepping
-    for (int i = 0; i < k; i += block_size)
-    {
-        // current panel size
-        const int ib = std::min(k-i, block_size);
-
-        // panel factorization
-        {
-            int m_ = m-i;
-            int n_ = ib;
-
-            array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(i,i), extent<2>(m_,n_)); 
-            array_view<value_type,1> tau_sub = tau.section(index<1>(i)); 
-
-            host::geqrf<storage_type>(av, a_sub, tau_sub);
-        }
-
-        // apply to rest of matrix (no look ahead yet)
-        if (i+ib < n)
-        {
-            //
-            // A2 = Q' * A2 = (I - V * T' * V') * A2
-            //
-
-            // form the triangular factor (t) of the block reflector
-            {
-                int m_ = m-i;
-                int n_ = ib;
-
-                array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(i,i), extent<2>(m_,n_));
-                array_view<value_type,1> tau_sub = tau.section(index<1>(i));
-                array_view<value_type,2> t_sub = t.section(index<2>(0,0), extent<2>(ib,ib));
-                                
-                host::larft<storage_type>(av, direction::forward, storage::column, a_sub, tau_sub, t_sub);
-            }
-
-            // backup v1 (not needed for host-only interface)
-            {
-                array_view<value_type,2> a_sub = a.section(index<2>(i,i), extent<2>(ib,ib));
-                array_view<value_type,2> v1_sub = v1.section(index<2>(0,0), extent<2>(ib,ib));
-
-                concurrency::copy(a_sub, v1_sub);
-            }
-
-            // make v unit-lower
-            {
-                array_view<value_type,2> a_sub = a.section(index<2>(i,i), extent<2>(ib,ib));
-                make_unit_lower<storage_type>(av, a_sub);
-            }
-
-            // w = t' * v' <==> w' = v * t 
-            {
-                int m_ = m-i;
-                int n_ = ib;
-                int k_ = ib;
-
-                array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(i,i), extent<2>(m_,k_));
-                array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(t, index<2>(0,0), extent<2>(k_,n_));
-                array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(wt, index<2>(0,0), extent<2>(m_,n_));
-
-                ampblas::link::gemm(av, ampblas::transpose::no_trans, ampblas::transpose::no_trans, value_type(1), a_sub, b_sub, value_type(), c_sub);
-            }
-
-            // w = w' * a2
-            {
-                int m_ = ib;
-                int n_ = n-i-ib;
-                int k_ = m-i;
-
-                array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(wt, index<2>(0,0), extent<2>(k_,m_));
-                array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(i,i+ib), extent<2>(k_,n_));
-                array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(w, index<2>(0,0), extent<2>(m_,n_));
-
-                ampblas::link::gemm(av, ampblas::transpose::conj_trans, ampblas::transpose::no_trans, value_type(1), a_sub, b_sub, value_type(), c_sub);
-            }
-
-            // a2 -= v * w
-            {
-                int m_ = m-i;
-                int n_ = n-i-ib;
-                int k_ = ib;
-
-                array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(i,i), extent<2>(m_,k_));
-                array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(w, index<2>(0,0), extent<2>(k_,n_));
-                array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a, index<2>(i,i+ib), extent<2>(m_,n_));
-
-                ampblas::link::gemm(av, ampblas::transpose::no_trans, ampblas::transpose::no_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
-            }
-
-            // restore v1 (not needed for host-only interface)
-            {
-                array_view<value_type,2> a_sub = a.section(index<2>(i,i), extent<2>(ib,ib));
-                array_view<value_type,2> v1_sub = v1.section(index<2>(0,0), extent<2>(ib,ib));
-
-                concurrency::copy(v1_sub, a_sub);
-            }
-        }
-    }
-}
-
-// this is a work around until VS std::bind can accept more paramaters
-template <typename value_type>
-struct geqrf_params
-{
-    int m;
-    int n; 
-    value_type* a; 
-    int lda; 
-    value_type* tau;
-
-    geqrf_params(int m, int n, value_type* a, int lda, value_type* tau)
-        : m(m), n(n), a(a), lda(lda), tau(tau) 
-    {}
-};
-
-template <typename value_type>
-void geqrf_unpack(concurrency::accelerator_view& av, const geqrf_params<value_type>& p)
-{
-    amplapack::geqrf(av, p.m, p.n, p.a, p.lda, p.tau); 
-}
-
-} // namespace _detail
-
-//
-// Array View Interface
-//
-
-template <enum class ordering storage_type, typename value_type>
-void geqrf(const concurrency::accelerator_view& av, concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,1>& tau)
-{
-    // TODO: a tuning framework
-    const int block_size = 256;
-    const int look_ahead_depth = 1;
-
-    _detail::geqrf<block_size, look_ahead_depth, storage_type, block_factor_location::host>(av, a, tau);
-}
-
-//
-// Host Interface Function
-//
-
-template <typename value_type>
-void geqrf(concurrency::accelerator_view& av, int m, int n, value_type* a, int lda, value_type* tau)
-{
-    // quick return
-    if (n == 0 || m == 0)
-        return;
-
-    // error checking
-    if (m < 0)
-        argument_error(2);
-    if (n < 0)
-        argument_error(3);
-    if (a == nullptr)
-        argument_error(4);
-    if (lda < m)
-        argument_error(5);
-    if (tau == nullptr)
-        argument_error(6);
-
-    // host views
-    concurrency::array_view<value_type,2> host_view_a(n, lda, a);
-    concurrency::array_view<value_type,2> host_view_a_sub = host_view_a.section(concurrency::index<2>(0,0), concurrency::extent<2>(n,m));
-    concurrency::array_view<value_type,1> host_view_tau(std::min(m,n), tau);
-
-    // accelerator array (allocation and copy)
-    concurrency::array<value_type,2> accl_a(host_view_a_sub);
-
-    // accelerator view
-    concurrency::array_view<value_type,2> accl_view_a(accl_a);
-
-    // foward to array view interface
-    geqrf<ordering::column_major>(av, accl_view_a, host_view_tau);
-
-    // copy back to host
-    concurrency::copy(accl_view_a, host_view_a_sub);
-}
-
-} // namespace amplapack
-
-#endif // AMPLAPACK_GEQRF_H
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * geqrf.h
+ *
+ *---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_GEQRF_H
+#define AMPLAPACK_GEQRF_H
+
+#include "amplapack_config.h"
+#include "layout.h"
+
+// external lapack functions
+namespace amplapack {
+namespace _detail {
+
+//
+// External LAPACK Wrappers
+// 
+
+namespace lapack {
+
+template <typename value_type>
+void geqrf(int m, int n, value_type* a, int lda, value_type* tau, int& info);
+
+template <>
+inline void geqrf<float>(int m, int n, float* a, int lda, float* tau, int& info)
+{ 
+    // work query
+    int lwork = -1;
+    float work_size;
+    LAPACK_SGEQRF(&m, &n, a, &lda, tau, &work_size, &lwork, &info);
+    lwork = int(work_size);
+    std::vector<float> work(lwork);
+
+    LAPACK_SGEQRF(&m, &n, a, &lda, tau, work.data(), &lwork, &info); 
+}
+
+template <>
+inline void geqrf<double>(int m, int n, double* a, int lda, double* tau, int& info)
+{ 
+    // work query
+    int lwork = -1;
+    double work_size;
+    LAPACK_DGEQRF(&m, &n, a, &lda, tau, &work_size, &lwork, &info);
+    lwork = int(work_size);
+    std::vector<double> work(lwork);
+
+    LAPACK_DGEQRF(&m, &n, a, &lda, tau, work.data(), &lwork, &info); 
+}
+
+// template <>
+inline void geqrf(int m, int n, ampblas::complex<float>* a, int lda, ampblas::complex<float>* tau, int& info)
+{
+    // work query
+    int lwork = -1;
+    ampblas::complex<float> work_size;
+    LAPACK_CGEQRF(&m, &n, a, &lda, tau, &work_size, &lwork, &info);
+    lwork = int(work_size.real());
+    std::vector<ampblas::complex<float>> work(lwork);
+
+    LAPACK_CGEQRF(&m, &n, a, &lda, tau, work.data(), &lwork, &info);
+}
+
+// template <>
+inline void geqrf(int m, int n, ampblas::complex<double>* a, int lda, ampblas::complex<double>* tau, int& info)
+{
+    // work query
+    int lwork = -1;
+    ampblas::complex<double> work_size;
+    LAPACK_ZGEQRF(&m, &n, a, &lda, tau, &work_size, &lwork, &info);
+    lwork = int(work_size.real());
+    std::vector<ampblas::complex<double>> work(lwork);
+
+    LAPACK_ZGEQRF(&m, &n, a, &lda, tau, work.data(), &lwork, &info);
+}
+
+template <typename value_type>
+void larft(char direct, char storev, int n, int k, value_type* v, int ldv, value_type* tau, value_type* t, int ldt);
+
+template <>
+inline void larft(char direct, char storev, int n, int k, float* v, int ldv, float* tau, float* t, int ldt)
+{
+    LAPACK_SLARFT(&direct, &storev, &n, &k, v, &ldv, tau, t, &ldt);
+}
+
+template <>
+inline void larft(char direct, char storev, int n, int k, double* v, int ldv, double* tau, double* t, int ldt)
+{
+    LAPACK_DLARFT(&direct, &storev, &n, &k, v, &ldv, tau, t, &ldt);
+}
+
+template <>
+inline void larft(char direct, char storev, int n, int k, ampblas::complex<float>* v, int ldv, ampblas::complex<float>* tau, ampblas::complex<float>* t, int ldt)
+{
+    LAPACK_CLARFT(&direct, &storev, &n, &k, v, &ldv, tau, t, &ldt);
+}
+
+template <>
+inline void larft(char direct, char storev, int n, int k, ampblas::complex<double>* v, int ldv,  ampblas::complex<double>* tau,  ampblas::complex<double>* t, int ldt)
+{
+    LAPACK_ZLARFT(&direct, &storev, &n, &k, v, &ldv, tau, t, &ldt);
+}
+
+template <typename value_type>
+void ormqr(char side, char trans, int m, int n, int k, const value_type* a, int lda, const value_type* tau, value_type* c, int ldc, int& info);
+
+template <>
+inline void ormqr(char side, char trans, int m, int n, int k, const float* a, int lda, const float* tau, float* c, int ldc, int& info)
+{
+    // work query
+    int lwork = -1;
+    float work_size;
+    LAPACK_SORMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, &work_size, &lwork, &info);
+    lwork = int(work_size);
+    std::vector<float> work(lwork);
+
+    LAPACK_SORMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, work.data(), &lwork, &info);
+}
+
+template <>
+inline void ormqr(char side, char trans, int m, int n, int k, const double* a, int lda, const double* tau, double* c, int ldc, int& info)
+{
+    // work query
+    int lwork = -1;
+    double work_size;
+    LAPACK_DORMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, &work_size, &lwork, &info);
+    lwork = int(work_size);
+    std::vector<double> work(lwork);
+
+    LAPACK_DORMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, work.data(), &lwork, &info);
+}
+
+template <>
+inline void ormqr(char side, char trans, int m, int n, int k, const ampblas::complex<float>* a, int lda, const ampblas::complex<float>* tau, ampblas::complex<float>* c, int ldc, int& info)
+{
+    // work query
+    int lwork = -1;
+    ampblas::complex<float> work_size;
+    LAPACK_CUNMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, &work_size, &lwork, &info);
+    lwork = int(work_size.real());
+    std::vector<ampblas::complex<float>> work(lwork);
+
+    LAPACK_CUNMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, work.data(), &lwork, &info);
+}
+
+template <>
+inline void ormqr(char side, char trans, int m, int n, int k, const ampblas::complex<double>* a, int lda, const ampblas::complex<double>* tau, ampblas::complex<double>* c, int ldc, int& info)
+{
+    // work query
+    int lwork = -1;
+    ampblas::complex<double> work_size;
+    LAPACK_ZUNMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, &work_size, &lwork, &info);
+    lwork = int(work_size.real());
+    std::vector<ampblas::complex<double>> work(lwork);
+
+    LAPACK_ZUNMQR(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, work.data(), &lwork, &info);
+}
+
+template <typename value_type>
+void orgqr(int m, int n, int k, value_type* a, int lda, const value_type* tau, int& info);
+
+template <>
+inline void orgqr(int m, int n, int k, float* a, int lda, const float* tau, int& info)
+{
+    // work query
+    int lwork = -1;
+    float work_size;
+    LAPACK_SORGQR(&m, &n, &k, a, &lda, tau, &work_size, &lwork, &info);
+    lwork = int(work_size);
+    std::vector<float> work(lwork);
+
+    LAPACK_SORGQR(&m, &n, &k, a, &lda, tau, work.data(), &lwork, &info);
+}
+
+template <>
+inline void orgqr(int m, int n, int k, double* a, int lda, const double* tau, int& info)
+{
+    // work query
+    int lwork = -1;
+    double work_size;
+    LAPACK_DORGQR(&m, &n, &k, a, &lda, tau, &work_size, &lwork, &info);
+    lwork = int(work_size);
+    std::vector<double> work(lwork);
+
+    LAPACK_DORGQR(&m, &n, &k, a, &lda, tau, work.data(), &lwork, &info);
+}
+
+template <>
+inline void orgqr(int m, int n, int k, ampblas::complex<float>* a, int lda, const ampblas::complex<float>* tau, int& info)
+{
+    // work query
+    int lwork = -1;
+    ampblas::complex<float> work_size;
+    LAPACK_CUNGQR(&m, &n, &k, a, &lda, tau, &work_size, &lwork, &info);
+    lwork = int(work_size.real());
+    std::vector<ampblas::complex<float>> work(lwork);
+
+    LAPACK_CUNGQR(&m, &n, &k, a, &lda, tau, work.data(), &lwork, &info);
+}
+
+template <>
+inline void orgqr(int m, int n, int k, ampblas::complex<double>* a, int lda, const ampblas::complex<double>* tau, int& info)
+{
+    // work query
+    int lwork = -1;
+    ampblas::complex<double> work_size;
+    LAPACK_ZUNGQR(&m, &n, &k, a, &lda, tau, &work_size, &lwork, &info);
+    lwork = int(work_size.real());
+    std::vector<ampblas::complex<double>> work(lwork);
+
+    LAPACK_ZUNGQR(&m, &n, &k, a, &lda, tau, work.data(), &lwork, &info);
+}
+
+} // namespace lapack
+
+//
+// Host Wrapper
+//
+
+namespace host {
+
+template <enum class ordering storage_type, typename value_type>
+void geqrf(host_panel<value_type>& panel, concurrency::array_view<value_type,1>& tau)
+{
+    const int m = get_rows<storage_type>(panel.get_view());
+    const int n = get_cols<storage_type>(panel.get_view());
+
+    // run host function (waits for the panel to arrive)
+    column_major_panel<storage_type, value_type> host_a(panel);
+
+    int info = 0;
+    lapack::geqrf(m, n, host_a.data(), host_a.leading_dimension(), tau.data(), info);
+    host_a.store();
+
+    // check for errors
+    info_check(info);
+
+    // copy from host to accelerator
+    panel.upload();
+}
+
+template <enum class ordering storage_type, typename value_type>
+void geqrf(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,1>& tau)
+{
+    // copy from acclerator to page-locked host memory
+    host_panel<value_type> panel(ctx.get_staging_pool(), a);
+
+    geqrf<storage_type>(panel, tau);
+}
+
+// forms the triangular factor (t) of a panel that was just factored on the host without 
+// moving v again; also uploads the unit lower triangular top block of v (v1)
+template <enum class ordering storage_type, typename value_type>
+void larft(context& ctx, host_panel<value_type>& panel, concurrency::array_view<value_type,1>& tau, concurrency::array_view<value_type,2>& t, concurrency::array_view<value_type,2>& v1)
+{
+    const int n = get_rows<storage_type>(panel.get_view());
+    const int k = get_cols<storage_type>(panel.get_view());
+
+    column_major_panel<storage_type, value_type> host_v(panel);
+    const int ldv = host_v.leading_dimension();
+    const value_type* v = host_v.data();
+
+    // host t (output only; larft leaves the strictly lower triangle untouched so start from zero)
+    const int ldt = k;
+    staging_array<value_type> host_t(ctx.get_staging_pool(), t.extent);
+    std::fill(host_t.data(), host_t.data() + ldt*k, value_type());
+
+    // run host function
+    lapack::larft('f', 'c', n, k, host_v.data(), ldv, tau.data(), host_t.data(), ldt);
+    to_ordering<storage_type>(host_t.data(), k);
+
+    // host v1
+    staging_array<value_type> host_v1(ctx.get_staging_pool(), v1.extent);
+    value_type* v1_ptr = host_v1.data();
+
+    for (int j = 0; j < k; j++)
+        for (int i = 0; i < k; i++)
+            v1_ptr[j*k+i] = (i < j ? value_type() : (i == j ? value_type(1) : v[j*ldv+i]));
+
+    to_ordering<storage_type>(v1_ptr, k);
+
+    // copy from host to accelerator
+    concurrency::copy(host_t.get_view(), t);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(t.extent));
+    concurrency::copy(host_v1.get_view(), v1);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(v1.extent));
+}
+
+} // namespace host
+
+//
+// Accelerator Helper Functions
+//
+
+template <typename value_type>
+void fill(const concurrency::accelerator_view& av, const concurrency::array_view<value_type,2>& a, const value_type& value)
+{
+    concurrency::parallel_for_each(av, a.extent, [=] (concurrency::index<2> idx) restrict(amp) 
+    {
+        a[idx] = value;
+    });
+}
+
+//
+// Accelerator Panel Factorization
+//
+
+namespace accl {
+
+// unblocked Householder QR of an m by n panel (n <= m) in place on the accelerator
+//
+// Each column takes two kernels. A single tile forms the reflector (as LAPACK's larfg does,
+// but without rescaling the norm), then one tile per remaining column reduces v' * a(:,c)
+// and applies H' to that column.
+template <enum class ordering storage_type, typename value_type>
+void geqr2(const concurrency::accelerator_view& av, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,1>& tau)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    using concurrency::index;
+    using concurrency::extent;
+
+    static const int tile_size = 256;
+
+    const int m = get_rows<storage_type>(a);
+    const int n = get_cols<storage_type>(a);
+
+    for (int jj = 0; jj < n; jj++)
+    {
+        // generate the elementary reflector H(jj)
+        concurrency::parallel_for_each(
+            av,
+            extent<1>(tile_size).tile<tile_size>(),
+            [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                tile_static real_type partial[tile_size];
+
+                const int tid = tidx.local[0];
+
+                // read before the diagonal is overwritten below
+                const value_type alpha = get_element<storage_type>(a, jj, jj);
+
+                // squared norm of x
+                real_type sum = real_type(0);
+
+                for (int i = jj + 1 + tid; i < m; i += tile_size)
+                    sum += abs_squared(get_element<storage_type>(a, i, jj));
+
+                partial[tid] = sum;
+                tidx.barrier.wait();
+
+                for (int stride = tile_size/2; stride > 0; stride /= 2)
+                {
+                    if (tid < stride)
+                        partial[tid] += partial[tid+stride];
+
+                    tidx.barrier.wait();
+                }
+
+                const real_type xnorm2 = partial[0];
+
+                // H = I
+                if (xnorm2 == real_type(0) && imag_part(alpha) == real_type(0))
+                {
+                    if (tid == 0)
+                        tau[index<1>(jj)] = value_type();
+
+                    return;
+                }
+
+                real_type beta = square_root(abs_squared(alpha) + xnorm2);
+                if (real_part(alpha) >= real_type(0))
+                    beta = -beta;
+
+                const value_type scale = reciprocal(alpha - value_type(beta));
+
+                for (int i = jj + 1 + tid; i < m; i += tile_size)
+                    get_element<storage_type>(a, i, jj) = get_element<storage_type>(a, i, jj) * scale;
+
+                if (tid == 0)
+                {
+                    tau[index<1>(jj)] = (value_type(beta) - alpha) * value_type(real_type(1) / beta);
+                    get_element<storage_type>(a, jj, jj) = value_type(beta);
+                }
+            }
+        );
+
+        // apply H(jj)' to a(jj:m,jj+1:n) from the left
+        if (jj+1 < n)
+        {
+            concurrency::parallel_for_each(
+                av,
+                extent<1>((n-jj-1)*tile_size).tile<tile_size>(),
+                [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp)
+                {
+                    tile_static real_type partial_re[tile_size];
+                    tile_static real_type partial_im[tile_size];
+
+                    const int tid = tidx.local[0];
+                    const int c = jj + 1 + tidx.tile[0];
+
+                    // w = v' * a(:,c) where v(jj) = 1
+                    value_type w = (tid == 0 ? get_element<storage_type>(a, jj, c) : value_type());
+
+                    for (int i = jj + 1 + tid; i < m; i += tile_size)
+                        w += conjugate(get_element<storage_type>(a, i, jj)) * get_element<storage_type>(a, i, c);
+
+                    partial_re[tid] = real_part(w);
+                    partial_im[tid] = imag_part(w);
+                    tidx.barrier.wait();
+
+                    for (int stride = tile_size/2; stride > 0; stride /= 2)
+                    {
+                        if (tid < stride)
+                        {
+                            partial_re[tid] += partial_re[tid+stride];
+                            partial_im[tid] += partial_im[tid+stride];
+                        }
+
+                        tidx.barrier.wait();
+                    }
+
+                    from_parts(w, partial_re[0], partial_im[0]);
+
+                    // a(:,c) -= conj(tau) * v * w
+                    const value_type f = conjugate(tau[index<1>(jj)]) * w;
+
+                    if (tid == 0)
+                        get_element<storage_type>(a, jj, c) -= f;
+
+                    for (int i = jj + 1 + tid; i < m; i += tile_size)
+                        get_element<storage_type>(a, i, c) -= get_element<storage_type>(a, i, jj) * f;
+                }
+            );
+        }
+    }
+}
+
+// forms the triangular factor (t) of the block reflector of a panel factored by geqr2 and the
+// unit lower triangular top block of v (v1); s is k by k scratch for v' * v
+template <enum class ordering storage_type, typename value_type>
+void larft(const concurrency::accelerator_view& av, const concurrency::array_view<value_type,2>& v, const concurrency::array_view<value_type,1>& tau, const concurrency::array_view<value_type,2>& t, const concurrency::array_view<value_type,2>& v1, const concurrency::array_view<value_type,2>& s)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    static const int tile_size = 256;
+
+    const int n = get_rows<storage_type>(v);
+    const int k = get_cols<storage_type>(v);
+
+    // v1
+    concurrency::parallel_for_each(av, extent<2>(k,k), [=] (index<2> idx) restrict(amp)
+    {
+        const int i = idx[0];
+        const int j = idx[1];
+
+        get_element<storage_type>(v1, i, j) = (i < j ? value_type() : (i == j ? value_type(1) : get_element<storage_type>(v, i, j)));
+    });
+
+    // s = v' * v (top block)
+    {
+        array_view<const value_type,2> a_sub = v1;
+        array_view<value_type,2> c_sub = s;
+        gemm<storage_type>(av, ampblas::transpose::conj_trans, ampblas::transpose::no_trans, value_type(1), a_sub, a_sub, value_type(), c_sub);
+    }
+
+    // s += v' * v (remaining rows)
+    if (k < n)
+    {
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(v, index<2>(k,0), extent<2>(n-k,k));
+        array_view<value_type,2> c_sub = s;
+        gemm<storage_type>(av, ampblas::transpose::conj_trans, ampblas::transpose::no_trans, value_type(1), a_sub, a_sub, value_type(1), c_sub);
+    }
+
+    // t(0:i,i) = -tau(i) * t(0:i,0:i) * s(0:i,i), one column at a time
+    concurrency::parallel_for_each(
+        av,
+        extent<1>(tile_size).tile<tile_size>(),
+        [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        {
+            const int tid = tidx.local[0];
+
+            for (int i = 0; i < k; i++)
+            {
+                const value_type tau_i = tau[index<1>(i)];
+
+                for (int j = tid; j < k; j += tile_size)
+                {
+                    if (j < i)
+                    {
+                        value_type sum = value_type();
+
+                        for (int l = j; l < i; l++)
+                            sum += get_element<storage_type>(t, j, l) * get_element<storage_type>(s, l, i);
+
+                        get_element<storage_type>(t, j, i) = -tau_i * sum;
+                    }
+                    else
+                    {
+                        get_element<storage_type>(t, j, i) = (j == i ? tau_i : value_type());
+                    }
+                }
+
+                tidx.barrier.wait_with_global_memory_fence();
+            }
+        }
+    );
+}
+
+} // namespace accl
+
+//
+// Blocked Factorization
+//
+
+// TODO: a tuning framework
+const int geqrf_block_size = 256;
+const int geqrf_look_ahead_depth = 1;
+
+template <int block_size, typename value_type>
+void geqrf_workspace(int m, int n, workspace_query& query)
+{
+    using concurrency::extent;
+
+    // v1, t, w and w_t as allocated below
+    query.add<value_type>(extent<2>(block_size, block_size));
+    query.add<value_type>(extent<2>(block_size, block_size));
+    query.add<value_type>(extent<2>(n, block_size));
+    query.add<value_type>(extent<2>(block_size, m));
+
+    // s, allocated when the panels are factored on the accelerator (the host interface may
+    // dispatch there), so it is always counted
+    query.add<value_type>(extent<2>(block_size, block_size));
+}
+
+// forms wt = v * op(t) for the block reflector of the panel at i (width ib) of a, where v1 
+// holds the unit lower triangular top block of v and the rows below it are read from a
+//
+// op(t) = t gives Q' * A from the left (see geqrf_apply) and A * Q from the right; op(t) = t'
+// gives Q * A and A * Q'
+template <enum class ordering storage_type, typename value_type>
+void form_wt(const concurrency::accelerator_view& av, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,2>& v1, const concurrency::array_view<value_type,2>& t, const concurrency::array_view<value_type,2>& wt, int i, int ib, ampblas::transpose trans_t)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const int m = get_rows<storage_type>(a);
+
+    // wt = v * op(t) (top block)
+    {
+        int m_ = ib;
+        int n_ = ib;
+        int k_ = ib;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(v1, index<2>(0,0), extent<2>(m_,k_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(t, index<2>(0,0), extent<2>(k_,n_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(wt, index<2>(0,0), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::no_trans, trans_t, value_type(1), a_sub, b_sub, value_type(), c_sub);
+    }
+
+    // wt = v * op(t) (remaining rows)
+    if (i+ib < m)
+    {
+        int m_ = m-i-ib;
+        int n_ = ib;
+        int k_ = ib;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(i+ib,i), extent<2>(m_,k_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(t, index<2>(0,0), extent<2>(k_,n_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(wt, index<2>(ib,0), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::no_trans, trans_t, value_type(1), a_sub, b_sub, value_type(), c_sub);
+    }
+}
+
+// applies the block reflector of the panel at i (width ib) of v to the columns c1:c2 of c
+//
+//   C2 = Q' * C2 = (I - V * T' * V') * C2 = C2 - V * w where w = wt' * C2 and wt = V * T
+//
+// v is split into its unit lower triangular top block (v1) and the rectangular block below
+// it, which is read from v in place, so the R factor stored above the diagonal is never 
+// touched; with wt = V * T' the same update applies Q instead of Q'
+template <enum class ordering storage_type, typename value_type>
+void geqrf_apply(const concurrency::accelerator_view& av, const concurrency::array_view<value_type,2>& v, const concurrency::array_view<value_type,2>& c, const concurrency::array_view<value_type,2>& v1, const concurrency::array_view<value_type,2>& w, const concurrency::array_view<value_type,2>& wt, int i, int ib, int c1, int c2)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const int m = get_rows<storage_type>(v);
+
+    if (c1 >= c2)
+        return;
+
+    // rows of v below v1
+    const int mb = m-i-ib;
+
+    // w = wt' * c2 (top block)
+    {
+        int m_ = ib;
+        int n_ = c2-c1;
+        int k_ = ib;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(wt, index<2>(0,0), extent<2>(k_,m_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(c, index<2>(i,c1), extent<2>(k_,n_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(w, index<2>(0,c1), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::conj_trans, ampblas::transpose::no_trans, value_type(1), a_sub, b_sub, value_type(), c_sub);
+    }
+
+    // w += wt' * c2 (remaining rows)
+    if (mb > 0)
+    {
+        int m_ = ib;
+        int n_ = c2-c1;
+        int k_ = mb;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(wt, index<2>(ib,0), extent<2>(k_,m_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(c, index<2>(i+ib,c1), extent<2>(k_,n_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(w, index<2>(0,c1), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::conj_trans, ampblas::transpose::no_trans, value_type(1), a_sub, b_sub, value_type(1), c_sub);
+    }
+
+    // c2 -= v1 * w (top block)
+    {
+        int m_ = ib;
+        int n_ = c2-c1;
+        int k_ = ib;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(v1, index<2>(0,0), extent<2>(m_,k_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(w, index<2>(0,c1), extent<2>(k_,n_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(c, index<2>(i,c1), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::no_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
+    }
+
+    // c2 -= v * w (remaining rows)
+    if (mb > 0)
+    {
+        int m_ = mb;
+        int n_ = c2-c1;
+        int k_ = ib;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(v, index<2>(i+ib,i), extent<2>(m_,k_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(w, index<2>(0,c1), extent<2>(k_,n_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(c, index<2>(i+ib,c1), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::no_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
+    }
+}
+
+// applies the block reflector of the panel at i in place
+template <enum class ordering storage_type, typename value_type>
+void geqrf_apply(const concurrency::accelerator_view& av, concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,2>& v1, const concurrency::array_view<value_type,2>& w, const concurrency::array_view<value_type,2>& wt, int i, int ib, int c1, int c2)
+{
+    geqrf_apply<storage_type>(av, a, a, v1, w, wt, i, ib, c1, c2);
+}
+
+// applies the block reflector of the panel at i (width ib) of v to the columns i:m of c from
+// the right
+//
+//   C2 = C2 * Q = C2 * (I - V * T * V') = C2 - w * V' where w = C2 * wt and wt = V * T
+//
+// with wt = V * T' the same update applies Q' instead of Q
+template <enum class ordering storage_type, typename value_type>
+void ormqr_apply_right(const concurrency::accelerator_view& av, const concurrency::array_view<value_type,2>& v, const concurrency::array_view<value_type,2>& c, const concurrency::array_view<value_type,2>& v1, const concurrency::array_view<value_type,2>& w, const concurrency::array_view<value_type,2>& wt, int i, int ib)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const int m = get_rows<storage_type>(v);
+    const int r = get_rows<storage_type>(c);
+
+    // columns of v below v1
+    const int mb = m-i-ib;
+
+    // w = c2 * wt (left block)
+    {
+        int m_ = r;
+        int n_ = ib;
+        int k_ = ib;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(c, index<2>(0,i), extent<2>(m_,k_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(wt, index<2>(0,0), extent<2>(k_,n_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(w, index<2>(0,0), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::no_trans, value_type(1), a_sub, b_sub, value_type(), c_sub);
+    }
+
+    // w += c2 * wt (remaining columns)
+    if (mb > 0)
+    {
+        int m_ = r;
+        int n_ = ib;
+        int k_ = mb;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(c, index<2>(0,i+ib), extent<2>(m_,k_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(wt, index<2>(ib,0), extent<2>(k_,n_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(w, index<2>(0,0), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::no_trans, value_type(1), a_sub, b_sub, value_type(1), c_sub);
+    }
+
+    // c2 -= w * v1' (left block)
+    {
+        int m_ = r;
+        int n_ = ib;
+        int k_ = ib;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(w, index<2>(0,0), extent<2>(m_,k_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(v1, index<2>(0,0), extent<2>(n_,k_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(c, index<2>(0,i), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::conj_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
+    }
+
+    // c2 -= w * v' (remaining columns)
+    if (mb > 0)
+    {
+        int m_ = r;
+        int n_ = mb;
+        int k_ = ib;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(w, index<2>(0,0), extent<2>(m_,k_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(v, index<2>(i+ib,i), extent<2>(n_,k_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(c, index<2>(0,i+ib), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::conj_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
+    }
+}
+
+// Look ahead: the triangular factor is formed on the host from the panel that was just 
+// factored there, so v is only downloaded once. The reflector is applied to the next 
+// look_ahead_depth panels first and the download of the next panel is queued before the 
+// rest of the trailing matrix. The host then factors the next panel while the accelerator
+// applies the reflector to the remaining columns. A depth of 0 runs panel by panel.
+//
+// With block_factor_location::accelerator the panel and its triangular factor are formed in
+// place by accl::geqr2 and accl::larft and nothing is moved to the host.
+template <int block_size, int look_ahead_depth, enum class ordering storage_type, enum class block_factor_location location, typename value_type>
+void geqrf(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,1>& tau)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    static_assert(look_ahead_depth >= 0, "look ahead depth must not be negative");
+
+    const concurrency::accelerator_view& av = ctx.get_view();
+    
+    // sizes
+    const int m = get_rows<storage_type>(a);
+    const int n = get_cols<storage_type>(a);
+    const int k = std::min(m,n);
+
+    // working array for the unit lower triangular top block of v (accelerator)
+    pooled_array<value_type> array_v1(ctx.get_pool(), extent<2>(block_size, block_size));
+    array_view<value_type,2> v1 = array_v1.get_view();
+
+    // working array for triangular factor (accelerator)
+    pooled_array<value_type> array_t(ctx.get_pool(), extent<2>(block_size, block_size));
+    array_view<value_type,2> t = array_t.get_view();
+
+    // working array for w (accelerator)
+    pooled_array<value_type> array_w(ctx.get_pool(), make_extent<storage_type>(block_size, n));
+    array_view<value_type,2> w = array_w.get_view();
+
+    // working array for w_t (accelerator)
+    pooled_array<value_type> array_wt(ctx.get_pool(), make_extent<storage_type>(m, block_size));
+    array_view<value_type,2> wt = array_wt.get_view();
+
+    // pooled memory holds data from earlier calls; w and w_t are gemm outputs with beta = 0
+    // so they must not start out holding NaN patterns (t is fully written by host::larft)
+    fill(av, w, value_type());
+    fill(av, wt, value_type());
+
+    // scratch for v' * v when t is formed on the accelerator
+    std::unique_ptr<pooled_array<value_type>> array_s;
+    array_view<value_type,2> s = v1;
+
+    if (location == block_factor_location::accelerator)
+    {
+        array_s.reset(new pooled_array<value_type>(ctx.get_pool(), extent<2>(block_size, block_size)));
+        s = array_s->get_view();
+        fill(av, s, value_type());
+    }
+
+    // the next panel to be factored, if its download has already been started
+    std::unique_ptr<host_panel<value_type>> next_panel;
+
+    // panel stepping
+    for (int i = 0; i < k; i += block_size)
+    {
+        // current panel size
+        const int ib = std::min(k-i, block_size);
+
+        array_view<value_type,1> tau_sub = tau.section(index<1>(i)); 
+
+        if (location == block_factor_location::host && !next_panel)
+        {
+            int m_ = m-i;
+            int n_ = ib;
+
+            array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(i,i), extent<2>(m_,n_)); 
+            next_panel.reset(new host_panel<value_type>(ctx.get_staging_pool(), a_sub));
+        }
+
+        std::unique_ptr<host_panel<value_type>> panel(std::move(next_panel));
+
+        // panel factorization
+        if (location == block_factor_location::accelerator)
+        {
+            array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(i,i), extent<2>(m-i,ib)); 
+            accl::geqr2<storage_type>(av, a_sub, tau_sub);
+        }
+        else
+        {
+            host::geqrf<storage_type>(*panel, tau_sub);
+        }
+
+        // apply to rest of matrix
+        if (i+ib < n)
+        {
+            // form the triangular factor (t) of the block reflector
+            {
+                array_view<value_type,2> t_sub = t.section(index<2>(0,0), extent<2>(ib,ib));
+                array_view<value_type,2> v1_sub = v1.section(index<2>(0,0), extent<2>(ib,ib));
+
+                if (location == block_factor_location::accelerator)
+                {
+                    array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(i,i), extent<2>(m-i,ib)); 
+                    array_view<value_type,2> s_sub = s.section(index<2>(0,0), extent<2>(ib,ib));
+
+                    accl::larft<storage_type>(av, a_sub, tau_sub, t_sub, v1_sub, s_sub);
+                }
+                else
+                {
+                    host::larft<storage_type>(ctx, *panel, tau_sub, t_sub, v1_sub);
+                }
+            }
+
+            panel.reset();
+
+            // w = t' * v' <==> w' = v * t
+            form_wt<storage_type>(av, a, v1, t, wt, i, ib, ampblas::transpose::no_trans);
+
+            // update the look ahead panels
+            const int ahead = std::min(n, i+ib+look_ahead_depth*block_size);
+            geqrf_apply<storage_type>(av, a, v1, w, wt, i, ib, i+ib, ahead);
+
+            // start moving the next panel to the host ahead of the trailing update
+            if (location == block_factor_location::host && look_ahead_depth > 0 && i+ib < k)
+            {
+                int m_ = m-i-ib;
+                int n_ = std::min(block_size, k-i-ib);
+
+                array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(i+ib,i+ib), extent<2>(m_,n_)); 
+                next_panel.reset(new host_panel<value_type>(ctx.get_staging_pool(), a_sub));
+            }
+
+            // update the remaining trailing matrix (overlaps the next host factorization)
+            geqrf_apply<storage_type>(av, a, v1, w, wt, i, ib, ahead, n);
+            ctx.get_view().flush();
+        }
+    }
+}
+
+// Applies Q (or Q') from geqrf to c one block reflector at a time. The reflectors and 
+// their triangular factors never leave the accelerator: accl::larft forms t and v1 from 
+// the panel in place and the update is the same w/wt gemm sequence as the factorization.
+// Q' * c and c * Q run through the blocks forwards, Q * c and c * Q' backwards.
+template <int block_size, enum class ordering storage_type, typename value_type>
+void ormqr(context& ctx, enum class side side, enum class transpose trans, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,1>& tau, const concurrency::array_view<value_type,2>& c)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const concurrency::accelerator_view& av = ctx.get_view();
+
+    // sizes
+    const int nq = get_rows<storage_type>(a);
+    const int k = get_cols<storage_type>(a);
+    const int m = get_rows<storage_type>(c);
+    const int n = get_cols<storage_type>(c);
+
+    const bool left = (side == side::left);
+
+    if (k > nq || nq != (left ? m : n))
+        argument_error(4);
+
+    // quick return
+    if (k == 0 || m == 0 || n == 0)
+        return;
+
+    // working arrays (accelerator)
+    pooled_array<value_type> array_v1(ctx.get_pool(), extent<2>(block_size, block_size));
+    array_view<value_type,2> v1 = array_v1.get_view();
+
+    pooled_array<value_type> array_t(ctx.get_pool(), extent<2>(block_size, block_size));
+    array_view<value_type,2> t = array_t.get_view();
+
+    pooled_array<value_type> array_s(ctx.get_pool(), extent<2>(block_size, block_size));
+    array_view<value_type,2> s = array_s.get_view();
+
+    pooled_array<value_type> array_w(ctx.get_pool(), left ? make_extent<storage_type>(block_size, n) : make_extent<storage_type>(m, block_size));
+    array_view<value_type,2> w = array_w.get_view();
+
+    pooled_array<value_type> array_wt(ctx.get_pool(), make_extent<storage_type>(nq, block_size));
+    array_view<value_type,2> wt = array_wt.get_view();
+
+    // gemm outputs with beta = 0 must not start out holding NaN patterns
+    fill(av, s, value_type());
+    fill(av, w, value_type());
+    fill(av, wt, value_type());
+
+    // block order and the matching wt = v * op(t)
+    const bool forward = (left == (trans != transpose::no_trans));
+    const ampblas::transpose trans_t = (forward ? ampblas::transpose::no_trans : ampblas::transpose::conj_trans);
+    const int blocks = (k + block_size - 1) / block_size;
+
+    for (int b = 0; b < blocks; b++)
+    {
+        const int i = (forward ? b : blocks-1-b) * block_size;
+        const int ib = std::min(k-i, block_size);
+
+        // form the triangular factor (t) of the block reflector
+        {
+            array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(i,i), extent<2>(nq-i,ib)); 
+            array_view<value_type,2> t_sub = t.section(index<2>(0,0), extent<2>(ib,ib));
+            array_view<value_type,2> v1_sub = v1.section(index<2>(0,0), extent<2>(ib,ib));
+            array_view<value_type,2> s_sub = s.section(index<2>(0,0), extent<2>(ib,ib));
+
+            accl::larft<storage_type>(av, a_sub, tau.section(index<1>(i)), t_sub, v1_sub, s_sub);
+        }
+
+        form_wt<storage_type>(av, a, v1, t, wt, i, ib, trans_t);
+
+        if (left)
+            geqrf_apply<storage_type>(av, a, c, v1, w, wt, i, ib, 0, n);
+        else
+            ormqr_apply_right<storage_type>(av, a, c, v1, w, wt, i, ib);
+    }
+}
+
+// Forms the first n columns of Q from the k reflectors geqrf left in a (k <= n <= m). Q is
+// built from the identity backwards; the reflectors of the panel at i leave the columns 
+// before i untouched, so each block only updates the columns i:n.
+template <int block_size, enum class ordering storage_type, typename value_type>
+void orgqr(context& ctx, int k, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,1>& tau)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const concurrency::accelerator_view& av = ctx.get_view();
+
+    // sizes
+    const int m = get_rows<storage_type>(a);
+    const int n = get_cols<storage_type>(a);
+
+    if (k < 0 || k > n)
+        argument_error(2);
+    if (n > m)
+        argument_error(3);
+
+    // quick return
+    if (n == 0)
+        return;
+
+    // q starts out as the first n columns of the identity (accelerator)
+    pooled_array<value_type> array_q(ctx.get_pool(), a.extent);
+    array_view<value_type,2> q = array_q.get_view();
+
+    concurrency::parallel_for_each(av, q.extent, [=] (index<2> idx) restrict(amp) 
+    {
+        const int i = (storage_type == ordering::row_major ? idx[0] : idx[1]);
+        const int j = (storage_type == ordering::row_major ? idx[1] : idx[0]);
+
+        q[idx] = (i == j ? value_type(1) : value_type());
+    });
+
+    if (k > 0)
+    {
+        // working arrays (accelerator)
+        pooled_array<value_type> array_v1(ctx.get_pool(), extent<2>(block_size, block_size));
+        array_view<value_type,2> v1 = array_v1.get_view();
+
+        pooled_array<value_type> array_t(ctx.get_pool(), extent<2>(block_size, block_size));
+        array_view<value_type,2> t = array_t.get_view();
+
+        pooled_array<value_type> array_s(ctx.get_pool(), extent<2>(block_size, block_size));
+        array_view<value_type,2> s = array_s.get_view();
+
+        pooled_array<value_type> array_w(ctx.get_pool(), make_extent<storage_type>(block_size, n));
+        array_view<value_type,2> w = array_w.get_view();
+
+        pooled_array<value_type> array_wt(ctx.get_pool(), make_extent<storage_type>(m, block_size));
+        array_view<value_type,2> wt = array_wt.get_view();
+
+        // gemm outputs with beta = 0 must not start out holding NaN patterns
+        fill(av, s, value_type());
+        fill(av, w, value_type());
+        fill(av, wt, value_type());
+
+        // q = Q * q, last block first
+        for (int i = ((k-1) / block_size) * block_size; i >= 0; i -= block_size)
+        {
+            const int ib = std::min(k-i, block_size);
+
+            // form the triangular factor (t) of the block reflector
+            {
+                array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(i,i), extent<2>(m-i,ib)); 
+                array_view<value_type,2> t_sub = t.section(index<2>(0,0), extent<2>(ib,ib));
+                array_view<value_type,2> v1_sub = v1.section(index<2>(0,0), extent<2>(ib,ib));
+                array_view<value_type,2> s_sub = s.section(index<2>(0,0), extent<2>(ib,ib));
+
+                accl::larft<storage_type>(av, a_sub, tau.section(index<1>(i)), t_sub, v1_sub, s_sub);
+            }
+
+            form_wt<storage_type>(av, a, v1, t, wt, i, ib, ampblas::transpose::conj_trans);
+            geqrf_apply<storage_type>(av, a, q, v1, w, wt, i, ib, i, n);
+        }
+    }
+
+    q.copy_to(a);
+}
+
+// this is a work around until VS std::bind can accept more paramaters
+template <typename value_type>
+struct geqrf_params
+{
+    int m;
+    int n; 
+    value_type* a; 
+    int lda; 
+    value_type* tau;
+
+    geqrf_params(int m, int n, value_type* a, int lda, value_type* tau)
+        : m(m), n(n), a(a), lda(lda), tau(tau) 
+    {}
+};
+
+template <enum class execution_target target, typename value_type>
+void geqrf_unpack(context& ctx, const geqrf_params<value_type>& p)
+{
+    amplapack::geqrf<target>(ctx, p.m, p.n, p.a, p.lda, p.tau); 
+}
+
+template <enum class execution_target target, typename value_type>
+void geqrf_async_unpack(context& ctx, async_call& call, const geqrf_params<value_type>& p)
+{
+    amplapack::geqrf_async<target>(ctx, p.m, p.n, p.a, p.lda, p.tau, call); 
+}
+
+template <typename value_type>
+struct ormqr_params
+{
+    char side;
+    char trans;
+    int m;
+    int n;
+    int k;
+    const value_type* a;
+    int lda;
+    const value_type* tau;
+    value_type* c;
+    int ldc;
+
+    ormqr_params(char side, char trans, int m, int n, int k, const value_type* a, int lda, const value_type* tau, value_type* c, int ldc)
+        : side(side), trans(trans), m(m), n(n), k(k), a(a), lda(lda), tau(tau), c(c), ldc(ldc)
+    {}
+};
+
+template <enum class execution_target target, typename value_type>
+void ormqr_unpack(context& ctx, const ormqr_params<value_type>& p)
+{
+    amplapack::ormqr<target>(ctx, p.side, p.trans, p.m, p.n, p.k, p.a, p.lda, p.tau, p.c, p.ldc); 
+}
+
+template <typename value_type>
+struct orgqr_params
+{
+    int m;
+    int n;
+    int k;
+    value_type* a;
+    int lda;
+    const value_type* tau;
+
+    orgqr_params(int m, int n, int k, value_type* a, int lda, const value_type* tau)
+        : m(m), n(n), k(k), a(a), lda(lda), tau(tau)
+    {}
+};
+
+template <enum class execution_target target, typename value_type>
+void orgqr_unpack(context& ctx, const orgqr_params<value_type>& p)
+{
+    amplapack::orgqr<target>(ctx, p.m, p.n, p.k, p.a, p.lda, p.tau); 
+}
+
+} // namespace _detail
+
+//
+// Array View Interface
+//
+
+template <enum class ordering storage_type, enum class block_factor_location location, typename value_type>
+void geqrf(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,1>& tau)
+{
+    _detail::geqrf<_detail::geqrf_block_size, _detail::geqrf_look_ahead_depth, storage_type, location>(ctx, a, tau);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void geqrf(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,1>& tau)
+{
+    geqrf<storage_type, block_factor_location::host>(ctx, a, tau);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void geqrf(const concurrency::accelerator_view& av, concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,1>& tau)
+{
+    context ctx(av);
+    geqrf<storage_type>(ctx, a, tau);
+}
+
+// queues the factorization on the accelerator (as block_factor_location::accelerator) and 
+// returns without waiting for it; tau is written by the queued work and is valid once the 
+// returned future has completed
+template <enum class ordering storage_type, typename value_type>
+concurrency::completion_future geqrf_async(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,1>& tau)
+{
+    _detail::geqrf<_detail::geqrf_block_size, _detail::geqrf_look_ahead_depth, storage_type, block_factor_location::accelerator>(ctx, a, tau);
+    return ctx.get_view().create_marker();
+}
+
+// applies Q from geqrf, held as the k reflectors in the columns of a, to c: op(Q) * c from the
+// left or c * op(Q) from the right; any trans other than no_trans applies Q' (unmqr for the 
+// complex types)
+template <enum class ordering storage_type, typename value_type>
+void ormqr(context& ctx, enum class side side, enum class transpose trans, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,1>& tau, concurrency::array_view<value_type,2>& c)
+{
+    _detail::ormqr<_detail::geqrf_block_size, storage_type>(ctx, side, trans, a, tau, c);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void ormqr(const concurrency::accelerator_view& av, enum class side side, enum class transpose trans, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,1>& tau, concurrency::array_view<value_type,2>& c)
+{
+    context ctx(av);
+    ormqr<storage_type>(ctx, side, trans, a, tau, c);
+}
+
+// overwrites the m by n matrix a (n <= m), holding the first k reflectors from geqrf, with the
+// first n columns of Q (ungqr for the complex types)
+template <enum class ordering storage_type, typename value_type>
+void orgqr(context& ctx, int k, concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,1>& tau)
+{
+    _detail::orgqr<_detail::geqrf_block_size, storage_type>(ctx, k, a, tau);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void orgqr(const concurrency::accelerator_view& av, int k, concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,1>& tau)
+{
+    context ctx(av);
+    orgqr<storage_type>(ctx, k, a, tau);
+}
+
+//
+// Host Interface Function
+//
+
+template <enum class execution_target target, typename value_type>
+void geqrf(context& ctx, int m, int n, value_type* a, int lda, value_type* tau)
+{
+    // quick return
+    if (n == 0 || m == 0)
+        return;
+
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < m)
+        argument_error(5);
+    if (tau == nullptr)
+        argument_error(6);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        int info;
+        _detail::lapack::geqrf(m, n, a, lda, tau, info);
+        info_check(info);
+        return;
+    }
+
+    // host views
+    concurrency::array_view<value_type,2> host_view_a(n, lda, a);
+    concurrency::array_view<value_type,2> host_view_a_sub = host_view_a.section(concurrency::index<2>(0,0), concurrency::extent<2>(n,m));
+    concurrency::array_view<value_type,1> host_view_tau(std::min(m,n), tau);
+
+    // accelerator copy of a (drawn from the context's pool)
+    pooled_array<value_type> accl_a(ctx.get_pool(), host_view_a_sub.extent);
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::copy(host_view_a_sub, accl_view_a);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+    // foward to array view interface
+    geqrf<ordering::column_major, (target == execution_target::accelerator ? block_factor_location::accelerator : block_factor_location::host)>(ctx, accl_view_a, host_view_tau);
+
+    // copy back to host
+    concurrency::copy(accl_view_a, host_view_a_sub);
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_a.extent));
+}
+
+template <typename value_type>
+void geqrf(context& ctx, int m, int n, value_type* a, int lda, value_type* tau)
+{
+    geqrf<execution_target::hybrid>(ctx, m, n, a, lda, tau);
+}
+
+template <typename value_type>
+void geqrf(concurrency::accelerator_view& av, int m, int n, value_type* a, int lda, value_type* tau)
+{
+    context ctx(av);
+    geqrf(ctx, m, n, a, lda, tau);
+}
+
+// queues geqrf and returns once a has been uploaded; a and tau are written back by copies 
+// owned by call. The host target factors a before returning.
+template <enum class execution_target target, typename value_type>
+void geqrf_async(context& ctx, int m, int n, value_type* a, int lda, value_type* tau, async_call& call)
+{
+    // quick return
+    if (n == 0 || m == 0)
+        return;
+
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < m)
+        argument_error(5);
+    if (tau == nullptr)
+        argument_error(6);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        _detail::lapack::geqrf(m, n, a, lda, tau, *call.get_info());
+        return;
+    }
+
+    const int k = std::min(m,n);
+
+    // host views
+    concurrency::array_view<value_type,2> host_view_a(n, lda, a);
+    concurrency::array_view<value_type,2> host_view_a_sub = host_view_a.section(concurrency::index<2>(0,0), concurrency::extent<2>(n,m));
+    concurrency::array_view<value_type,1> host_view_tau(k, tau);
+
+    // accelerator copies owned by the call until it completes (drawn from the context's pool)
+    pooled_array<value_type>& accl_a = call.hold(new pooled_array<value_type>(ctx.get_pool(), host_view_a_sub.extent));
+    pooled_array<value_type>& accl_tau = call.hold(new pooled_array<value_type>(ctx.get_pool(), concurrency::extent<2>(1,k)));
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::array_view<value_type,1> accl_view_tau = accl_tau.get_view()[0];
+
+    concurrency::copy(host_view_a_sub, accl_view_a);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+    _detail::geqrf<_detail::geqrf_block_size, _detail::geqrf_look_ahead_depth, ordering::column_major, block_factor_location::accelerator>(ctx, accl_view_a, accl_view_tau);
+
+    // copies back to host (complete the call)
+    call.add(concurrency::copy_async(accl_view_a, host_view_a_sub));
+    call.add(concurrency::copy_async(accl_view_tau, host_view_tau));
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_a.extent));
+}
+
+template <typename value_type>
+void geqrf_async(context& ctx, int m, int n, value_type* a, int lda, value_type* tau, async_call& call)
+{
+    geqrf_async<execution_target::accelerator>(ctx, m, n, a, lda, tau, call);
+}
+
+// the reflectors, tau and c are uploaded once and only c comes back
+template <enum class execution_target target, typename value_type>
+void ormqr(context& ctx, char side, char trans, int m, int n, int k, const value_type* a, int lda, const value_type* tau, value_type* c, int ldc)
+{
+    const bool complex_type = (precision_of<value_type>() == 'C' || precision_of<value_type>() == 'Z');
+
+    // error checking
+    side = static_cast<char>(toupper(side));
+    trans = static_cast<char>(toupper(trans));
+
+    const int nq = (side == 'L' ? m : n);
+
+    if (side != 'L' && side != 'R')
+        argument_error(2);
+    if (trans != 'N' && trans != 'C' && (trans != 'T' || complex_type))
+        argument_error(3);
+    if (m < 0)
+        argument_error(4);
+    if (n < 0)
+        argument_error(5);
+    if (k < 0 || k > nq)
+        argument_error(6);
+
+    // quick return
+    if (m == 0 || n == 0 || k == 0)
+        return;
+
+    if (a == nullptr)
+        argument_error(7);
+    if (lda < nq)
+        argument_error(8);
+    if (tau == nullptr)
+        argument_error(9);
+    if (c == nullptr)
+        argument_error(10);
+    if (ldc < m)
+        argument_error(11);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        // the real routines only take 'T' and the complex ones only 'C'
+        const char trans_host = (trans == 'N' ? 'N' : (complex_type ? 'C' : 'T'));
+
+        int info;
+        _detail::lapack::ormqr(side, trans_host, m, n, k, a, lda, tau, c, ldc, info);
+        info_check(info);
+        return;
+    }
+
+    // host views
+    concurrency::array_view<const value_type,2> host_view_a = concurrency::array_view<const value_type,2>(k, lda, a).section(concurrency::index<2>(0,0), concurrency::extent<2>(k,nq));
+    concurrency::array_view<const value_type,1> host_view_tau(k, tau);
+    concurrency::array_view<value_type,2> host_view_c = concurrency::array_view<value_type,2>(n, ldc, c).section(concurrency::index<2>(0,0), concurrency::extent<2>(n,m));
+
+    // accelerator copies (drawn from the context's pool)
+    pooled_array<value_type> accl_a(ctx.get_pool(), host_view_a.extent);
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::copy(host_view_a, accl_view_a);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+    pooled_array<value_type> accl_tau(ctx.get_pool(), concurrency::extent<2>(1,k));
+    concurrency::array_view<value_type,1> accl_view_tau = accl_tau.get_view()[0];
+    concurrency::copy(host_view_tau, accl_view_tau);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_tau.get_view().extent));
+
+    pooled_array<value_type> accl_c(ctx.get_pool(), host_view_c.extent);
+    concurrency::array_view<value_type,2> accl_view_c = accl_c.get_view();
+    concurrency::copy(host_view_c, accl_view_c);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_c.extent));
+
+    // foward to array view interface
+    ormqr<ordering::column_major>(ctx, (side == 'L' ? side::left : side::right), to_transpose_option(trans), accl_view_a, accl_view_tau, accl_view_c);
+
+    // copy back to host
+    concurrency::copy(accl_view_c, host_view_c);
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_c.extent));
+}
+
+template <typename value_type>
+void ormqr(context& ctx, char side, char trans, int m, int n, int k, const value_type* a, int lda, const value_type* tau, value_type* c, int ldc)
+{
+    ormqr<execution_target::hybrid>(ctx, side, trans, m, n, k, a, lda, tau, c, ldc);
+}
+
+template <enum class execution_target target, typename value_type>
+void orgqr(context& ctx, int m, int n, int k, value_type* a, int lda, const value_type* tau)
+{
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0 || n > m)
+        argument_error(3);
+    if (k < 0 || k > n)
+        argument_error(4);
+
+    // quick return
+    if (n == 0)
+        return;
+
+    if (a == nullptr)
+        argument_error(5);
+    if (lda < m)
+        argument_error(6);
+    if (tau == nullptr && k > 0)
+        argument_error(7);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        int info;
+        _detail::lapack::orgqr(m, n, k, a, lda, tau, info);
+        info_check(info);
+        return;
+    }
+
+    // host views
+    concurrency::array_view<value_type,2> host_view_a = concurrency::array_view<value_type,2>(n, lda, a).section(concurrency::index<2>(0,0), concurrency::extent<2>(n,m));
+
+    // accelerator copies (drawn from the context's pool)
+    pooled_array<value_type> accl_a(ctx.get_pool(), host_view_a.extent);
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::copy(host_view_a, accl_view_a);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+    pooled_array<value_type> accl_tau(ctx.get_pool(), concurrency::extent<2>(1,std::max(k,1)));
+    concurrency::array_view<value_type,1> accl_view_tau = accl_tau.get_view()[0];
+
+    if (k > 0)
+    {
+        concurrency::copy(concurrency::array_view<const value_type,1>(k, tau), accl_view_tau.section(0,k));
+        ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(concurrency::extent<2>(1,k)));
+    }
+
+    // foward to array view interface
+    orgqr<ordering::column_major>(ctx, k, accl_view_a, accl_view_tau);
+
+    // copy back to host
+    concurrency::copy(accl_view_a, host_view_a);
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_a.extent));
+}
+
+template <typename value_type>
+void orgqr(context& ctx, int m, int n, int k, value_type* a, int lda, const value_type* tau)
+{
+    orgqr<execution_target::hybrid>(ctx, m, n, k, a, lda, tau);
+}
+
+// pooled device memory (in bytes) used by the host interface for an m by n problem
+template <typename value_type>
+size_t geqrf_workspace(int m, int n)
+{
+    workspace_query query;
+
+    // accelerator copy of a
+    query.add<value_type>(concurrency::extent<2>(n,m));
+
+    _detail::geqrf_workspace<_detail::geqrf_block_size, value_type>(m, n, query);
+
+    return query.get_bytes();
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_GEQRF_H
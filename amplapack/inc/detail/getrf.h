@@ -1,327 +1,1495 @@
-/*----------------------------------------------------------------------------
-* Copyright  Microsoft Corp.
-*
-* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
-* use this file except in compliance with the License.  You may obtain a copy 
-* of the License at http://www.apache.org/licenses/LICENSE-2.0  
-* 
-* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
-* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
-* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
-* MERCHANTABLITY OR NON-INFRINGEMENT. 
-*
-* See the Apache Version 2.0 License for specific language governing 
-* permissions and limitations under the License.
-*---------------------------------------------------------------------------
-* 
-* getrf.h
-*
-*---------------------------------------------------------------------------*/
-
-#ifndef AMPLAPACK_GETRF_H
-#define AMPLAPACK_GETRF_H
-
-#include "amplapack_config.h"
-
-// external lapack functions
-
-namespace amplapack {
-namespace _detail {
-
-//
-// External LAPACK Wrappers
-// 
-
-namespace lapack {
-
-template <typename value_type>
-void getrf(int m, int n, value_type* a, int lda, int* ipiv, int& info);
-
-template <>
-void getrf(int m, int n, float* a, int lda, int* ipiv, int& info)
-{ 
-    LAPACK_SGETRF(&m, &n, a, &lda, ipiv, &info); 
-}
-
-template <>
-void getrf(int m, int n, double* a, int lda, int* ipiv, int& info)
-{ 
-    LAPACK_DGETRF(&m, &n, a, &lda, ipiv, &info); 
-}
-
-template <>
-void getrf(int m, int n, ampblas::complex<float>* a, int lda, int* ipiv, int& info)
-{ 
-    LAPACK_CGETRF(&m, &n, a, &lda, ipiv, &info); 
-}
-
-template <>
-void getrf(int m, int n, ampblas::complex<double>* a, int lda, int* ipiv, int& info)
-{
-    LAPACK_ZGETRF(&m, &n, a, &lda, ipiv, &info); 
-}
-
-} // namespace lapack
-
-//
-// Host Wrapper
-//
-
-namespace host {
-
-template <enum class ordering storage_type, typename value_type>
-void getrf(const concurrency::accelerator_view& /*av*/, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv)
-{
-    static_assert(storage_type == ordering::column_major, "hybrid functionality requires column major ordering");
-
-    const int m = get_rows<storage_type>(a);
-    const int n = get_cols<storage_type>(a);
-   
-    // TODO: take from a pool
-    const int lda = get_leading_dimension<storage_type>(a);
-    std::vector<value_type> hostVector(lda*n);
-
-    // copy from acclerator to host
-    concurrency::copy(a, hostVector.begin());
-
-    // run host function
-    int info = 0;
-    lapack::getrf(m, n, hostVector.data(), lda, ipiv.data(), info);
-
-    // check for errors
-    info_check(info);
-
-    // copy from host to accelerator
-    // requires -D_SCL_SECURE_NO_WARNINGS
-    concurrency::copy(hostVector.begin(), hostVector.end(), a);
-}
-
-} // namespace host
-
-//
-// Row Interchanges
-//
-
-template <typename T>
-inline void swap(T& a, T& b) restrict(amp)
-{
-    T temp = a;
-    a = b;
-    b = temp;
-}
-
-template <enum class ordering storage_type, typename value_type>
-void laswp(const concurrency::accelerator_view& av, concurrency::array_view<value_type,2>& a, int k1, int k2, concurrency::array_view<int,1>& ipiv)
-{
-    using concurrency::index;
-
-    const int n = get_cols<storage_type>(a);
-
-    // only forward swaps are implemented (incx >= 1)
-    concurrency::parallel_for_each(
-        av,
-        concurrency::extent<1>(n),
-        [=](index<1> idx) restrict(amp) 
-        {
-            const int j = idx[0];
-
-            for (int i = k1; i < k2; i++)
-            {
-                // pivot index (Fortran indexing)
-                int ip = ipiv[index<1>(i)]-1;
-                
-                if (i != ip)
-                {
-                    swap(a(index<2>(j,ip)), a(index<2>(j,i)));
-                }
-            }
-        }
-    );   
-}
-
-//
-// Blocked Factorization
-//
-
-template <int block_size, int look_ahead_depth, enum class ordering storage_type, enum class block_factor_location location, typename value_type>
-void getrf(const concurrency::accelerator_view& av, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv)
-{
-    using concurrency::array_view;
-    using concurrency::index;
-    using concurrency::extent;
-
-    // data error
-    int info = 0;
-    
-    // sizes
-    const int m = get_rows<storage_type>(a);
-    const int n = get_cols<storage_type>(a);
-    const int k = std::min(m,n);
-
-    // panel stepping
-    for (int j = 0; j < k; j += block_size)
-    {
-        // current block size
-        int jb = std::min(block_size, k-j);
-
-        // factor diagonal and subdiagonal blocks and test for exact singularity
-        try 
-        {
-            int m_ = m-j;
-            int n_ = jb;
-            int k_ = std::min(m_,n_);
-            array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(m_,n_)); 
-            array_view<int,1> ipiv_sub = ipiv.section(index<1>(j), extent<1>(k_)); 
-            host::getrf<storage_type>(av, a_sub, ipiv_sub);
-        }
-        catch(const data_error_exception& e)
-        {
-            // offset data error (do not rethrow) 
-            info = j + e.get();
-        }
-        
-        // offset pivot vector
-        for (int i=0; i<jb; i++)
-        {
-            ipiv(index<1>(j+i)) += j;
-        }
-
-        // apply interchanges to columns 1:j
-        if (j > 0)
-        {
-            int m_ = m;
-            int n_ = j;
-            array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(0,0), extent<2>(m_,n_));
-
-            laswp<storage_type>(av, a_sub, j, j+jb, ipiv);
-        }
-
-        // apply to rest of matrix
-        if (j+jb < n)
-        {
-            // apply interchange to columns j+jb:n
-            {
-                int m_ = m;
-                int n_ = n-j-jb;
-                array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(0,j+jb), extent<2>(m_,n_));
-
-                laswp<storage_type>(av, a_sub, j, j+jb, ipiv);
-            }
-
-            // compute block row of U
-            {
-                int m_ = jb;
-                int n_ = n-j-jb;
-
-                array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(m_,m_));
-                array_view<value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(j,j+jb), extent<2>(m_,n_));
-
-                ampblas::link::trsm(av, ampblas::side::left, ampblas::uplo::lower, ampblas::transpose::no_trans, ampblas::diag::unit, value_type(1), a_sub, b_sub);
-            }
-
-            // no look ahead yet
-            if (j+jb < m)
-            {
-                // update trailing matrix
-                int m_ = m-j-jb;
-                int n_ = n-j-jb;
-                int k_ = jb;
-
-                array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,j), extent<2>(m_,k_));
-                array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(j,j+jb), extent<2>(k_,n_));
-                array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,j+jb), extent<2>(m_,n_));
-
-                ampblas::link::gemm(av, ampblas::transpose::no_trans, ampblas::transpose::no_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
-            }
-        }
-    }
-
-    // rethrow data error (if any)
-    if (info)
-        data_error(info);
-}
-
-//
-// Forwarding Function
-//
-
-// this is a work around until VS std::bind can accept more paramaters
-template <typename value_type>
-struct getrf_params
-{
-    int m;
-    int n; 
-    value_type* a; 
-    int lda; 
-    int* ipiv;
-
-    getrf_params(int m, int n, value_type* a, int lda, int* ipiv)
-        : m(m), n(n), a(a), lda(lda), ipiv(ipiv) 
-    {}
-};
-
-template <typename value_type>
-void getrf_unpack(concurrency::accelerator_view& av, const getrf_params<value_type>& p)
-{
-    amplapack::getrf(av, p.m, p.n, p.a, p.lda, p.ipiv); 
-}
-
-} // namespace _detail
-
-//
-// Array View Interface
-// 
-
-template <enum class ordering storage_type, typename value_type>
-void getrf(const concurrency::accelerator_view& av, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv)
-{
-    const int block_size = 256;
-    const int look_ahead_depth = 1;
-
-    _detail::getrf<block_size, look_ahead_depth, storage_type, block_factor_location::host>(av, a, ipiv);
-}
-
-//
-// Host Interface Function
-//
-
-template <typename value_type>
-void getrf(concurrency::accelerator_view& av, int m, int n, value_type* a, int lda, int* ipiv)
-{
-    // quick return
-    if (n == 0 || m == 0)
-        return;
-
-    // error checking
-    if (m < 0)
-        argument_error(2);
-    if (n < 0)
-        argument_error(3);
-    if (a == nullptr)
-        argument_error(4);
-    if (lda < m)
-        argument_error(5);
-    if (ipiv == nullptr)
-        argument_error(6);
-
-    // host views
-    concurrency::array_view<value_type,2> host_view_a(n, lda, a);
-    concurrency::array_view<value_type,2> host_view_a_sub = host_view_a.section(concurrency::index<2>(0,0), concurrency::extent<2>(n,m));
-    concurrency::array_view<int,1> host_view_ipiv(std::min(m,n), ipiv);
-
-    // accelerator array (allocation and copy)
-    concurrency::array<value_type,2> accl_a(host_view_a_sub);
-
-    // accelerator view
-    concurrency::array_view<value_type,2> accl_view_a(accl_a);
-
-    // forwarding to array view interface
-    getrf<ordering::column_major>(av, accl_view_a, host_view_ipiv);
-
-    // copy back to host
-    concurrency::copy(accl_view_a, host_view_a_sub);
-}
-
-} // namespace amplapack
-
-#endif // AMPLAPACK_GETRF_H
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* getrf.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_GETRF_H
+#define AMPLAPACK_GETRF_H
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "amplapack_config.h"
+#include "layout.h"
+#include "task_graph.h"
+
+// external lapack functions
+
+namespace amplapack {
+namespace _detail {
+
+//
+// External LAPACK Wrappers
+// 
+
+namespace lapack {
+
+template <typename value_type>
+void getrf(int m, int n, value_type* a, int lda, int* ipiv, int& info);
+
+template <>
+inline void getrf(int m, int n, float* a, int lda, int* ipiv, int& info)
+{ 
+    LAPACK_SGETRF(&m, &n, a, &lda, ipiv, &info); 
+}
+
+template <>
+inline void getrf(int m, int n, double* a, int lda, int* ipiv, int& info)
+{ 
+    LAPACK_DGETRF(&m, &n, a, &lda, ipiv, &info); 
+}
+
+template <>
+inline void getrf(int m, int n, ampblas::complex<float>* a, int lda, int* ipiv, int& info)
+{ 
+    LAPACK_CGETRF(&m, &n, a, &lda, ipiv, &info); 
+}
+
+template <>
+inline void getrf(int m, int n, ampblas::complex<double>* a, int lda, int* ipiv, int& info)
+{
+    LAPACK_ZGETRF(&m, &n, a, &lda, ipiv, &info); 
+}
+
+template <typename value_type>
+void getrs(char trans, int n, int nrhs, const value_type* a, int lda, const int* ipiv, value_type* b, int ldb, int& info);
+
+template <>
+inline void getrs(char trans, int n, int nrhs, const float* a, int lda, const int* ipiv, float* b, int ldb, int& info)
+{
+    LAPACK_SGETRS(&trans, &n, &nrhs, a, &lda, ipiv, b, &ldb, &info);
+}
+
+template <>
+inline void getrs(char trans, int n, int nrhs, const double* a, int lda, const int* ipiv, double* b, int ldb, int& info)
+{
+    LAPACK_DGETRS(&trans, &n, &nrhs, a, &lda, ipiv, b, &ldb, &info);
+}
+
+template <>
+inline void getrs(char trans, int n, int nrhs, const ampblas::complex<float>* a, int lda, const int* ipiv, ampblas::complex<float>* b, int ldb, int& info)
+{
+    LAPACK_CGETRS(&trans, &n, &nrhs, a, &lda, ipiv, b, &ldb, &info);
+}
+
+template <>
+inline void getrs(char trans, int n, int nrhs, const ampblas::complex<double>* a, int lda, const int* ipiv, ampblas::complex<double>* b, int ldb, int& info)
+{
+    LAPACK_ZGETRS(&trans, &n, &nrhs, a, &lda, ipiv, b, &ldb, &info);
+}
+
+template <typename value_type>
+void trsm(char side, char uplo, char transa, char diag, int m, int n, value_type alpha, const value_type* a, int lda, value_type* b, int ldb);
+
+template <>
+inline void trsm(char side, char uplo, char transa, char diag, int m, int n, float alpha, const float* a, int lda, float* b, int ldb)
+{
+    LAPACK_STRSM(&side, &uplo, &transa, &diag, &m, &n, &alpha, a, &lda, b, &ldb);
+}
+
+template <>
+inline void trsm(char side, char uplo, char transa, char diag, int m, int n, double alpha, const double* a, int lda, double* b, int ldb)
+{
+    LAPACK_DTRSM(&side, &uplo, &transa, &diag, &m, &n, &alpha, a, &lda, b, &ldb);
+}
+
+template <>
+inline void trsm(char side, char uplo, char transa, char diag, int m, int n, ampblas::complex<float> alpha, const ampblas::complex<float>* a, int lda, ampblas::complex<float>* b, int ldb)
+{
+    LAPACK_CTRSM(&side, &uplo, &transa, &diag, &m, &n, &alpha, a, &lda, b, &ldb);
+}
+
+template <>
+inline void trsm(char side, char uplo, char transa, char diag, int m, int n, ampblas::complex<double> alpha, const ampblas::complex<double>* a, int lda, ampblas::complex<double>* b, int ldb)
+{
+    LAPACK_ZTRSM(&side, &uplo, &transa, &diag, &m, &n, &alpha, a, &lda, b, &ldb);
+}
+
+} // namespace lapack
+
+//
+// Tournament Pivoting
+//
+// A communication avoiding LU factorization (CALU) of a tall m by n panel: the panel is split
+// into row blocks that are factored at once with partial pivoting, each keeping the n rows it
+// picks as pivots. The winners of up to block_rows/n blocks are stacked and factored again, and
+// so on until one set of n rows is left. Those rows are moved to the top of the panel, the top
+// block is factored and the rows below are solved against its U, also in parallel.
+//
+// The pivots differ from partial pivoting over the whole panel, but the factors satisfy the
+// same p * a = l * u. Should the top block need pivots of its own (ties or an exactly singular
+// panel) the panel is restored and factored with partial pivoting instead.
+//
+
+// rows of the blocks that compete at the bottom of the tournament
+const int calu_block_rows = 4096;
+
+// a set of candidate pivot rows: their rows in the panel and a copy of their n values
+template <typename value_type>
+struct pivot_candidates
+{
+    std::vector<int> rows;
+    std::vector<value_type> values;
+};
+
+// factors the candidates with partial pivoting and keeps the rows chosen as pivots, in order
+template <typename value_type>
+void calu_select(int n, pivot_candidates<value_type>& candidates)
+{
+    const int count = static_cast<int>(candidates.rows.size());
+    const int k = std::min(count, n);
+
+    std::vector<value_type> lu(candidates.values);
+    std::vector<int> pivots(k);
+
+    // a singular block still yields pivots, so info is not checked
+    int info = 0;
+    lapack::getrf(count, n, lu.data(), count, pivots.data(), info);
+
+    std::vector<int> order(count);
+    for (int i = 0; i < count; i++)
+        order[i] = i;
+
+    for (int i = 0; i < k; i++)
+        std::swap(order[i], order[pivots[i]-1]);
+
+    pivot_candidates<value_type> winners;
+    winners.rows.resize(k);
+    winners.values.resize(size_t(k)*n);
+
+    for (int i = 0; i < k; i++)
+    {
+        winners.rows[i] = candidates.rows[order[i]];
+
+        for (int j = 0; j < n; j++)
+            winners.values[j*k + i] = candidates.values[j*count + order[i]];
+    }
+
+    candidates = std::move(winners);
+}
+
+// swaps rows i1 and i2 of the n columns of a
+template <typename value_type>
+void swap_rows(int n, value_type* a, int lda, int i1, int i2)
+{
+    if (i1 != i2)
+        for (int j = 0; j < n; j++)
+            std::swap(a[j*lda + i1], a[j*lda + i2]);
+}
+
+// same interface as lapack::getrf, for panels with m >= n; falls back to it for panels
+// shorter than two blocks
+template <typename value_type>
+void getrf_calu(int m, int n, value_type* a, int lda, int* ipiv, int& info, worker_pool& workers)
+{
+    const int block_rows = std::max(calu_block_rows, 2*n);
+    const int blocks = m / block_rows;
+
+    if (blocks < 2 || n == 0)
+    {
+        lapack::getrf(m, n, a, lda, ipiv, info);
+        return;
+    }
+
+    const int arity = std::max(2, block_rows / n);
+
+    // the tournament, from the row blocks up
+    std::vector<std::vector<pivot_candidates<value_type>>> levels(1, std::vector<pivot_candidates<value_type>>(blocks));
+
+    while (levels.back().size() > 1)
+        levels.push_back(std::vector<pivot_candidates<value_type>>((levels.back().size() + arity - 1) / arity));
+
+    task_graph graph;
+    std::vector<std::vector<int>> task_ids(levels.size());
+
+    for (int b = 0; b < blocks; b++)
+    {
+        pivot_candidates<value_type>* block = &levels[0][b];
+        const int first = b*block_rows;
+        const int rows = (b == blocks-1 ? m - first : block_rows);
+
+        task_ids[0].push_back(graph.add([=] {
+            block->rows.resize(rows);
+            block->values.resize(size_t(rows)*n);
+
+            for (int i = 0; i < rows; i++)
+                block->rows[i] = first + i;
+
+            for (int j = 0; j < n; j++)
+                std::copy(a + j*lda + first, a + j*lda + first + rows, block->values.data() + j*rows);
+
+            calu_select(n, *block);
+        }));
+    }
+
+    for (size_t l = 1; l < levels.size(); l++)
+    {
+        const int below = static_cast<int>(levels[l-1].size());
+
+        for (int p = 0; p < static_cast<int>(levels[l].size()); p++)
+        {
+            pivot_candidates<value_type>* node = &levels[l][p];
+            pivot_candidates<value_type>* children = &levels[l-1][p*arity];
+            const int count = std::min(arity, below - p*arity);
+
+            int task_id = graph.add([=] {
+                // stack the winners of the children
+                int rows = 0;
+                for (int c = 0; c < count; c++)
+                    rows += static_cast<int>(children[c].rows.size());
+
+                node->values.resize(size_t(rows)*n);
+
+                for (int c = 0, offset = 0; c < count; c++)
+                {
+                    const int k = static_cast<int>(children[c].rows.size());
+                    node->rows.insert(node->rows.end(), children[c].rows.begin(), children[c].rows.end());
+
+                    for (int j = 0; j < n; j++)
+                        std::copy(children[c].values.data() + j*k, children[c].values.data() + (j+1)*k, node->values.data() + j*rows + offset);
+
+                    offset += k;
+                }
+
+                calu_select(n, *node);
+            });
+
+            for (int c = 0; c < count; c++)
+                graph.depend(task_id, task_ids[l-1][p*arity + c]);
+
+            task_ids[l].push_back(task_id);
+        }
+    }
+
+    // move the winners to the top, recording the interchanges as LAPACK does, and factor the
+    // top block, keeping a copy in case it pivots after all
+    bool pivoted = false;
+
+    const int top_id = graph.add([&] {
+        const std::vector<int>& winners = levels.back().front().rows;
+
+        std::vector<int> row_at(m);
+        std::vector<int> position(m);
+        for (int i = 0; i < m; i++)
+            row_at[i] = position[i] = i;
+
+        for (int i = 0; i < n; i++)
+        {
+            const int p = position[winners[i]];
+            ipiv[i] = p + 1;
+
+            swap_rows(n, a, lda, i, p);
+            std::swap(row_at[i], row_at[p]);
+            position[row_at[i]] = i;
+            position[row_at[p]] = p;
+        }
+
+        std::vector<value_type> top(size_t(n)*n);
+        for (int j = 0; j < n; j++)
+            std::copy(a + j*lda, a + j*lda + n, top.data() + j*n);
+
+        std::vector<int> top_pivots(n);
+        lapack::getrf(n, n, a, lda, top_pivots.data(), info);
+
+        pivoted = (info != 0);
+        for (int i = 0; i < n; i++)
+            pivoted = pivoted || (top_pivots[i] != i+1);
+
+        if (pivoted)
+        {
+            for (int j = 0; j < n; j++)
+                std::copy(top.data() + j*n, top.data() + (j+1)*n, a + j*lda);
+
+            for (int i = n-1; i >= 0; i--)
+                swap_rows(n, a, lda, i, ipiv[i]-1);
+
+            lapack::getrf(m, n, a, lda, ipiv, info);
+        }
+    });
+
+    graph.depend(top_id, task_ids.back().front());
+
+    // l = a * inv(u) for the rows below, a block at a time, unless the panel was factored with
+    // partial pivoting instead
+    for (int i = n; i < m; i += block_rows)
+    {
+        const int rows = std::min(block_rows, m-i);
+        value_type* a_block = a + i;
+
+        int task_id = graph.add([=, &pivoted] {
+            if (!pivoted)
+                lapack::trsm('R', 'U', 'N', 'N', rows, n, value_type(1), a, lda, a_block, lda);
+        });
+
+        graph.depend(task_id, top_id);
+    }
+
+    // the tournament and the solves share the threads of the pool
+    graph.run(workers);
+}
+
+//
+// Host Wrapper
+//
+
+namespace host {
+
+// with panel_pivoting::tournament the panel is factored by getrf_calu on the threads of 
+// workers, a pool the caller keeps for all of its panels (or, without one, on a pool of every
+// hardware thread but the calling one started for this panel)
+template <enum class ordering storage_type, typename value_type>
+void getrf(host_panel<value_type>& panel, int* ipiv, panel_pivoting pivoting = panel_pivoting::partial, worker_pool* workers = nullptr)
+{
+    const int m = get_rows<storage_type>(panel.get_view());
+    const int n = get_cols<storage_type>(panel.get_view());
+
+    // run host function (waits for the panel to arrive)
+    column_major_panel<storage_type, value_type> host_a(panel);
+
+    int info = 0;
+    if (pivoting == panel_pivoting::tournament && m >= n)
+    {
+        std::unique_ptr<worker_pool> local_workers;
+        if (workers == nullptr)
+        {
+            local_workers.reset(new worker_pool(std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1)));
+            workers = local_workers.get();
+        }
+
+        getrf_calu(m, n, host_a.data(), host_a.leading_dimension(), ipiv, info, *workers);
+    }
+    else
+    {
+        lapack::getrf(m, n, host_a.data(), host_a.leading_dimension(), ipiv, info);
+    }
+    host_a.store();
+
+    // copy from host to accelerator
+    // LAPACK completes the factorization of a singular panel, so upload before reporting it
+    panel.upload();
+
+    // check for errors
+    info_check(info);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void getrf(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv)
+{
+    // copy from acclerator to page-locked host memory
+    host_panel<value_type> panel(ctx.get_staging_pool(), a);
+
+    getrf<storage_type>(panel, ipiv.data());
+}
+
+} // namespace host
+
+//
+// Row Interchanges
+//
+// The interchanges k1:k2 of a pivot vector are composed once on the accelerator into a list
+// of (destination, source) row pairs, at most two rows per interchange, which can then be
+// applied to any number of column ranges. Applying the list moves every affected row in one
+// pass instead of one swap at a time: a tile per column reads all source elements into
+// registers and, after a barrier, writes them to their destinations. The rows k1:k2 lead the
+// list, so neighbouring threads touch neighbouring (column major) elements for most of it.
+//
+
+template <typename T>
+inline void swap(T& a, T& b) restrict(amp)
+{
+    T temp = a;
+    a = b;
+    b = temp;
+}
+
+// adds an offset to a vector of pivots on the accelerator
+inline void offset_pivots(const concurrency::accelerator_view& av, const concurrency::array_view<int,1>& ipiv, int offset)
+{
+    concurrency::parallel_for_each(av, ipiv.extent, [=] (concurrency::index<1> idx) restrict(amp)
+    {
+        ipiv[idx] += offset;
+    });
+}
+
+class row_permutation
+{
+public:
+    // interchanges composed by one tile; each thread moves up to two rows
+    static const int tile_size = 256;
+
+    // upper bound on the number of tiles used to apply the permutation
+    static const int max_tiles = 4096;
+
+    // the permutation can hold up to max_pivots interchanges
+    row_permutation(device_pool& pool, int max_pivots)
+        : max_chunks(std::max(1, (max_pivots + tile_size - 1) / tile_size)),
+          chunks(0),
+          array_lists(pool, concurrency::extent<2>(max_chunks, 1 + 4*tile_size)),
+          lists(array_lists.get_view())
+    {}
+
+    // composes the interchanges k1:k2 of ipiv (Fortran indexing)
+    void compose(const concurrency::accelerator_view& av, const concurrency::array_view<const int,1>& ipiv, int k1, int k2)
+    {
+        using concurrency::index;
+
+        chunks = (k2 - k1 + tile_size - 1) / tile_size;
+
+        if (chunks > max_chunks)
+            runtime_error();
+
+        if (chunks == 0)
+            return;
+
+        // layout of each chunk: count, destinations, sources
+        concurrency::array_view<int,2> chunk_lists = lists;
+
+        concurrency::parallel_for_each(
+            av,
+            concurrency::extent<1>(chunks*tile_size).tile<tile_size>(),
+            [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                tile_static int dest[2*tile_size];
+                tile_static int src[2*tile_size];
+                tile_static int count;
+                tile_static int found;
+
+                const int tid = tidx.local[0];
+                const int chunk = tidx.tile[0];
+                const int first = k1 + chunk*tile_size;
+                const int last = (k2 < first + tile_size ? k2 : first + tile_size);
+                const int kc = last - first;
+
+                // the rows first:last are always listed, at the front
+                if (tid < kc)
+                {
+                    dest[tid] = first + tid;
+                    src[tid] = first + tid;
+                }
+
+                if (tid == 0)
+                {
+                    count = kc;
+                    found = -1;
+                }
+
+                tidx.barrier.wait();
+
+                for (int i = first; i < last; i++)
+                {
+                    const int ip = ipiv[index<1>(i)] - 1;
+                    const int in_block = (ip >= first && ip < last ? ip - first : -1);
+
+                    // look for a row outside first:last among those already listed
+                    if (in_block < 0)
+                    {
+                        for (int t = kc + tid; t < count; t += tile_size)
+                        {
+                            if (dest[t] == ip)
+                                found = t;
+                        }
+                    }
+
+                    tidx.barrier.wait();
+
+                    // interchange the contents of rows i and ip
+                    if (tid == 0)
+                    {
+                        int position = (in_block >= 0 ? in_block : found);
+
+                        if (position < 0)
+                        {
+                            position = count++;
+                            dest[position] = ip;
+                            src[position] = ip;
+                        }
+
+                        swap(src[i-first], src[position]);
+                        found = -1;
+                    }
+
+                    tidx.barrier.wait();
+                }
+
+                for (int t = tid; t < count; t += tile_size)
+                {
+                    chunk_lists(chunk, 1 + t) = dest[t];
+                    chunk_lists(chunk, 1 + 2*tile_size + t) = src[t];
+                }
+
+                if (tid == 0)
+                    chunk_lists(chunk, 0) = count;
+            }
+        );
+    }
+
+    // applies the composed interchanges (or their inverse, reversing the interchanges) to the
+    // rows of a
+    template <enum class ordering storage_type, typename value_type>
+    void apply(const concurrency::accelerator_view& av, const concurrency::array_view<value_type,2>& a, bool inverse = false) const
+    {
+        const int n = get_cols<storage_type>(a);
+
+        if (n == 0)
+            return;
+
+        const int tiles = std::min(n, int(max_tiles));
+        concurrency::array_view<const int,2> chunk_lists = lists;
+
+        // the inverse moves each row from its destination back to its source
+        const int to = (inverse ? 1 + 2*tile_size : 1);
+        const int from = (inverse ? 1 : 1 + 2*tile_size);
+
+        // chunks depend on each other and are applied in order (in reverse for the inverse)
+        for (int step = 0; step < chunks; step++)
+        {
+            const int chunk = (inverse ? chunks - 1 - step : step);
+
+            concurrency::parallel_for_each(
+                av,
+                concurrency::extent<1>(tiles*tile_size).tile<tile_size>(),
+                [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp)
+                {
+                    const int tid = tidx.local[0];
+                    const int count = chunk_lists(chunk, 0);
+
+                    for (int j = tidx.tile[0]; j < n; j += tiles)
+                    {
+                        value_type first_value = value_type();
+                        value_type second_value = value_type();
+
+                        if (tid < count)
+                            first_value = get_element<storage_type>(a, chunk_lists(chunk, from + tid), j);
+                        if (tid + tile_size < count)
+                            second_value = get_element<storage_type>(a, chunk_lists(chunk, from + tile_size + tid), j);
+
+                        tidx.barrier.wait_with_global_memory_fence();
+
+                        if (tid < count)
+                            get_element<storage_type>(a, chunk_lists(chunk, to + tid), j) = first_value;
+                        if (tid + tile_size < count)
+                            get_element<storage_type>(a, chunk_lists(chunk, to + tile_size + tid), j) = second_value;
+
+                        tidx.barrier.wait_with_global_memory_fence();
+                    }
+                }
+            );
+        }
+    }
+
+private:
+
+    // non-copyable
+    row_permutation(const row_permutation&);
+    row_permutation& operator=(const row_permutation&);
+
+    int max_chunks;
+    int chunks;
+    pooled_array<int> array_lists;
+    concurrency::array_view<int,2> lists;
+};
+
+// applies the interchanges k1:k2 of ipiv (Fortran indexing) to the rows of a, in reverse order 
+// if inverse is set
+template <enum class ordering storage_type, typename value_type>
+void laswp(context& ctx, const concurrency::array_view<value_type,2>& a, int k1, int k2, const concurrency::array_view<const int,1>& ipiv, bool inverse = false)
+{
+    row_permutation permutation(ctx.get_pool(), k2-k1);
+    permutation.compose(ctx.get_view(), ipiv, k1, k2);
+    permutation.apply<storage_type>(ctx.get_view(), a, inverse);
+}
+
+//
+// Accelerator Panel Factorization
+//
+
+namespace accl {
+
+// unblocked right looking factorization of an m by n panel (n <= m) in place on the accelerator
+//
+// Each column takes two kernels: a single tile finds the pivot, records it and swaps the rows
+// across the panel, then one thread per row below the diagonal scales the multiplier and applies
+// the rank-1 update to the rest of its row. Pivots are written with the offset already applied
+// (Fortran indexing) and the first exactly singular column is recorded in info, both without
+// involving the host.
+template <enum class ordering storage_type, typename value_type>
+void getf2(const concurrency::accelerator_view& av, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<int,1>& ipiv, const concurrency::array_view<int,1>& info, int offset)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    using concurrency::index;
+    using concurrency::extent;
+
+    static const int tile_size = 256;
+
+    const int m = get_rows<storage_type>(a);
+    const int n = get_cols<storage_type>(a);
+
+    for (int jj = 0; jj < n; jj++)
+    {
+        // pivot search and row interchange
+        concurrency::parallel_for_each(
+            av,
+            extent<1>(tile_size).tile<tile_size>(),
+            [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp)
+            {
+                tile_static real_type tile_value[tile_size];
+                tile_static int tile_row[tile_size];
+
+                const int tid = tidx.local[0];
+
+                // strided search
+                real_type value = real_type(-1);
+                int row = jj;
+
+                for (int i = jj + tid; i < m; i += tile_size)
+                {
+                    real_type candidate = abs1(get_element<storage_type>(a, i, jj));
+
+                    if (candidate > value)
+                    {
+                        value = candidate;
+                        row = i;
+                    }
+                }
+
+                tile_value[tid] = value;
+                tile_row[tid] = row;
+                tidx.barrier.wait();
+
+                // tree reduction (ties go to the first row like i?amax)
+                for (int stride = tile_size/2; stride > 0; stride /= 2)
+                {
+                    if (tid < stride)
+                    {
+                        const real_type other_value = tile_value[tid+stride];
+                        const int other_row = tile_row[tid+stride];
+
+                        if (other_value > tile_value[tid] || (other_value == tile_value[tid] && other_row < tile_row[tid]))
+                        {
+                            tile_value[tid] = other_value;
+                            tile_row[tid] = other_row;
+                        }
+                    }
+
+                    tidx.barrier.wait();
+                }
+
+                const int p = tile_row[0];
+
+                if (tid == 0)
+                {
+                    ipiv[index<1>(jj)] = p + 1 + offset;
+
+                    if (tile_value[0] == real_type(0) && info[index<1>(0)] == 0)
+                        info[index<1>(0)] = jj + 1 + offset;
+                }
+
+                // swap rows across the panel
+                if (p != jj)
+                {
+                    for (int j = tid; j < n; j += tile_size)
+                        swap(get_element<storage_type>(a, p, j), get_element<storage_type>(a, jj, j));
+                }
+            }
+        );
+
+        // scale and rank-1 update
+        if (jj+1 < m)
+        {
+            concurrency::parallel_for_each(
+                av,
+                extent<1>(m-jj-1),
+                [=] (index<1> idx) restrict(amp)
+                {
+                    const int i = jj + 1 + idx[0];
+                    const value_type pivot = get_element<storage_type>(a, jj, jj);
+
+                    // an exactly singular column is left unscaled
+                    value_type l = get_element<storage_type>(a, i, jj);
+
+                    if (abs1(pivot) != real_type(0))
+                    {
+                        l = l * reciprocal(pivot);
+                        get_element<storage_type>(a, i, jj) = l;
+                    }
+
+                    for (int j = jj+1; j < n; j++)
+                        get_element<storage_type>(a, i, j) -= l * get_element<storage_type>(a, jj, j);
+                }
+            );
+        }
+    }
+}
+
+} // namespace accl
+
+//
+// Blocked Factorization
+//
+
+// applies the (composed) interchanges and updates of the panel at j (width jb) to the columns c1:c2
+template <enum class ordering storage_type, typename value_type>
+void getrf_update(const concurrency::accelerator_view& av, concurrency::array_view<value_type,2>& a, const row_permutation& permutation, int j, int jb, int c1, int c2)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const int m = get_rows<storage_type>(a);
+
+    if (c1 >= c2)
+        return;
+
+    // apply interchanges to columns c1:c2
+    {
+        int m_ = m;
+        int n_ = c2-c1;
+        array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(0,c1), extent<2>(m_,n_));
+
+        permutation.apply<storage_type>(av, a_sub);
+    }
+
+    // compute block row of U
+    {
+        int m_ = jb;
+        int n_ = c2-c1;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(m_,m_));
+        array_view<value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(j,c1), extent<2>(m_,n_));
+
+        trsm<storage_type>(av, ampblas::side::left, ampblas::uplo::lower, ampblas::transpose::no_trans, ampblas::diag::unit, value_type(1), a_sub, b_sub);
+    }
+
+    // update trailing matrix
+    if (j+jb < m)
+    {
+        int m_ = m-j-jb;
+        int n_ = c2-c1;
+        int k_ = jb;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,j), extent<2>(m_,k_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(j,c1), extent<2>(k_,n_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,c1), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::no_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
+    }
+}
+
+// TODO: a tuning framework
+const int getrf_block_size = 256;
+const int getrf_look_ahead_depth = 1;
+
+// queues a factorization with every panel factored in place by accl::getf2; the host never
+// waits for the accelerator and the pivots and the data error (0 if none) are left in 
+// accelerator views, valid once the queued work has completed
+template <int block_size, enum class ordering storage_type, typename value_type>
+void getrf_queue(context& ctx, concurrency::array_view<value_type,2>& a, const concurrency::array_view<int,1>& ipiv, const concurrency::array_view<int,1>& info)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const concurrency::accelerator_view& av = ctx.get_view();
+
+    // sizes
+    const int m = get_rows<storage_type>(a);
+    const int n = get_cols<storage_type>(a);
+    const int k = std::min(m,n);
+
+    // no data error so far
+    concurrency::parallel_for_each(av, info.extent, [=] (index<1> idx) restrict(amp) {
+        info[idx] = 0;
+    });
+
+    // interchanges of the current panel
+    row_permutation permutation(ctx.get_pool(), block_size);
+
+    // panel stepping
+    for (int j = 0; j < k; j += block_size)
+    {
+        // current block size
+        int jb = std::min(block_size, k-j);
+
+        // factor diagonal and subdiagonal blocks and test for exact singularity
+        {
+            int m_ = m-j;
+            int n_ = jb;
+            array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(m_,n_)); 
+            array_view<int,1> ipiv_sub = ipiv.section(index<1>(j), extent<1>(n_)); 
+
+            // pivots are offset by the kernel
+            accl::getf2<storage_type>(av, a_sub, ipiv_sub, info, j);
+        }
+
+        // compose the interchanges of the panel
+        permutation.compose(av, ipiv, j, j+jb);
+
+        // apply interchanges to columns 1:j
+        if (j > 0)
+        {
+            int m_ = m;
+            int n_ = j;
+            array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(0,0), extent<2>(m_,n_));
+
+            permutation.apply<storage_type>(av, a_sub);
+        }
+
+        // apply to rest of matrix
+        if (j+jb < n)
+        {
+            getrf_update<storage_type>(av, a, permutation, j, jb, j+jb, n);
+            ctx.get_view().flush();
+        }
+    }
+}
+
+// Look ahead: after a panel is factored the next look_ahead_depth panels are updated
+// first and the download of the next panel is queued before the rest of the trailing 
+// matrix. The host then factors the next panel while the accelerator runs the large 
+// trailing update. A depth of 0 gives the plain right-looking algorithm.
+//
+// With block_factor_location::accelerator the factorization is queued by getrf_queue and 
+// nothing but the pivots and the final data error is moved to the host.
+template <int block_size, int look_ahead_depth, enum class ordering storage_type, enum class block_factor_location location, typename value_type>
+void getrf(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    static_assert(look_ahead_depth >= 0, "look ahead depth must not be negative");
+
+    const concurrency::accelerator_view& av = ctx.get_view();
+
+    // data error
+    int info = 0;
+    
+    // sizes
+    const int m = get_rows<storage_type>(a);
+    const int n = get_cols<storage_type>(a);
+    const int k = std::min(m,n);
+
+    // pivots are kept on the accelerator until the end so that the host never has to wait
+    // for queued work to read them back
+    pooled_array<int> array_pivots(ctx.get_pool(), extent<2>(1,std::max(k,1)));
+    array_view<int,1> pivots = array_pivots.get_view()[0];
+
+    if (location == block_factor_location::accelerator)
+    {
+        // first singular column found by the accelerator panel factorization
+        pooled_array<int> array_info(ctx.get_pool(), extent<2>(1,1));
+        array_view<int,1> accl_info = array_info.get_view()[0];
+
+        getrf_queue<block_size, storage_type>(ctx, a, pivots, accl_info);
+
+        // return the pivots
+        if (k > 0)
+            concurrency::copy(pivots.section(index<1>(0), extent<1>(k)), ipiv.section(index<1>(0), extent<1>(k)));
+
+        // rethrow data error (if any)
+        concurrency::copy(accl_info, &info);
+        if (info)
+            data_error(info);
+
+        return;
+    }
+
+    // the next panel to be factored, if its download has already been started
+    std::unique_ptr<host_panel<value_type>> next_panel;
+
+    // host threads of the tournament, started once for all of the panels
+    std::unique_ptr<worker_pool> workers;
+    if (ctx.get_panel_pivoting() == panel_pivoting::tournament)
+        workers.reset(new worker_pool(std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1)));
+
+    // host pivots of the current panel
+    std::vector<int> panel_pivots(block_size);
+
+    // interchanges of the current panel
+    row_permutation permutation(ctx.get_pool(), block_size);
+
+    // panel stepping
+    for (int j = 0; j < k; j += block_size)
+    {
+        // current block size
+        int jb = std::min(block_size, k-j);
+
+        // factor diagonal and subdiagonal blocks and test for exact singularity
+        {
+            int m_ = m-j;
+            int n_ = jb;
+            int k_ = std::min(m_,n_);
+
+            try 
+            {
+                if (!next_panel)
+                {
+                    array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(m_,n_)); 
+                    next_panel.reset(new host_panel<value_type>(ctx.get_staging_pool(), a_sub));
+                }
+
+                std::unique_ptr<host_panel<value_type>> panel(std::move(next_panel));
+                host::getrf<storage_type>(*panel, panel_pivots.data(), ctx.get_panel_pivoting(), workers.get());
+            }
+            catch(const data_error_exception& e)
+            {
+                // offset data error (do not rethrow) 
+                info = j + e.get();
+            }
+        
+            // move the pivots to the accelerator and offset them there
+            array_view<int,1> pivots_sub = pivots.section(index<1>(j), extent<1>(k_)); 
+            concurrency::copy(panel_pivots.begin(), panel_pivots.begin() + k_, pivots_sub);
+            offset_pivots(av, pivots_sub, j);
+        }
+
+        // compose the interchanges of the panel
+        permutation.compose(av, pivots, j, j+jb);
+
+        // apply interchanges to columns 1:j
+        if (j > 0)
+        {
+            int m_ = m;
+            int n_ = j;
+            array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(0,0), extent<2>(m_,n_));
+
+            permutation.apply<storage_type>(av, a_sub);
+        }
+
+        // apply to rest of matrix
+        if (j+jb < n)
+        {
+            // update the look ahead panels
+            const int ahead = std::min(n, j+jb+look_ahead_depth*block_size);
+            getrf_update<storage_type>(av, a, permutation, j, jb, j+jb, ahead);
+
+            // start moving the next panel to the host ahead of the trailing update
+            if (look_ahead_depth > 0 && j+jb < k)
+            {
+                int m_ = m-j-jb;
+                int n_ = std::min(block_size, k-j-jb);
+                array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,j+jb), extent<2>(m_,n_)); 
+                next_panel.reset(new host_panel<value_type>(ctx.get_staging_pool(), a_sub));
+            }
+
+            // update the remaining trailing matrix (overlaps the next host factorization)
+            getrf_update<storage_type>(av, a, permutation, j, jb, ahead, n);
+            ctx.get_view().flush();
+        }
+    }
+
+    // return the pivots
+    if (k > 0)
+        concurrency::copy(pivots.section(index<1>(0), extent<1>(k)), ipiv.section(index<1>(0), extent<1>(k)));
+
+    // rethrow data error (if any)
+    if (info)
+        data_error(info);
+}
+
+// solves op(a) * x = b with the factors and pivots of an n by n getrf (p * a = l * u), 
+// overwriting b with x; nothing is moved between the host and the accelerator
+template <enum class ordering storage_type, typename value_type>
+void getrs(context& ctx, ampblas::transpose trans, const concurrency::array_view<const value_type,2>& a, const concurrency::array_view<const int,1>& ipiv, concurrency::array_view<value_type,2>& b)
+{
+    const int n = get_rows<storage_type>(a);
+
+    if (trans == ampblas::transpose::no_trans)
+    {
+        // b = p * b
+        laswp<storage_type>(ctx, b, 0, n, ipiv);
+
+        // b = inv(l) * b
+        trsm<storage_type>(ctx.get_view(), ampblas::side::left, ampblas::uplo::lower, ampblas::transpose::no_trans, ampblas::diag::unit, value_type(1), a, b);
+
+        // b = inv(u) * b
+        trsm<storage_type>(ctx.get_view(), ampblas::side::left, ampblas::uplo::upper, ampblas::transpose::no_trans, ampblas::diag::non_unit, value_type(1), a, b);
+    }
+    else
+    {
+        // b = inv(op(u)) * b
+        trsm<storage_type>(ctx.get_view(), ampblas::side::left, ampblas::uplo::upper, trans, ampblas::diag::non_unit, value_type(1), a, b);
+
+        // b = inv(op(l)) * b
+        trsm<storage_type>(ctx.get_view(), ampblas::side::left, ampblas::uplo::lower, trans, ampblas::diag::unit, value_type(1), a, b);
+
+        // b = p' * b
+        laswp<storage_type>(ctx, b, 0, n, ipiv, true);
+    }
+}
+
+//
+// Forwarding Function
+//
+
+// this is a work around until VS std::bind can accept more paramaters
+template <typename value_type>
+struct getrf_params
+{
+    int m;
+    int n; 
+    value_type* a; 
+    int lda; 
+    int* ipiv;
+
+    getrf_params(int m, int n, value_type* a, int lda, int* ipiv)
+        : m(m), n(n), a(a), lda(lda), ipiv(ipiv) 
+    {}
+};
+
+template <enum class execution_target target, typename value_type>
+void getrf_unpack(context& ctx, const getrf_params<value_type>& p)
+{
+    amplapack::getrf<target>(ctx, p.m, p.n, p.a, p.lda, p.ipiv); 
+}
+
+template <enum class execution_target target, typename value_type>
+void getrf_async_unpack(context& ctx, async_call& call, const getrf_params<value_type>& p)
+{
+    amplapack::getrf_async<target>(ctx, p.m, p.n, p.a, p.lda, p.ipiv, call); 
+}
+
+template <typename value_type>
+struct getrs_params
+{
+    char trans;
+    int n;
+    int nrhs;
+    const value_type* a;
+    int lda;
+    const int* ipiv;
+    value_type* b;
+    int ldb;
+
+    getrs_params(char trans, int n, int nrhs, const value_type* a, int lda, const int* ipiv, value_type* b, int ldb)
+        : trans(trans), n(n), nrhs(nrhs), a(a), lda(lda), ipiv(ipiv), b(b), ldb(ldb)
+    {}
+};
+
+template <enum class execution_target target, typename value_type>
+void getrs_unpack(context& ctx, const getrs_params<value_type>& p)
+{
+    amplapack::getrs<target>(ctx, p.trans, p.n, p.nrhs, p.a, p.lda, p.ipiv, p.b, p.ldb); 
+}
+
+template <typename value_type>
+struct gesv_params
+{
+    int n;
+    int nrhs;
+    value_type* a;
+    int lda;
+    int* ipiv;
+    value_type* b;
+    int ldb;
+
+    gesv_params(int n, int nrhs, value_type* a, int lda, int* ipiv, value_type* b, int ldb)
+        : n(n), nrhs(nrhs), a(a), lda(lda), ipiv(ipiv), b(b), ldb(ldb)
+    {}
+};
+
+template <enum class execution_target target, typename value_type>
+void gesv_unpack(context& ctx, const gesv_params<value_type>& p)
+{
+    amplapack::gesv<target>(ctx, p.n, p.nrhs, p.a, p.lda, p.ipiv, p.b, p.ldb); 
+}
+
+} // namespace _detail
+
+//
+// Array View Interface
+// 
+
+template <enum class ordering storage_type, enum class block_factor_location location, typename value_type>
+void getrf(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv)
+{
+    _detail::getrf<_detail::getrf_block_size, _detail::getrf_look_ahead_depth, storage_type, location>(ctx, a, ipiv);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void getrf(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv)
+{
+    getrf<storage_type, block_factor_location::host>(ctx, a, ipiv);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void getrf(const concurrency::accelerator_view& av, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv)
+{
+    context ctx(av);
+    getrf<storage_type>(ctx, a, ipiv);
+}
+
+// queues the factorization on the accelerator (as block_factor_location::accelerator) and 
+// returns without waiting for it; ipiv and info (the first exactly singular column, 0 if none)
+// are written by the queued work and are valid once the returned future has completed
+template <enum class ordering storage_type, typename value_type>
+concurrency::completion_future getrf_async(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv, concurrency::array_view<int,1>& info)
+{
+    _detail::getrf_queue<_detail::getrf_block_size, storage_type>(ctx, a, ipiv, info);
+    return ctx.get_view().create_marker();
+}
+
+// solves op(a) * x = b with the factors and pivots returned by getrf, overwriting b with x; 
+// a and ipiv may stay on the accelerator between the factorization and any number of solves
+template <enum class ordering storage_type, typename value_type>
+void getrs(context& ctx, enum class transpose trans, const concurrency::array_view<const value_type,2>& a, const concurrency::array_view<const int,1>& ipiv, concurrency::array_view<value_type,2>& b)
+{
+    _detail::getrs<storage_type>(ctx, _detail::to_ampblas(trans), a, ipiv, b);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void getrs(const concurrency::accelerator_view& av, enum class transpose trans, const concurrency::array_view<const value_type,2>& a, const concurrency::array_view<const int,1>& ipiv, concurrency::array_view<value_type,2>& b)
+{
+    context ctx(av);
+    getrs<storage_type>(ctx, trans, a, ipiv, b);
+}
+
+// factors a and solves a * x = b, overwriting a with its factors and b with x
+template <enum class ordering storage_type, enum class block_factor_location location, typename value_type>
+void gesv(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv, concurrency::array_view<value_type,2>& b)
+{
+    getrf<storage_type, location>(ctx, a, ipiv);
+    getrs<storage_type, value_type>(ctx, transpose::no_trans, a, ipiv, b);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void gesv(context& ctx, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv, concurrency::array_view<value_type,2>& b)
+{
+    gesv<storage_type, block_factor_location::host>(ctx, a, ipiv, b);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void gesv(const concurrency::accelerator_view& av, concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& ipiv, concurrency::array_view<value_type,2>& b)
+{
+    context ctx(av);
+    gesv<storage_type>(ctx, a, ipiv, b);
+}
+
+//
+// Host Interface Function
+//
+
+template <enum class execution_target target, typename value_type>
+void getrf(context& ctx, int m, int n, value_type* a, int lda, int* ipiv)
+{
+    // quick return
+    if (n == 0 || m == 0)
+        return;
+
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < m)
+        argument_error(5);
+    if (ipiv == nullptr)
+        argument_error(6);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        int info;
+        _detail::lapack::getrf(m, n, a, lda, ipiv, info);
+        info_check(info);
+        return;
+    }
+
+    // host views
+    concurrency::array_view<value_type,2> host_view_a(n, lda, a);
+    concurrency::array_view<value_type,2> host_view_a_sub = host_view_a.section(concurrency::index<2>(0,0), concurrency::extent<2>(n,m));
+    concurrency::array_view<int,1> host_view_ipiv(std::min(m,n), ipiv);
+
+    // accelerator copy of a (drawn from the context's pool)
+    pooled_array<value_type> accl_a(ctx.get_pool(), host_view_a_sub.extent);
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::copy(host_view_a_sub, accl_view_a);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+    // forwarding to array view interface
+    getrf<ordering::column_major, (target == execution_target::accelerator ? block_factor_location::accelerator : block_factor_location::host)>(ctx, accl_view_a, host_view_ipiv);
+
+    // copy back to host
+    concurrency::copy(accl_view_a, host_view_a_sub);
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_a.extent));
+}
+
+template <typename value_type>
+void getrf(context& ctx, int m, int n, value_type* a, int lda, int* ipiv)
+{
+    getrf<execution_target::hybrid>(ctx, m, n, a, lda, ipiv);
+}
+
+template <typename value_type>
+void getrf(concurrency::accelerator_view& av, int m, int n, value_type* a, int lda, int* ipiv)
+{
+    context ctx(av);
+    getrf(ctx, m, n, a, lda, ipiv);
+}
+
+// queues getrf and returns once a has been uploaded; a and ipiv are written back by copies
+// owned by call, which reports the data error when waited on. The host target factors a 
+// before returning.
+template <enum class execution_target target, typename value_type>
+void getrf_async(context& ctx, int m, int n, value_type* a, int lda, int* ipiv, async_call& call)
+{
+    // quick return
+    if (n == 0 || m == 0)
+        return;
+
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < m)
+        argument_error(5);
+    if (ipiv == nullptr)
+        argument_error(6);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        _detail::lapack::getrf(m, n, a, lda, ipiv, *call.get_info());
+        return;
+    }
+
+    const int k = std::min(m,n);
+
+    // host views
+    concurrency::array_view<value_type,2> host_view_a(n, lda, a);
+    concurrency::array_view<value_type,2> host_view_a_sub = host_view_a.section(concurrency::index<2>(0,0), concurrency::extent<2>(n,m));
+    concurrency::array_view<int,1> host_view_ipiv(k, ipiv);
+
+    // accelerator copies owned by the call until it completes (drawn from the context's pool)
+    pooled_array<value_type>& accl_a = call.hold(new pooled_array<value_type>(ctx.get_pool(), host_view_a_sub.extent));
+    pooled_array<int>& accl_ipiv = call.hold(new pooled_array<int>(ctx.get_pool(), concurrency::extent<2>(1,k)));
+    pooled_array<int>& accl_info = call.hold(new pooled_array<int>(ctx.get_pool(), concurrency::extent<2>(1,1)));
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::array_view<int,1> accl_view_ipiv = accl_ipiv.get_view()[0];
+    concurrency::array_view<int,1> accl_view_info = accl_info.get_view()[0];
+
+    concurrency::copy(host_view_a_sub, accl_view_a);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+    _detail::getrf_queue<_detail::getrf_block_size, ordering::column_major>(ctx, accl_view_a, accl_view_ipiv, accl_view_info);
+
+    // copies back to host (complete the call)
+    call.add(concurrency::copy_async(accl_view_a, host_view_a_sub));
+    call.add(concurrency::copy_async(accl_view_ipiv, host_view_ipiv));
+    call.add(concurrency::copy_async(accl_view_info, call.get_info()));
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_a.extent));
+}
+
+template <typename value_type>
+void getrf_async(context& ctx, int m, int n, value_type* a, int lda, int* ipiv, async_call& call)
+{
+    getrf_async<execution_target::accelerator>(ctx, m, n, a, lda, ipiv, call);
+}
+
+template <enum class execution_target target, typename value_type>
+void getrs(context& ctx, char trans, int n, int nrhs, const value_type* a, int lda, const int* ipiv, value_type* b, int ldb)
+{
+    // quick return
+    if (n == 0 || nrhs == 0)
+        return;
+
+    // error checking
+    trans = static_cast<char>(toupper(trans));
+
+    if (trans != 'N' && trans != 'T' && trans != 'C')
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (nrhs < 0)
+        argument_error(4);
+    if (a == nullptr)
+        argument_error(5);
+    if (lda < n)
+        argument_error(6);
+    if (ipiv == nullptr)
+        argument_error(7);
+    if (b == nullptr)
+        argument_error(8);
+    if (ldb < n)
+        argument_error(9);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        int info;
+        _detail::lapack::getrs(trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+        info_check(info);
+        return;
+    }
+
+    // host views
+    concurrency::array_view<const value_type,2> host_view_a = concurrency::array_view<const value_type,2>(n, lda, a).section(concurrency::index<2>(0,0), concurrency::extent<2>(n,n));
+    concurrency::array_view<value_type,2> host_view_b = concurrency::array_view<value_type,2>(nrhs, ldb, b).section(concurrency::index<2>(0,0), concurrency::extent<2>(nrhs,n));
+    concurrency::array_view<const int,1> host_view_ipiv(n, ipiv);
+
+    // accelerator copies (drawn from the context's pool)
+    pooled_array<value_type> accl_a(ctx.get_pool(), host_view_a.extent);
+    pooled_array<value_type> accl_b(ctx.get_pool(), host_view_b.extent);
+    pooled_array<int> accl_ipiv(ctx.get_pool(), concurrency::extent<2>(1,n));
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::array_view<value_type,2> accl_view_b = accl_b.get_view();
+    concurrency::array_view<int,1> accl_view_ipiv = accl_ipiv.get_view()[0];
+
+    concurrency::copy(host_view_a, accl_view_a);
+    concurrency::copy(host_view_b, accl_view_b);
+    concurrency::copy(host_view_ipiv, accl_view_ipiv);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent) + get_bytes<value_type>(accl_view_b.extent) + get_bytes<int>(accl_view_ipiv.extent));
+
+    // forwarding to array view interface
+    getrs<ordering::column_major, value_type>(ctx, to_transpose_option(trans), accl_view_a, accl_view_ipiv, accl_view_b);
+
+    // copy back to host
+    concurrency::copy(accl_view_b, host_view_b);
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_b.extent));
+}
+
+template <typename value_type>
+void getrs(context& ctx, char trans, int n, int nrhs, const value_type* a, int lda, const int* ipiv, value_type* b, int ldb)
+{
+    getrs<execution_target::hybrid>(ctx, trans, n, nrhs, a, lda, ipiv, b, ldb);
+}
+
+// the factors only cross to the host once, after the solve
+template <enum class execution_target target, typename value_type>
+void gesv(context& ctx, int n, int nrhs, value_type* a, int lda, int* ipiv, value_type* b, int ldb)
+{
+    // quick return
+    if (n == 0)
+        return;
+
+    // error checking
+    if (n < 0)
+        argument_error(2);
+    if (nrhs < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < n)
+        argument_error(5);
+    if (ipiv == nullptr)
+        argument_error(6);
+    if (b == nullptr && nrhs > 0)
+        argument_error(7);
+    if (ldb < n)
+        argument_error(8);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        int info;
+        _detail::lapack::getrf(n, n, a, lda, ipiv, info);
+        info_check(info);
+
+        if (nrhs > 0)
+        {
+            _detail::lapack::getrs('N', n, nrhs, a, lda, ipiv, b, ldb, info);
+            info_check(info);
+        }
+
+        return;
+    }
+
+    // host views
+    concurrency::array_view<value_type,2> host_view_a = concurrency::array_view<value_type,2>(n, lda, a).section(concurrency::index<2>(0,0), concurrency::extent<2>(n,n));
+    concurrency::array_view<int,1> host_view_ipiv(n, ipiv);
+
+    // accelerator copy of a (drawn from the context's pool)
+    pooled_array<value_type> accl_a(ctx.get_pool(), host_view_a.extent);
+    pooled_array<int> accl_ipiv(ctx.get_pool(), concurrency::extent<2>(1,n));
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::array_view<int,1> accl_view_ipiv = accl_ipiv.get_view()[0];
+
+    concurrency::copy(host_view_a, accl_view_a);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+    auto copy_back = [&] {
+        concurrency::copy(accl_view_a, host_view_a);
+        concurrency::copy(accl_view_ipiv, host_view_ipiv);
+        ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_a.extent) + get_bytes<int>(accl_view_ipiv.extent));
+    };
+
+    // factor and solve on the accelerator
+    try
+    {
+        getrf<ordering::column_major, (target == execution_target::accelerator ? block_factor_location::accelerator : block_factor_location::host)>(ctx, accl_view_a, accl_view_ipiv);
+    }
+    catch(const data_error_exception&)
+    {
+        // as LAPACK, return the factors and pivots of an exactly singular u
+        copy_back();
+        throw;
+    }
+
+    if (nrhs > 0)
+    {
+        concurrency::array_view<value_type,2> host_view_b = concurrency::array_view<value_type,2>(nrhs, ldb, b).section(concurrency::index<2>(0,0), concurrency::extent<2>(nrhs,n));
+
+        pooled_array<value_type> accl_b(ctx.get_pool(), host_view_b.extent);
+        concurrency::array_view<value_type,2> accl_view_b = accl_b.get_view();
+
+        concurrency::copy(host_view_b, accl_view_b);
+        ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_b.extent));
+
+        getrs<ordering::column_major, value_type>(ctx, transpose::no_trans, accl_view_a, accl_view_ipiv, accl_view_b);
+
+        concurrency::copy(accl_view_b, host_view_b);
+        ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_b.extent));
+    }
+
+    // copy back to host
+    copy_back();
+}
+
+template <typename value_type>
+void gesv(context& ctx, int n, int nrhs, value_type* a, int lda, int* ipiv, value_type* b, int ldb)
+{
+    gesv<execution_target::hybrid>(ctx, n, nrhs, a, lda, ipiv, b, ldb);
+}
+
+// pooled device memory (in bytes) used by the host interface for an m by n problem
+template <typename value_type>
+size_t getrf_workspace(int m, int n)
+{
+    workspace_query query;
+
+    // accelerator copy of a
+    query.add<value_type>(concurrency::extent<2>(n,m));
+
+    // pivots and the interchange lists of a panel
+    query.add<int>(concurrency::extent<2>(1,std::max(std::min(m,n),1)));
+    query.add<int>(concurrency::extent<2>(1,1+4*_detail::row_permutation::tile_size));
+
+    return query.get_bytes();
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_GETRF_H
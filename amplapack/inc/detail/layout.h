@@ -0,0 +1,189 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* layout.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_LAYOUT_H
+#define AMPLAPACK_LAYOUT_H
+
+#include <memory>
+#include <utility>
+
+#include "amplapack_config.h"
+
+namespace amplapack {
+namespace _detail {
+
+//
+// Data Layout
+//
+// The factorizations address their matrices through get_sub_matrix and get_element, so they 
+// run on either ordering. The two places that only understand column major storage are 
+// adapted here: AMP BLAS, which sees a row major matrix as its transpose, and the host 
+// LAPACK library, which is handed a column major copy of a row major panel.
+//
+
+// AMP BLAS counterpart of a transpose option
+inline ampblas::transpose to_ampblas(enum class transpose trans)
+{
+    switch (trans)
+    {
+    case transpose::trans:
+        return ampblas::transpose::trans;
+    case transpose::conj_trans:
+        return ampblas::transpose::conj_trans;
+    case transpose::no_trans:
+    default:
+        return ampblas::transpose::no_trans;
+    }
+}
+
+// C = alpha * op(A) * op(B) + beta * C
+//
+// In row major order every operand appears transposed, so the product is formed as
+// C' = op(B)' * op(A)' with the same transpose options.
+template <enum class ordering storage_type, typename value_type>
+void gemm(const concurrency::accelerator_view& av, ampblas::transpose transa, ampblas::transpose transb, value_type alpha, const concurrency::array_view<const value_type,2>& a, const concurrency::array_view<const value_type,2>& b, value_type beta, concurrency::array_view<value_type,2>& c)
+{
+    if (storage_type == ordering::row_major)
+        ampblas::link::gemm(av, transb, transa, alpha, b, a, beta, c);
+    else
+        ampblas::link::gemm(av, transa, transb, alpha, a, b, beta, c);
+}
+
+// op(A) * X = alpha * B (left) or X * op(A) = alpha * B (right)
+//
+// In row major order the system is solved as X' * op(A)' = alpha * B' (or its left sided
+// counterpart), where the transpose of a triangle is the opposite triangle.
+template <enum class ordering storage_type, typename value_type>
+void trsm(const concurrency::accelerator_view& av, ampblas::side side, ampblas::uplo uplo, ampblas::transpose transa, ampblas::diag diag, value_type alpha, const concurrency::array_view<const value_type,2>& a, concurrency::array_view<value_type,2>& b)
+{
+    if (storage_type == ordering::row_major)
+    {
+        const ampblas::side side_t = (side == ampblas::side::left ? ampblas::side::right : ampblas::side::left);
+        const ampblas::uplo uplo_t = (uplo == ampblas::uplo::lower ? ampblas::uplo::upper : ampblas::uplo::lower);
+
+        ampblas::link::trsm(av, side_t, uplo_t, transa, diag, alpha, a, b);
+    }
+    else
+    {
+        ampblas::link::trsm(av, side, uplo, transa, diag, alpha, a, b);
+    }
+}
+
+// C = alpha * op(A) * op(A)' + beta * C, referencing the uplo triangle of C
+//
+// In row major order C appears as its transpose, the conjugate of a Hermitian C, which is
+// formed as op(A)' * op(A) in the opposite triangle.
+template <enum class ordering storage_type, typename value_type>
+void herk(const concurrency::accelerator_view& av, ampblas::uplo uplo, ampblas::transpose trans, typename ampblas::real_type<value_type>::type alpha, const concurrency::array_view<const value_type,2>& a, typename ampblas::real_type<value_type>::type beta, concurrency::array_view<value_type,2>& c)
+{
+    if (storage_type == ordering::row_major)
+    {
+        const ampblas::uplo uplo_t = (uplo == ampblas::uplo::lower ? ampblas::uplo::upper : ampblas::uplo::lower);
+        const ampblas::transpose trans_t = (trans == ampblas::transpose::no_trans ? ampblas::transpose::conj_trans : ampblas::transpose::no_trans);
+
+        ampblas::link::herk(av, uplo_t, trans_t, alpha, a, beta, c);
+    }
+    else
+    {
+        ampblas::link::herk(av, uplo, trans, alpha, a, beta, c);
+    }
+}
+
+// column major access to the host copy of a panel
+//
+// A column major panel is used in place. A row major panel is transposed into a scratch copy
+// on construction and back into the staging copy by store(); only the panel is transposed, 
+// never the whole matrix. The scratch is a second staging buffer drawn from the panel's pool,
+// so repeated panels reuse it rather than allocating.
+template <enum class ordering storage_type, typename value_type>
+class column_major_panel
+{
+public:
+    // waits for the panel to arrive
+    explicit column_major_panel(host_panel<value_type>& panel)
+        : panel(panel),
+          rows(get_rows<storage_type>(panel.get_view())),
+          cols(get_cols<storage_type>(panel.get_view()))
+    {
+        if (storage_type == ordering::row_major)
+        {
+            const value_type* a = panel.get();
+            scratch.reset(new staging_array<value_type>(panel.get_pool(), panel.get_view().extent));
+
+            value_type* s = scratch->data();
+
+            for (int i = 0; i < rows; i++)
+                for (int j = 0; j < cols; j++)
+                    s[j*rows+i] = a[i*cols+j];
+        }
+    }
+
+    value_type* data()
+    {
+        return (storage_type == ordering::row_major ? scratch->data() : panel.get());
+    }
+
+    int leading_dimension() const
+    {
+        return rows;
+    }
+
+    // writes the column major result back to the staging copy of the panel
+    void store()
+    {
+        if (storage_type == ordering::row_major)
+        {
+            value_type* a = panel.get();
+            const value_type* s = scratch->data();
+
+            for (int i = 0; i < rows; i++)
+                for (int j = 0; j < cols; j++)
+                    a[i*cols+j] = s[j*rows+i];
+        }
+    }
+
+private:
+
+    // non-copyable
+    column_major_panel(const column_major_panel&);
+    column_major_panel& operator=(const column_major_panel&);
+
+    host_panel<value_type>& panel;
+    int rows;
+    int cols;
+    std::unique_ptr<staging_array<value_type>> scratch;
+};
+
+// reorders a packed k by k column major block in place to the given ordering
+template <enum class ordering storage_type, typename value_type>
+void to_ordering(value_type* a, int k)
+{
+    if (storage_type == ordering::row_major)
+    {
+        for (int j = 0; j < k; j++)
+            for (int i = j+1; i < k; i++)
+                std::swap(a[j*k+i], a[i*k+j]);
+    }
+}
+
+} // namespace _detail
+} // namespace amplapack
+
+#endif // AMPLAPACK_LAYOUT_H
@@ -0,0 +1,676 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* multi_device.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_MULTI_DEVICE_H
+#define AMPLAPACK_MULTI_DEVICE_H
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "amplapack_config.h"
+#include "geqrf.h"
+#include "getrf.h"
+#include "potrf.h"
+
+namespace amplapack {
+namespace _detail {
+
+//
+// Distributed Layout
+//
+// An m by n column major matrix is cut into block columns of block_size columns that are 
+// dealt round robin over the views of a context group: block b lives on device b % p. Each 
+// device keeps its block columns side by side in one local column major array, so a range
+// of global columns maps to a contiguous range of local columns on every device. 
+//
+// The factorizations below factor each panel on the host from the device that owns it and
+// broadcast the result from the host to every other device. Each device then updates its 
+// own trailing columns, the owner of the next panel updating that panel first, so the
+// devices run their updates at the same time and the host factors the next panel while 
+// they finish. This is a one dimensional (block column) cyclic distribution: every panel
+// is held by a single device, so the host panel factorization needs no reduction across
+// devices.
+//
+
+template <typename value_type>
+class distributed_matrix
+{
+public:
+    distributed_matrix(context_group& group, int m, int n, int block_size)
+        : group(group), m(m), n(n), block_size(block_size)
+    {
+        for (int d = 0; d < group.size(); d++)
+        {
+            // devices without a block column still get a (minimal) array
+            const int local_columns = std::max(get_local_columns(d), 1);
+            local.push_back(std::unique_ptr<pooled_array<value_type>>(new pooled_array<value_type>(group[d].get_pool(), concurrency::extent<2>(local_columns, m))));
+        }
+    }
+
+    int get_rows() const
+    {
+        return m;
+    }
+
+    int get_cols() const
+    {
+        return n;
+    }
+
+    // the device holding the global column j
+    int get_owner(int j) const
+    {
+        return (j / block_size) % group.size();
+    }
+
+    // the first local column of device d at or after the global column j
+    int get_local_column(int d, int j) const
+    {
+        const int p = group.size();
+        const int b = j / block_size;
+
+        // block columns before b held by d
+        const int blocks = (b > d ? (b - d - 1) / p + 1 : 0);
+
+        return blocks * block_size + (b % p == d ? j % block_size : 0);
+    }
+
+    int get_local_columns(int d) const
+    {
+        return get_local_column(d, n);
+    }
+
+    concurrency::array_view<value_type,2> get_view(int d) const
+    {
+        return local[d]->get_view();
+    }
+
+    // moves the block columns of a host matrix to their devices; with conj_transpose set the 
+    // conjugate transpose of a (square) host matrix is distributed instead
+    void scatter(const value_type* a, int lda, bool conj_transpose = false)
+    {
+        std::vector<value_type> block;
+
+        for (int j = 0; j < n; j += block_size)
+        {
+            const int jb = std::min(block_size, n-j);
+            const int d = get_owner(j);
+
+            concurrency::array_view<value_type,2> local_block = get_view(d).section(concurrency::index<2>(get_local_column(d,j),0), concurrency::extent<2>(jb,m));
+
+            if (conj_transpose)
+            {
+                block.resize(jb*m);
+
+                for (int jj = 0; jj < jb; jj++)
+                    for (int i = 0; i < m; i++)
+                        block[jj*m+i] = conjugate(a[i*lda+j+jj]);
+
+                concurrency::copy(block.begin(), block.end(), local_block);
+            }
+            else
+            {
+                concurrency::array_view<const value_type,2> host_block(jb, lda, a + j*lda);
+                concurrency::copy(host_block.section(concurrency::index<2>(0,0), concurrency::extent<2>(jb,m)), local_block);
+            }
+
+            group[d].get_transfers().add_to_accelerator(get_bytes<value_type>(local_block.extent));
+        }
+    }
+
+    // the reverse of scatter
+    void gather(value_type* a, int lda, bool conj_transpose = false)
+    {
+        std::vector<value_type> block;
+
+        for (int j = 0; j < n; j += block_size)
+        {
+            const int jb = std::min(block_size, n-j);
+            const int d = get_owner(j);
+
+            concurrency::array_view<value_type,2> local_block = get_view(d).section(concurrency::index<2>(get_local_column(d,j),0), concurrency::extent<2>(jb,m));
+
+            if (conj_transpose)
+            {
+                block.resize(jb*m);
+                concurrency::copy(local_block, block.begin());
+
+                for (int jj = 0; jj < jb; jj++)
+                    for (int i = 0; i < m; i++)
+                        a[i*lda+j+jj] = conjugate(block[jj*m+i]);
+            }
+            else
+            {
+                concurrency::array_view<value_type,2> host_block(jb, lda, a + j*lda);
+                concurrency::copy(local_block, host_block.section(concurrency::index<2>(0,0), concurrency::extent<2>(jb,m)));
+            }
+
+            group[d].get_transfers().add_to_host(get_bytes<value_type>(local_block.extent));
+        }
+    }
+
+private:
+    // non-copyable
+    distributed_matrix(const distributed_matrix&);
+    distributed_matrix& operator=(const distributed_matrix&);
+
+    context_group& group;
+    int m;
+    int n;
+    int block_size;
+    std::vector<std::unique_ptr<pooled_array<value_type>>> local;
+};
+
+// a copy on device e of a panel factored on the host from device d; the owner uses the 
+// panel in place
+template <typename value_type>
+class panel_copy
+{
+public:
+    panel_copy(context& ctx, host_panel<value_type>& panel, bool owner)
+        : view(panel.get_view())
+    {
+        if (owner)
+            return;
+
+        array.reset(new pooled_array<value_type>(ctx.get_pool(), view.extent));
+        view = array->get_view();
+
+        const value_type* data = panel.get();
+        concurrency::copy(data, data + view.extent.size(), view);
+        ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(view.extent));
+    }
+
+    const concurrency::array_view<value_type,2>& get_view() const
+    {
+        return view;
+    }
+
+private:
+    // non-copyable
+    panel_copy(const panel_copy&);
+    panel_copy& operator=(const panel_copy&);
+
+    concurrency::array_view<value_type,2> view;
+    std::unique_ptr<pooled_array<value_type>> array;
+};
+
+namespace multi {
+
+//
+// LU Factorization
+//
+
+// applies the (composed) interchanges and updates of the panel at j (width jb), held in l 
+// (rows j:m), to the local columns c1:c2 of a
+template <typename value_type>
+void getrf_update(const concurrency::accelerator_view& av, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,2>& l, const row_permutation& permutation, int j, int jb, int c1, int c2)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const ordering storage_type = ordering::column_major;
+    const int m = get_rows<storage_type>(a);
+
+    if (c1 >= c2)
+        return;
+
+    // apply interchanges to columns c1:c2
+    permutation.apply<storage_type>(av, get_sub_matrix<storage_type>(a, index<2>(j,c1), extent<2>(m-j,c2-c1)));
+
+    // compute block row of U
+    {
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(l, index<2>(0,0), extent<2>(jb,jb));
+        array_view<value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(j,c1), extent<2>(jb,c2-c1));
+
+        trsm<storage_type>(av, ampblas::side::left, ampblas::uplo::lower, ampblas::transpose::no_trans, ampblas::diag::unit, value_type(1), a_sub, b_sub);
+    }
+
+    // update trailing matrix
+    if (j+jb < m)
+    {
+        int m_ = m-j-jb;
+        int n_ = c2-c1;
+        int k_ = jb;
+
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(l, index<2>(jb,0), extent<2>(m_,k_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(j,c1), extent<2>(k_,n_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,c1), extent<2>(m_,n_));
+
+        gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::no_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
+    }
+}
+
+template <int block_size, typename value_type>
+void getrf(context_group& group, distributed_matrix<value_type>& a, int* ipiv)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const int m = a.get_rows();
+    const int n = a.get_cols();
+    const int k = std::min(m,n);
+
+    // data error
+    int info = 0;
+
+    // host pivots of the current panel (relative to its first row)
+    std::vector<int> panel_pivots(block_size);
+
+    // host threads of the tournament, started for the first panel that needs them
+    std::unique_ptr<worker_pool> workers;
+
+    // panel stepping
+    for (int j = 0; j < k; j += block_size)
+    {
+        const int jb = std::min(block_size, k-j);
+        const int owner = a.get_owner(j);
+
+        // factor the panel on the host; this only waits for the owner's update of the panel
+        array_view<value_type,2> a_sub = get_sub_matrix<ordering::column_major>(a.get_view(owner), index<2>(j,a.get_local_column(owner,j)), extent<2>(m-j,jb));
+        host_panel<value_type> panel(group[owner].get_staging_pool(), a_sub);
+
+        if (!workers && group[owner].get_panel_pivoting() == panel_pivoting::tournament)
+            workers.reset(new worker_pool(std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1)));
+
+        try
+        {
+            host::getrf<ordering::column_major>(panel, panel_pivots.data(), group[owner].get_panel_pivoting(), workers.get());
+        }
+        catch(const data_error_exception& e)
+        {
+            // offset data error (do not rethrow)
+            if (info == 0)
+                info = j + e.get();
+        }
+
+        for (int i = 0; i < jb; i++)
+            ipiv[j+i] = panel_pivots[i] + j;
+
+        // broadcast the panel and update every device
+        for (int d = 0; d < group.size(); d++)
+        {
+            context& ctx = group[d];
+            const concurrency::accelerator_view& av = ctx.get_view();
+            array_view<value_type,2> a_local = a.get_view(d);
+
+            panel_copy<value_type> l(ctx, panel, d == owner);
+
+            pooled_array<int> array_pivots(ctx.get_pool(), extent<2>(1,jb));
+            array_view<int,1> pivots = array_pivots.get_view()[0];
+            concurrency::copy(panel_pivots.begin(), panel_pivots.begin() + jb, pivots);
+
+            // interchanges of the panel (rows j:m)
+            row_permutation permutation(ctx.get_pool(), jb);
+            permutation.compose(av, pivots, 0, jb);
+
+            // local columns left of the panel, right of it and past the next panel
+            const int left = a.get_local_column(d, j);
+            const int right = a.get_local_column(d, j+jb);
+            const int ahead = a.get_local_column(d, std::min(n, j+jb+block_size));
+            const int end = a.get_local_columns(d);
+
+            if (left > 0)
+                permutation.apply<ordering::column_major>(av, get_sub_matrix<ordering::column_major>(a_local, index<2>(j,0), extent<2>(m-j,left)));
+
+            // the next panel first, so that its owner can hand it to the host early
+            getrf_update(av, a_local, l.get_view(), permutation, j, jb, right, ahead);
+            av.flush();
+
+            getrf_update(av, a_local, l.get_view(), permutation, j, jb, ahead, end);
+            av.flush();
+        }
+    }
+
+    // rethrow data error (if any)
+    if (info)
+        data_error(info);
+}
+
+//
+// Cholesky Factorization
+//
+
+// updates the local block columns of a at or after the global column c with the solved
+// block column at j (width jb), held in l (rows j+jb:n); lower triangle only
+template <typename value_type>
+void potrf_update(const concurrency::accelerator_view& av, const distributed_matrix<value_type>& a, int d, const concurrency::array_view<value_type,2>& l, int j, int jb, int block_size)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    const ordering storage_type = ordering::column_major;
+    const int n = a.get_rows();
+    array_view<value_type,2> a_local = a.get_view(d);
+
+    for (int c = j+jb; c < n; c += block_size)
+    {
+        if (a.get_owner(c) != d)
+            continue;
+
+        const int cb = std::min(block_size, n-c);
+        const int lc = a.get_local_column(d, c);
+
+        // diagonal block
+        {
+            array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(l, index<2>(c-j-jb,0), extent<2>(cb,jb));
+            array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a_local, index<2>(c,lc), extent<2>(cb,cb));
+
+            herk<storage_type>(av, ampblas::uplo::lower, ampblas::transpose::no_trans, real_type(-1), a_sub, real_type(1), c_sub);
+        }
+
+        // below the diagonal block
+        if (c+cb < n)
+        {
+            int m_ = n-c-cb;
+            int n_ = cb;
+            int k_ = jb;
+
+            array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(l, index<2>(c+cb-j-jb,0), extent<2>(m_,k_));
+            array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(l, index<2>(c-j-jb,0), extent<2>(n_,k_));
+            array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a_local, index<2>(c+cb,lc), extent<2>(m_,n_));
+
+            gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::conj_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
+        }
+
+        // the next diagonal block first, so that its owner can hand it to the host early
+        if (c == j+jb)
+            av.flush();
+    }
+
+    av.flush();
+}
+
+// lower triangle; the upper triangle is factored as the lower triangle of the conjugate 
+// transpose (see the host interface)
+template <int block_size, typename value_type>
+void potrf(context_group& group, distributed_matrix<value_type>& a)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const ordering storage_type = ordering::column_major;
+    const int n = a.get_rows();
+
+    // block stepping
+    for (int j = 0; j < n; j += block_size)
+    {
+        const int jb = std::min(block_size, n-j);
+        const int owner = a.get_owner(j);
+        const int lj = a.get_local_column(owner, j);
+
+        context& owner_ctx = group[owner];
+        array_view<value_type,2> diagonal = get_sub_matrix<storage_type>(a.get_view(owner), index<2>(j,lj), extent<2>(jb,jb));
+
+        // factorize the diagonal block on the host
+        try
+        {
+            host::potrf<storage_type>(owner_ctx, uplo::lower, diagonal);
+        }
+        catch(const data_error_exception& e)
+        {
+            // offset local block error
+            data_error(e.get() + j);
+        }
+
+        if (j+jb == n)
+            break;
+
+        // the owner solves the block column below the diagonal block
+        array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a.get_view(owner), index<2>(j+jb,lj), extent<2>(n-j-jb,jb));
+        trsm<storage_type>(owner_ctx.get_view(), ampblas::side::right, ampblas::uplo::lower, ampblas::transpose::conj_trans, ampblas::diag::non_unit, value_type(1), diagonal, a_sub);
+
+        // broadcast the solved block column and update every device
+        host_panel<value_type> panel(owner_ctx.get_staging_pool(), a_sub);
+
+        for (int d = 0; d < group.size(); d++)
+        {
+            panel_copy<value_type> l(group[d], panel, d == owner);
+            potrf_update(group[d].get_view(), a, d, l.get_view(), j, jb, block_size);
+        }
+    }
+}
+
+//
+// QR Factorization
+//
+
+// per device working arrays of the block reflector update (see _detail::geqrf)
+template <typename value_type>
+struct reflector_workspace
+{
+    pooled_array<value_type> array_v1;
+    pooled_array<value_type> array_t;
+    pooled_array<value_type> array_w;
+    pooled_array<value_type> array_wt;
+
+    reflector_workspace(context& ctx, int m, int local_columns, int block_size)
+        : array_v1(ctx.get_pool(), concurrency::extent<2>(block_size, block_size)),
+          array_t(ctx.get_pool(), concurrency::extent<2>(block_size, block_size)),
+          array_w(ctx.get_pool(), make_extent<ordering::column_major>(block_size, std::max(local_columns,1))),
+          array_wt(ctx.get_pool(), make_extent<ordering::column_major>(m, block_size))
+    {
+        // w and w_t are gemm outputs with beta = 0 and must not start out holding NaN patterns
+        fill(ctx.get_view(), array_w.get_view(), value_type());
+        fill(ctx.get_view(), array_wt.get_view(), value_type());
+    }
+
+private:
+    // non-copyable
+    reflector_workspace(const reflector_workspace&);
+    reflector_workspace& operator=(const reflector_workspace&);
+};
+
+template <int block_size, typename value_type>
+void geqrf(context_group& group, distributed_matrix<value_type>& a, value_type* tau)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const ordering storage_type = ordering::column_major;
+    const int m = a.get_rows();
+    const int n = a.get_cols();
+    const int k = std::min(m,n);
+    const int p = group.size();
+
+    std::vector<std::unique_ptr<reflector_workspace<value_type>>> workspace;
+    for (int d = 0; d < p; d++)
+        workspace.push_back(std::unique_ptr<reflector_workspace<value_type>>(new reflector_workspace<value_type>(group[d], m, a.get_local_columns(d), block_size)));
+
+    // panel stepping
+    for (int i = 0; i < k; i += block_size)
+    {
+        const int ib = std::min(block_size, k-i);
+        const int owner = a.get_owner(i);
+
+        // factor the panel on the host; this only waits for the owner's update of the panel
+        array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a.get_view(owner), index<2>(i,a.get_local_column(owner,i)), extent<2>(m-i,ib));
+        host_panel<value_type> panel(group[owner].get_staging_pool(), a_sub);
+
+        array_view<value_type,1> tau_sub(ib, tau + i);
+        host::geqrf<storage_type>(panel, tau_sub);
+
+        if (i+ib == n)
+            break;
+
+        // the owner forms the triangular factor first so the others can copy it
+        for (int s = 0; s < p; s++)
+        {
+            const int d = (owner + s) % p;
+
+            context& ctx = group[d];
+            const concurrency::accelerator_view& av = ctx.get_view();
+            reflector_workspace<value_type>& work = *workspace[d];
+
+            array_view<value_type,2> v1 = work.array_v1.get_view();
+            array_view<value_type,2> t = work.array_t.get_view();
+            array_view<value_type,2> v1_sub = v1.section(index<2>(0,0), extent<2>(ib,ib));
+            array_view<value_type,2> t_sub = t.section(index<2>(0,0), extent<2>(ib,ib));
+
+            panel_copy<value_type> v(ctx, panel, d == owner);
+
+            if (d == owner)
+            {
+                host::larft<storage_type>(ctx, panel, tau_sub, t_sub, v1_sub);
+            }
+            else
+            {
+                concurrency::copy(workspace[owner]->array_t.get_view().section(index<2>(0,0), extent<2>(ib,ib)), t_sub);
+                concurrency::copy(workspace[owner]->array_v1.get_view().section(index<2>(0,0), extent<2>(ib,ib)), v1_sub);
+                ctx.get_transfers().add_to_accelerator(2*get_bytes<value_type>(t_sub.extent));
+            }
+
+            // local columns right of the panel and past the next panel
+            const int right = a.get_local_column(d, i+ib);
+            const int ahead = a.get_local_column(d, std::min(n, i+ib+block_size));
+            const int end = a.get_local_columns(d);
+
+            if (right == end)
+                continue;
+
+            // rows i:m of the local columns; the panel is at row (and column) 0 of v
+            array_view<value_type,2> c = get_sub_matrix<storage_type>(a.get_view(d), index<2>(i,0), extent<2>(m-i,end));
+
+            // w = t' * v' <==> w' = v * t
+            form_wt<storage_type>(av, v.get_view(), v1, t, work.array_wt.get_view(), 0, ib, ampblas::transpose::no_trans);
+
+            // the next panel first, so that its owner can hand it to the host early
+            geqrf_apply<storage_type>(av, v.get_view(), c, v1, work.array_w.get_view(), work.array_wt.get_view(), 0, ib, right, ahead);
+            av.flush();
+
+            geqrf_apply<storage_type>(av, v.get_view(), c, v1, work.array_w.get_view(), work.array_wt.get_view(), 0, ib, ahead, end);
+            av.flush();
+        }
+    }
+}
+
+} // namespace multi
+} // namespace _detail
+
+//
+// Host Interface Functions
+//
+// The multi-device routines take a context group instead of a context and distribute the
+// matrix over its views (see the distributed layout above). They always use the host panel
+// factorization and take the same arguments, and report the same errors, as the single 
+// device routines; the group counts as the first argument.
+//
+
+template <typename value_type>
+void getrf(context_group& group, int m, int n, value_type* a, int lda, int* ipiv)
+{
+    // error checking
+    if (group.size() == 0)
+        argument_error(1);
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < m)
+        argument_error(5);
+    if (ipiv == nullptr)
+        argument_error(6);
+
+    // quick return
+    if (n == 0 || m == 0)
+        return;
+
+    _detail::distributed_matrix<value_type> dist_a(group, m, n, _detail::getrf_block_size);
+    dist_a.scatter(a, lda);
+
+    _detail::multi::getrf<_detail::getrf_block_size>(group, dist_a, ipiv);
+
+    dist_a.gather(a, lda);
+}
+
+template <typename value_type>
+void potrf(context_group& group, char uplo, int n, value_type* a, int lda)
+{
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (group.size() == 0)
+        argument_error(1);
+    if (uplo != 'L' && uplo != 'U')
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < n)
+        argument_error(5);
+
+    // quick return
+    if (n == 0)
+        return;
+
+    // the upper factor is the conjugate transpose of the lower factor of a'
+    const bool conj_transpose = (uplo == 'U');
+
+    _detail::distributed_matrix<value_type> dist_a(group, n, n, _detail::potrf_block_size);
+    dist_a.scatter(a, lda, conj_transpose);
+
+    _detail::multi::potrf<_detail::potrf_block_size>(group, dist_a);
+
+    dist_a.gather(a, lda, conj_transpose);
+}
+
+template <typename value_type>
+void geqrf(context_group& group, int m, int n, value_type* a, int lda, value_type* tau)
+{
+    // error checking
+    if (group.size() == 0)
+        argument_error(1);
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < m)
+        argument_error(5);
+    if (tau == nullptr)
+        argument_error(6);
+
+    // quick return
+    if (n == 0 || m == 0)
+        return;
+
+    _detail::distributed_matrix<value_type> dist_a(group, m, n, _detail::geqrf_block_size);
+    dist_a.scatter(a, lda);
+
+    _detail::multi::geqrf<_detail::geqrf_block_size>(group, dist_a, tau);
+
+    dist_a.gather(a, lda);
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_MULTI_DEVICE_H
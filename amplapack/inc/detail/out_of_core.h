@@ -0,0 +1,738 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* out_of_core.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_OUT_OF_CORE_H
+#define AMPLAPACK_OUT_OF_CORE_H
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+#include "amplapack_config.h"
+#include "geqrf.h"
+#include "getrf.h"
+#include "potrf.h"
+
+namespace amplapack {
+
+// a matrix that is read and written a block at a time instead of being held in memory (for
+// example a file); the blocks are column major with leading dimension ld and i and j are 
+// zero based
+template <typename value_type>
+class tile_stream
+{
+public:
+    virtual ~tile_stream() {}
+
+    // the m by n block at row i and column j
+    virtual void read(int i, int j, int m, int n, value_type* buffer, int ld) = 0;
+    virtual void write(int i, int j, int m, int n, const value_type* buffer, int ld) = 0;
+
+    // the factored columns (rows for upper) written back so far out of total
+    virtual void progress(int /*done*/, int /*total*/) {}
+};
+
+namespace _detail {
+
+//
+// Out of Core Layout
+//
+// The out of core routines leave a in host memory and move it through the accelerator one
+// slab of block columns at a time (left looking). A slab is uploaded, updated with every
+// factored panel to its left, each panel being streamed through the accelerator in turn,
+// factored in core with the hybrid algorithm and downloaded again. Only the slab, one 
+// streamed panel and a few block sized working arrays live on the accelerator; the slab is
+// as wide as the workspace allows, and narrow enough to stay within a pool slab. a itself
+// may be far larger than any extent: it is only ever viewed a block (and a group of 
+// columns) at a time.
+//
+
+namespace ooc {
+
+// a column major rows by cols view over the front of a pooled buffer
+template <typename value_type>
+concurrency::array_view<value_type,2> get_buffer_view(pooled_array<value_type>& buffer, int rows, int cols)
+{
+    return buffer.get_view()[0].section(0, static_cast<int>(size_t(rows)*cols)).view_as(make_extent<ordering::column_major>(rows, cols));
+}
+
+// the widest slab, in whole blocks, for which the fixed elements and the slab elements fit 
+// into workspace bytes and a slab buffer into a pool slab; 0 if not even a single block fits
+template <typename value_type>
+int get_slab_width(size_t workspace, size_t fixed_elements, size_t elements_per_column, int block_size, int n)
+{
+    const size_t elements = workspace / sizeof(value_type);
+
+    if (elements < fixed_elements + block_size*elements_per_column)
+        return 0;
+
+    const size_t max_columns = device_pool::max_slab_words / device_pool::get_words<value_type>(elements_per_column);
+    const size_t columns = std::min((elements - fixed_elements) / elements_per_column, max_columns);
+    const int blocks = static_cast<int>(std::min(columns / block_size, size_t((n + block_size - 1) / block_size)));
+
+    return blocks * block_size;
+}
+
+// the slab of potrf for workspace bytes: the slab and one streamed panel
+template <typename value_type>
+int get_potrf_slab_width(int n, size_t workspace)
+{
+    return get_slab_width<value_type>(workspace, size_t(n)*potrf_block_size, n, potrf_block_size, n);
+}
+
+// copies the block of the column major a (leading dimension lda) at row i and column j with
+// the extent of accl_view to (to_accelerator) or from accl_view; each host view covers only
+// as many columns as an extent can hold
+template <typename value_type>
+void copy_block(value_type* a, int lda, int i, int j, const concurrency::array_view<value_type,2>& accl_view, bool to_accelerator)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const ordering storage_type = ordering::column_major;
+    const int rows = get_rows<storage_type>(accl_view);
+    const int cols = get_cols<storage_type>(accl_view);
+    const int group = static_cast<int>(std::max(size_t(1), std::min(size_t(cols), size_t(INT_MAX) / lda)));
+
+    for (int c = 0; c < cols; c += group)
+    {
+        const int gc = std::min(group, cols-c);
+
+        array_view<value_type,2> host_columns(gc, lda, a + (size_t(j)+c)*lda);
+        array_view<value_type,2> host_block = get_sub_matrix<storage_type>(host_columns, index<2>(i,0), extent<2>(rows,gc));
+        array_view<value_type,2> accl_block = get_sub_matrix<storage_type>(accl_view, index<2>(0,c), extent<2>(rows,gc));
+
+        if (to_accelerator)
+            concurrency::copy(host_block, accl_block);
+        else
+            concurrency::copy(accl_block, host_block);
+    }
+}
+
+template <typename value_type>
+void upload(context& ctx, value_type* a, int lda, int i, int j, const concurrency::array_view<value_type,2>& accl_view)
+{
+    copy_block(a, lda, i, j, accl_view, true);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view.extent));
+}
+
+template <typename value_type>
+void download(context& ctx, const concurrency::array_view<value_type,2>& accl_view, value_type* a, int lda, int i, int j)
+{
+    copy_block(a, lda, i, j, accl_view, false);
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view.extent));
+}
+
+// applies the interchanges k1:k2 of ipiv (Fortran indexing) to the first n columns of a
+template <typename value_type>
+void host_laswp(int n, value_type* a, int lda, int k1, int k2, const int* ipiv)
+{
+    for (int j = 0; j < n; j++)
+    {
+        value_type* column = a + size_t(j)*lda;
+
+        for (int i = k1; i < k2; i++)
+        {
+            const int ip = ipiv[i] - 1;
+
+            if (ip != i)
+                std::swap(column[i], column[ip]);
+        }
+    }
+}
+
+// reads and writes the blocks of a matrix in host memory
+template <typename value_type>
+class host_source
+{
+public:
+    typedef value_type element_type;
+
+    host_source(value_type* a, int lda)
+        : a(a), lda(lda)
+    {}
+
+    void read(context& ctx, int i, int j, const concurrency::array_view<value_type,2>& accl_view)
+    {
+        upload(ctx, a, lda, i, j, accl_view);
+    }
+
+    void write(context& ctx, const concurrency::array_view<value_type,2>& accl_view, int i, int j)
+    {
+        download(ctx, accl_view, a, lda, i, j);
+    }
+
+    void progress(int /*done*/, int /*total*/) {}
+
+private:
+    value_type* a;
+    int lda;
+};
+
+// reads and writes the blocks of a tile stream through a host buffer as large as the largest 
+// block moved
+template <typename value_type>
+class stream_source
+{
+public:
+    typedef value_type element_type;
+
+    stream_source(tile_stream<value_type>& stream, size_t elements)
+        : stream(stream), buffer(elements)
+    {}
+
+    void read(context& ctx, int i, int j, const concurrency::array_view<value_type,2>& accl_view)
+    {
+        const int rows = get_rows<ordering::column_major>(accl_view);
+        const int cols = get_cols<ordering::column_major>(accl_view);
+
+        stream.read(i, j, rows, cols, buffer.data(), rows);
+
+        concurrency::copy(buffer.begin(), buffer.begin() + size_t(rows)*cols, accl_view);
+        ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view.extent));
+    }
+
+    void write(context& ctx, const concurrency::array_view<value_type,2>& accl_view, int i, int j)
+    {
+        const int rows = get_rows<ordering::column_major>(accl_view);
+        const int cols = get_cols<ordering::column_major>(accl_view);
+
+        concurrency::copy(accl_view, buffer.begin());
+        ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view.extent));
+
+        stream.write(i, j, rows, cols, buffer.data(), rows);
+    }
+
+    void progress(int done, int total)
+    {
+        stream.progress(done, total);
+    }
+
+private:
+    // non-copyable
+    stream_source(const stream_source&);
+    stream_source& operator=(const stream_source&);
+
+    tile_stream<value_type>& stream;
+    std::vector<value_type> buffer;
+};
+
+//
+// LU Factorization
+//
+
+// the factors on the host hold the interchanges of every later panel, so each slab takes 
+// all interchanges of the columns to its left before the streamed updates (P * A = L * U 
+// solved for the block column of U one panel at a time)
+template <int block_size, typename value_type>
+void getrf(context& ctx, int m, int n, value_type* a, int lda, int* ipiv, int slab)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const ordering storage_type = ordering::column_major;
+    const concurrency::accelerator_view& av = ctx.get_view();
+    const int k = std::min(m,n);
+
+    // working arrays (accelerator); get_slab_width keeps m*slab within a pool slab
+    pooled_array<value_type> array_s(ctx.get_pool(), extent<2>(1, static_cast<int>(size_t(m)*slab)));
+    pooled_array<value_type> array_l(ctx.get_pool(), extent<2>(1, static_cast<int>(size_t(m)*block_size)));
+    pooled_array<int> array_pivots(ctx.get_pool(), extent<2>(1, k));
+    array_view<int,1> pivots = array_pivots.get_view()[0];
+
+    // data error
+    int info = 0;
+
+    // slab stepping
+    for (int j = 0; j < n; j += slab)
+    {
+        const int jw = std::min(slab, n-j);
+
+        array_view<value_type,2> s = get_buffer_view(array_s, m, jw);
+        upload(ctx, a, lda, 0, j, s);
+
+        // update with the factored panels to the left
+        const int jk = std::min(j, k);
+
+        if (jk > 0)
+        {
+            concurrency::copy(array_view<const int,1>(jk, ipiv), pivots.section(0, jk));
+            ctx.get_transfers().add_to_accelerator(get_bytes<int>(extent<2>(1,jk)));
+
+            laswp<storage_type>(ctx, s, 0, jk, pivots);
+        }
+
+        for (int i = 0; i < jk; i += block_size)
+        {
+            const int ib = std::min(block_size, jk-i);
+
+            array_view<value_type,2> l = get_buffer_view(array_l, m-i, ib);
+            upload(ctx, a, lda, i, i, l);
+
+            // block row of U
+            {
+                array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(l, index<2>(0,0), extent<2>(ib,ib));
+                array_view<value_type,2> b_sub = get_sub_matrix<storage_type>(s, index<2>(i,0), extent<2>(ib,jw));
+
+                trsm<storage_type>(av, ampblas::side::left, ampblas::uplo::lower, ampblas::transpose::no_trans, ampblas::diag::unit, value_type(1), a_sub, b_sub);
+            }
+
+            // rows below it
+            if (i+ib < m)
+            {
+                array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(l, index<2>(ib,0), extent<2>(m-i-ib,ib));
+                array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(s, index<2>(i,0), extent<2>(ib,jw));
+                array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(s, index<2>(i+ib,0), extent<2>(m-i-ib,jw));
+
+                gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::no_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
+            }
+        }
+
+        // factor the slab below the factored rows in core
+        if (j < k)
+        {
+            const int jb = std::min(jw, k-j);
+
+            array_view<value_type,2> s_sub = get_sub_matrix<storage_type>(s, index<2>(j,0), extent<2>(m-j,jw));
+            array_view<int,1> slab_pivots = pivots.section(j, jb);
+
+            try
+            {
+                _detail::getrf<block_size, getrf_look_ahead_depth, storage_type, block_factor_location::host>(ctx, s_sub, slab_pivots);
+            }
+            catch(const data_error_exception& e)
+            {
+                // offset data error (do not rethrow)
+                if (info == 0)
+                    info = j + e.get();
+            }
+
+            concurrency::copy(slab_pivots, ipiv + j);
+            ctx.get_transfers().add_to_host(get_bytes<int>(extent<2>(1,jb)));
+
+            for (int i = j; i < j+jb; i++)
+                ipiv[i] += j;
+
+            // the columns to the left are already on the host
+            host_laswp(j, a, lda, j, j+jb, ipiv);
+        }
+
+        download(ctx, s, a, lda, 0, j);
+    }
+
+    // rethrow data error (if any)
+    if (info)
+        data_error(info);
+}
+
+//
+// Cholesky Factorization
+//
+
+// lower: a slab is the block column j:j+jw below the diagonal and the streamed panels are the
+// same rows of the factored block columns; upper: the transposed shapes (block rows). Each slab
+// is read from source and written back once, whole: the opposite triangle of its diagonal block
+// is read along with it and written back unchanged. The streamed panels lie wholly within the
+// referenced triangle.
+template <int block_size, typename source_type>
+void potrf(context& ctx, enum class uplo uplo, int n, source_type& source, int slab)
+{
+    typedef typename source_type::element_type value_type;
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    const ordering storage_type = ordering::column_major;
+    const concurrency::accelerator_view& av = ctx.get_view();
+    const bool lower = (uplo == uplo::lower);
+
+    // working arrays (accelerator); get_slab_width keeps n*slab within a pool slab
+    pooled_array<value_type> array_s(ctx.get_pool(), extent<2>(1, static_cast<int>(size_t(n)*slab)));
+    pooled_array<value_type> array_p(ctx.get_pool(), extent<2>(1, static_cast<int>(size_t(n)*block_size)));
+
+    // slab stepping
+    for (int j = 0; j < n; j += slab)
+    {
+        const int jw = std::min(slab, n-j);
+        const int nr = n-j;
+
+        // lower: rows j:n of columns j:j+jw, upper: rows j:j+jw of columns j:n
+        array_view<value_type,2> s = (lower ? get_buffer_view(array_s, nr, jw) : get_buffer_view(array_s, jw, nr));
+        source.read(ctx, j, j, s);
+
+        // diagonal block and the rest of the slab
+        array_view<value_type,2> s_diagonal = get_sub_matrix<storage_type>(s, index<2>(0,0), extent<2>(jw,jw));
+        array_view<value_type,2> s_rest = (lower ? get_sub_matrix<storage_type>(s, index<2>(jw,0), extent<2>(nr-jw,jw)) : get_sub_matrix<storage_type>(s, index<2>(0,jw), extent<2>(jw,nr-jw)));
+
+        // update with the factored panels to the left (above)
+        for (int i = 0; i < j; i += block_size)
+        {
+            const int ib = std::min(block_size, j-i);
+
+            if (lower)
+            {
+                array_view<value_type,2> p = get_buffer_view(array_p, nr, ib);
+                source.read(ctx, j, i, p);
+
+                array_view<const value_type,2> p_top = get_sub_matrix<storage_type>(p, index<2>(0,0), extent<2>(jw,ib));
+                herk<storage_type>(av, ampblas::uplo::lower, ampblas::transpose::no_trans, real_type(-1), p_top, real_type(1), s_diagonal);
+
+                if (nr > jw)
+                {
+                    array_view<const value_type,2> p_rest = get_sub_matrix<storage_type>(p, index<2>(jw,0), extent<2>(nr-jw,ib));
+                    gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::conj_trans, value_type(-1), p_rest, p_top, value_type(1), s_rest);
+                }
+            }
+            else
+            {
+                array_view<value_type,2> p = get_buffer_view(array_p, ib, nr);
+                source.read(ctx, i, j, p);
+
+                array_view<const value_type,2> p_left = get_sub_matrix<storage_type>(p, index<2>(0,0), extent<2>(ib,jw));
+                herk<storage_type>(av, ampblas::uplo::upper, ampblas::transpose::conj_trans, real_type(-1), p_left, real_type(1), s_diagonal);
+
+                if (nr > jw)
+                {
+                    array_view<const value_type,2> p_rest = get_sub_matrix<storage_type>(p, index<2>(0,jw), extent<2>(ib,nr-jw));
+                    gemm<storage_type>(av, ampblas::transpose::conj_trans, ampblas::transpose::no_trans, value_type(-1), p_left, p_rest, value_type(1), s_rest);
+                }
+            }
+        }
+
+        // factor the diagonal block in core
+        try
+        {
+            _detail::potrf<block_size, potrf_look_ahead_depth, storage_type, block_factor_location::host>(ctx, uplo, s_diagonal);
+        }
+        catch(const data_error_exception& e)
+        {
+            // offset local block error
+            data_error(e.get() + j);
+        }
+
+        // solve the rest of the slab
+        if (nr > jw)
+        {
+            if (lower)
+                trsm<storage_type>(av, ampblas::side::right, ampblas::uplo::lower, ampblas::transpose::conj_trans, ampblas::diag::non_unit, value_type(1), s_diagonal, s_rest);
+            else
+                trsm<storage_type>(av, ampblas::side::left, ampblas::uplo::upper, ampblas::transpose::conj_trans, ampblas::diag::non_unit, value_type(1), s_diagonal, s_rest);
+        }
+
+        source.write(ctx, s, j, j);
+        source.progress(j+jw, n);
+    }
+}
+
+//
+// QR Factorization
+//
+
+// the triangular factors of the block reflectors are kept on the host (block_size by block_size
+// per panel) so that a panel can be streamed back without forming them again
+template <int block_size, typename value_type>
+void geqrf(context& ctx, int m, int n, value_type* a, int lda, value_type* tau, int slab)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const ordering storage_type = ordering::column_major;
+    const concurrency::accelerator_view& av = ctx.get_view();
+    const int k = std::min(m,n);
+    const int panels = (k + block_size - 1) / block_size;
+
+    // triangular factors and unit lower triangular top blocks of every panel (host)
+    std::vector<value_type> host_t(panels*block_size*block_size);
+    std::vector<value_type> host_v1(panels*block_size*block_size);
+
+    // working arrays (accelerator); get_slab_width keeps m*slab within a pool slab
+    pooled_array<value_type> array_s(ctx.get_pool(), extent<2>(1, static_cast<int>(size_t(m)*slab)));
+    pooled_array<value_type> array_v(ctx.get_pool(), extent<2>(1, static_cast<int>(size_t(m)*block_size)));
+    pooled_array<value_type> array_w(ctx.get_pool(), make_extent<storage_type>(block_size, slab));
+    pooled_array<value_type> array_wt(ctx.get_pool(), make_extent<storage_type>(m, block_size));
+    pooled_array<value_type> array_t(ctx.get_pool(), extent<2>(block_size, block_size));
+    pooled_array<value_type> array_v1(ctx.get_pool(), extent<2>(block_size, block_size));
+    pooled_array<value_type> array_scratch(ctx.get_pool(), extent<2>(block_size, block_size));
+
+    array_view<value_type,2> w = array_w.get_view();
+    array_view<value_type,2> wt = array_wt.get_view();
+    array_view<value_type,2> t = array_t.get_view();
+    array_view<value_type,2> v1 = array_v1.get_view();
+    array_view<value_type,2> scratch = array_scratch.get_view();
+
+    // pooled memory holds data from earlier calls; w and w_t are gemm outputs with beta = 0
+    fill(av, w, value_type());
+    fill(av, wt, value_type());
+    fill(av, scratch, value_type());
+
+    // slab stepping
+    for (int j = 0; j < n; j += slab)
+    {
+        const int jw = std::min(slab, n-j);
+
+        array_view<value_type,2> s = get_buffer_view(array_s, m, jw);
+        upload(ctx, a, lda, 0, j, s);
+
+        // apply the block reflectors of the panels to the left
+        for (int i = 0; i < std::min(j,k); i += block_size)
+        {
+            const int ib = std::min(block_size, k-i);
+            const int offset = (i/block_size)*block_size*block_size;
+
+            array_view<value_type,2> v = get_buffer_view(array_v, m-i, ib);
+            upload(ctx, a, lda, i, i, v);
+
+            concurrency::copy(host_t.begin() + offset, host_t.begin() + offset + block_size*block_size, t);
+            concurrency::copy(host_v1.begin() + offset, host_v1.begin() + offset + block_size*block_size, v1);
+            ctx.get_transfers().add_to_accelerator(2*get_bytes<value_type>(t.extent));
+
+            // w = t' * v' <==> w' = v * t
+            form_wt<storage_type>(av, v, v1, t, wt, 0, ib, ampblas::transpose::no_trans);
+
+            // rows i:m of the slab
+            array_view<value_type,2> c = get_sub_matrix<storage_type>(s, index<2>(i,0), extent<2>(m-i,jw));
+            geqrf_apply<storage_type>(av, v, c, v1, w, wt, 0, ib, 0, jw);
+        }
+
+        // factor the slab below the factored rows in core and keep the factors of its panels
+        if (j < k)
+        {
+            const int jk = std::min(jw, k-j);
+
+            array_view<value_type,2> s_sub = get_sub_matrix<storage_type>(s, index<2>(j,0), extent<2>(m-j,jw));
+            array_view<value_type,1> tau_sub(jk, tau + j);
+
+            _detail::geqrf<block_size, geqrf_look_ahead_depth, storage_type, block_factor_location::host>(ctx, s_sub, tau_sub);
+
+            for (int i = j; i < j+jk; i += block_size)
+            {
+                const int ib = std::min(block_size, j+jk-i);
+                const int offset = (i/block_size)*block_size*block_size;
+
+                array_view<value_type,2> v_sub = get_sub_matrix<storage_type>(s, index<2>(i,i-j), extent<2>(m-i,ib));
+                array_view<value_type,2> t_sub = t.section(index<2>(0,0), extent<2>(ib,ib));
+                array_view<value_type,2> v1_sub = v1.section(index<2>(0,0), extent<2>(ib,ib));
+                array_view<value_type,2> scratch_sub = scratch.section(index<2>(0,0), extent<2>(ib,ib));
+
+                accl::larft<storage_type>(av, v_sub, tau_sub.section(index<1>(i-j)), t_sub, v1_sub, scratch_sub);
+
+                concurrency::copy(t, host_t.begin() + offset);
+                concurrency::copy(v1, host_v1.begin() + offset);
+                ctx.get_transfers().add_to_host(2*get_bytes<value_type>(t.extent));
+            }
+
+            tau_sub.synchronize();
+        }
+
+        download(ctx, s, a, lda, 0, j);
+    }
+}
+
+} // namespace ooc
+
+//
+// Forwarding Function
+//
+
+// this is a work around until VS std::bind can accept more paramaters
+template <typename value_type>
+struct getrf_ooc_params
+{
+    getrf_params<value_type> base;
+    size_t workspace;
+
+    getrf_ooc_params(int m, int n, value_type* a, int lda, int* ipiv, size_t workspace)
+        : base(m, n, a, lda, ipiv), workspace(workspace)
+    {}
+};
+
+template <typename value_type>
+struct potrf_ooc_params
+{
+    char uplo;
+    int n;
+    value_type* a;
+    int lda;
+    size_t workspace;
+
+    potrf_ooc_params(char uplo, int n, value_type* a, int lda, size_t workspace)
+        : uplo(uplo), n(n), a(a), lda(lda), workspace(workspace)
+    {}
+};
+
+template <typename value_type>
+struct geqrf_ooc_params
+{
+    geqrf_params<value_type> base;
+    size_t workspace;
+
+    geqrf_ooc_params(int m, int n, value_type* a, int lda, value_type* tau, size_t workspace)
+        : base(m, n, a, lda, tau), workspace(workspace)
+    {}
+};
+
+template <typename value_type>
+void getrf_ooc_unpack(context& ctx, const getrf_ooc_params<value_type>& p)
+{
+    amplapack::getrf_ooc(ctx, p.base.m, p.base.n, p.base.a, p.base.lda, p.base.ipiv, p.workspace); 
+}
+
+template <typename value_type>
+void potrf_ooc_unpack(context& ctx, const potrf_ooc_params<value_type>& p)
+{
+    amplapack::potrf_ooc(ctx, p.uplo, p.n, p.a, p.lda, p.workspace); 
+}
+
+template <typename value_type>
+void geqrf_ooc_unpack(context& ctx, const geqrf_ooc_params<value_type>& p)
+{
+    amplapack::geqrf_ooc(ctx, p.base.m, p.base.n, p.base.a, p.base.lda, p.base.tau, p.workspace); 
+}
+
+} // namespace _detail
+
+//
+// Host Interface Functions
+//
+// The out of core routines take the accelerator memory in bytes they may use for the slab 
+// and the streamed panels; the in core factorization of a slab draws a few more block sized
+// arrays from the context's pool. A workspace too small for a slab of one block is an 
+// argument error.
+//
+
+template <typename value_type>
+void getrf_ooc(context& ctx, int m, int n, value_type* a, int lda, int* ipiv, size_t workspace)
+{
+    // quick return
+    if (n == 0 || m == 0)
+        return;
+
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < m)
+        argument_error(5);
+    if (ipiv == nullptr)
+        argument_error(6);
+
+    // slab, one streamed panel and the pivots (and their permutation lists)
+    const int block_size = _detail::getrf_block_size;
+    const int slab = _detail::ooc::get_slab_width<value_type>(workspace, size_t(m)*block_size + 5*size_t(n), m, block_size, n);
+
+    if (slab == 0)
+        argument_error(7);
+
+    _detail::ooc::getrf<block_size>(ctx, m, n, a, lda, ipiv, slab);
+}
+
+template <typename value_type>
+void potrf_ooc(context& ctx, char uplo, int n, value_type* a, int lda, size_t workspace)
+{
+    // quick return
+    if (n == 0)
+        return;
+
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < n)
+        argument_error(5);
+
+    const int slab = _detail::ooc::get_potrf_slab_width<value_type>(n, workspace);
+
+    if (slab == 0)
+        argument_error(6);
+
+    _detail::ooc::host_source<value_type> source(a, lda);
+    _detail::ooc::potrf<_detail::potrf_block_size>(ctx, to_option(uplo), n, source, slab);
+}
+
+// the slabs are staged in host memory on their way between stream and the accelerator, so
+// neither holds more of a than workspace
+template <typename value_type>
+void potrf_stream(context& ctx, char uplo, int n, tile_stream<value_type>& stream, size_t workspace)
+{
+    // quick return
+    if (n == 0)
+        return;
+
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+
+    const int slab = _detail::ooc::get_potrf_slab_width<value_type>(n, workspace);
+
+    if (slab == 0)
+        argument_error(5);
+
+    _detail::ooc::stream_source<value_type> source(stream, size_t(n)*slab);
+    _detail::ooc::potrf<_detail::potrf_block_size>(ctx, to_option(uplo), n, source, slab);
+}
+
+template <typename value_type>
+void geqrf_ooc(context& ctx, int m, int n, value_type* a, int lda, value_type* tau, size_t workspace)
+{
+    // quick return
+    if (n == 0 || m == 0)
+        return;
+
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < m)
+        argument_error(5);
+    if (tau == nullptr)
+        argument_error(6);
+
+    // slab (and its block of w), one streamed panel, w_t and three block by block arrays
+    const int block_size = _detail::geqrf_block_size;
+    const int slab = _detail::ooc::get_slab_width<value_type>(workspace, 2*size_t(m)*block_size + 3*block_size*block_size, m + block_size, block_size, n);
+
+    if (slab == 0)
+        argument_error(7);
+
+    _detail::ooc::geqrf<block_size>(ctx, m, n, a, lda, tau, slab);
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_OUT_OF_CORE_H
@@ -1,309 +1,985 @@
-/*----------------------------------------------------------------------------
-* Copyright  Microsoft Corp.
-*
-* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
-* use this file except in compliance with the License.  You may obtain a copy 
-* of the License at http://www.apache.org/licenses/LICENSE-2.0  
-* 
-* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
-* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
-* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
-* MERCHANTABLITY OR NON-INFRINGEMENT. 
-*
-* See the Apache Version 2.0 License for specific language governing 
-* permissions and limitations under the License.
-*---------------------------------------------------------------------------
-* 
-* potrf.h
-*
-*---------------------------------------------------------------------------*/
-
-#ifndef AMPLAPACK_POTRF_H
-#define AMPLAPACK_POTRF_H
-
-#include "amplapack_config.h"
-
-// external lapack functions
-
-namespace amplapack {
-namespace _detail {
-
-//
-// External LAPACK Wrappers
-// 
-
-namespace lapack {
-
-template <typename value_type>
-void potrf(char uplo, int n, value_type* a, int lda, int& info);
-
-template <>
-void potrf(char uplo, int n, float* a, int lda, int& info)
-{ 
-    LAPACK_SPOTRF(&uplo, &n, a, &lda, &info); 
-}
-
-template <>
-void potrf(char uplo, int n, double* a, int lda, int& info)
-{ 
-    LAPACK_DPOTRF(&uplo, &n, a, &lda, &info); 
-}
-
-template <>
-void potrf(char uplo, int n, ampblas::complex<float>* a, int lda, int& info)
-{ 
-    LAPACK_CPOTRF(&uplo, &n, a, &lda, &info); 
-}
-
-template <>
-void potrf(char uplo, int n, ampblas::complex<double>* a, int lda, int& info)
-{ 
-    LAPACK_ZPOTRF(&uplo, &n, a, &lda, &info); 
-}
-
-} // namespace lapack
-
-//
-// Host Wrapper
-//
-
-namespace host {
-
-template <enum class ordering storage_type, typename value_type>
-void potrf(const concurrency::accelerator_view& /*av*/, enum class uplo uplo, concurrency::array_view<value_type,2>& a)
-{
-    static_assert(storage_type == ordering::column_major, "hybrid functionality requires column major ordering");
-
-    const int n = require_square(a);
-   
-    // TODO: take from a pool
-    const int lda = n;
-    std::vector<value_type> hostVector(lda*n);
-
-    // copy from acclerator to host
-    concurrency::copy(a, hostVector.begin());
-
-    // run host function
-    int info = 0;
-    lapack::potrf(to_char(uplo), n, hostVector.data(), lda, info);
-
-    // check for errors
-    info_check(info);
-
-    // copy from host to accelerator
-    // requires -D_SCL_SECURE_NO_WARNINGS
-    concurrency::copy(hostVector.begin(), hostVector.end(), a);
-}
-
-} // namespace host
-
-//
-// Blocked Factorization
-//
-
-template <int block_size, int look_ahead_depth, enum class ordering storage_type, typename value_type>
-void potrf(const concurrency::accelerator_view& av, enum class uplo uplo, const concurrency::array_view<value_type,2>& a)
-{
-    typedef typename ampblas::real_type<value_type>::type real_type;
-
-    using concurrency::array_view;
-    using concurrency::index;
-    using concurrency::extent;
-
-    // matrix size
-    const int n = require_square(a);
-
-    // stored int lower triangular matrix
-    if (uplo == uplo::upper)
-    {
-        // block stepping
-        for (int j = 0; j < n; j += block_size)
-        {
-            // current block size
-            int jb = std::min(block_size, n-j);
-
-            // update diagonal block
-            {
-                int n_ = jb;
-                int k_ = j;
-
-                if (k_ > 0 && n_ > 0)
-                {
-                    array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(0,j), extent<2>(k_,n_));
-                    array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(n_,n_));
-                    ampblas::link::herk(av, ampblas::uplo::upper, ampblas::transpose::conj_trans, real_type(-1), a_sub, real_type(1), c_sub);
-                }
-            }
-
-            // factorize current block
-            try
-            {
-                int n_ = jb;
-                array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(n_,n_));
-                
-                host::potrf<storage_type>(av, uplo, a_sub);
-            }
-            catch(const data_error_exception& e)
-            {
-                // offset local block error
-                data_error(e.get() + j);
-            }
-
-            // this currently has no look ahead optimizations
-            if (j+jb < n)
-            {
-                // compute the current block column
-                {
-                    int m_ = jb;
-                    int n_ = n-j-jb;
-                    int k_ = j;
-                    if (m_ > 0 && n_ > 0 && k_ > 0)
-                    {
-                        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(0,j), extent<2>(k_,m_));
-                        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(0,j+jb), extent<2>(k_,n_));
-                        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a, index<2>(j,j+jb), extent<2>(m_,n_));
-                        ampblas::link::gemm(av, ampblas::transpose::conj_trans, ampblas::transpose::no_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
-                    }
-                }
-
-                // solve for this row
-                {
-                    int m_ = jb;
-                    int n_ = n-j-jb;
-                    if (m_ > 0 && n_ > 0)
-                    {
-                        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(m_,m_));
-                        array_view<value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(j,j+jb), extent<2>(m_,n_));
-                        ampblas::link::trsm(av, ampblas::side::left, ampblas::uplo::upper, ampblas::transpose::conj_trans, ampblas::diag::non_unit, value_type(1), a_sub, b_sub);
-                    }
-                }
-            }
-        }
-    }
-    else if (uplo == uplo::lower)
-    {
-        // block stepping
-        for (int j = 0; j < n; j += block_size)
-        {
-            // current block size
-            int jb = std::min(block_size, n-j);
-
-            // update diagonal block
-            {
-                int n_ = jb;
-                int k_ = j;
-
-                if (k_ > 0 && n_ > 0)
-                {
-                    array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,0), extent<2>(n_,k_));
-                    array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(n_,n_));
-                    ampblas::link::herk(av, ampblas::uplo::lower, ampblas::transpose::no_trans, real_type(-1), a_sub, real_type(1), c_sub);
-                }
-            }
-
-            // factorize current block
-            try
-            {
-                int n_ = jb;
-                array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(n_,n_));
-
-                host::potrf<storage_type>(av, uplo, a_sub);
-            }
-            catch(const data_error_exception& e)
-            {
-                // offset local block error
-                data_error(e.get() + j);
-            }
-
-            // this currently has no look ahead optimizations
-            if (j+jb < n)
-            {
-                // compute the current block column
-                {
-                    int m_ = n-j-jb;
-                    int n_ = jb;
-                    int k_ = j;
-                    if (m_ > 0 && n_ > 0 && k_ > 0)
-                    {
-                        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,0), extent<2>(m_,k_));
-                        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(j,0), extent<2>(n_,k_));
-                        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,j), extent<2>(m_,n_));
-                        ampblas::link::gemm(av, ampblas::transpose::no_trans, ampblas::transpose::conj_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
-                    }
-                }
-
-                // solve for this row
-                {
-                    int m_ = n-j-jb;
-                    int n_ = jb;
-                    if (m_ > 0 && n_ > 0)
-                    {
-                        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(n_,n_));
-                        array_view<value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,j), extent<2>(m_,n_));
-                        ampblas::link::trsm(av, ampblas::side::right, ampblas::uplo::lower, ampblas::transpose::conj_trans, ampblas::diag::non_unit, value_type(1), a_sub, b_sub);
-                    }
-                }
-            }
-        }
-    }
-}
-
-} // namespace _detail
-
-//
-// Array View Interface
-//
-
-template <enum class ordering storage_type, typename value_type>
-void potrf(const concurrency::accelerator_view& av, enum class uplo uplo, const concurrency::array_view<value_type,2>& a)
-{
-    // TODO: a tuning framework
-    const int block_size = 256;
-    const int look_ahead_depth = 1;
-
-    _detail::potrf<block_size, look_ahead_depth, storage_type>(av, uplo, a);
-}
-
-//
-// Host Interface Function
-//
-
-template <typename value_type>
-void potrf(concurrency::accelerator_view& av, char uplo, int n, value_type* a, int lda)
-{
-    // quick return
-    if (n == 0)
-        return;
-    
-    // error checking
-    uplo = static_cast<char>(toupper(uplo));
-
-    if (uplo != 'L' && uplo != 'U')
-        argument_error(2);
-    if (n < 0)
-        argument_error(3);
-    if (a == nullptr)
-        argument_error(4);
-    if (lda < n)
-        argument_error(5);
-
-    // host views
-    concurrency::array_view<value_type,2> host_view_a(n, lda, a);
-    concurrency::array_view<value_type,2> host_view_a_sub = host_view_a.section(concurrency::index<2>(0,0), concurrency::extent<2>(n,n));
-
-    // accelerator array (allocation and copy)
-    concurrency::array<value_type,2> accl_a(host_view_a_sub);
-
-    // accelerator view
-    concurrency::array_view<value_type,2> accl_view_a(accl_a);
-
-    // forwarding function
-    potrf<ordering::column_major>(av, to_option(uplo), accl_view_a);
-
-    // copy back to host
-    concurrency::copy(accl_view_a, host_view_a_sub);
-}
-
-} // namespace amplapack
-
-#endif // AMPLAPACK_POTRF_H
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* potrf.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_POTRF_H
+#define AMPLAPACK_POTRF_H
+
+#include "amplapack_config.h"
+#include "layout.h"
+
+// external lapack functions
+
+namespace amplapack {
+namespace _detail {
+
+//
+// External LAPACK Wrappers
+// 
+
+namespace lapack {
+
+template <typename value_type>
+void potrf(char uplo, int n, value_type* a, int lda, int& info);
+
+template <>
+inline void potrf(char uplo, int n, float* a, int lda, int& info)
+{ 
+    LAPACK_SPOTRF(&uplo, &n, a, &lda, &info); 
+}
+
+template <>
+inline void potrf(char uplo, int n, double* a, int lda, int& info)
+{ 
+    LAPACK_DPOTRF(&uplo, &n, a, &lda, &info); 
+}
+
+template <>
+inline void potrf(char uplo, int n, ampblas::complex<float>* a, int lda, int& info)
+{ 
+    LAPACK_CPOTRF(&uplo, &n, a, &lda, &info); 
+}
+
+template <>
+inline void potrf(char uplo, int n, ampblas::complex<double>* a, int lda, int& info)
+{ 
+    LAPACK_ZPOTRF(&uplo, &n, a, &lda, &info); 
+}
+
+template <typename value_type>
+void potrs(char uplo, int n, int nrhs, const value_type* a, int lda, value_type* b, int ldb, int& info);
+
+template <>
+inline void potrs(char uplo, int n, int nrhs, const float* a, int lda, float* b, int ldb, int& info)
+{
+    LAPACK_SPOTRS(&uplo, &n, &nrhs, a, &lda, b, &ldb, &info);
+}
+
+template <>
+inline void potrs(char uplo, int n, int nrhs, const double* a, int lda, double* b, int ldb, int& info)
+{
+    LAPACK_DPOTRS(&uplo, &n, &nrhs, a, &lda, b, &ldb, &info);
+}
+
+template <>
+inline void potrs(char uplo, int n, int nrhs, const ampblas::complex<float>* a, int lda, ampblas::complex<float>* b, int ldb, int& info)
+{
+    LAPACK_CPOTRS(&uplo, &n, &nrhs, a, &lda, b, &ldb, &info);
+}
+
+template <>
+inline void potrs(char uplo, int n, int nrhs, const ampblas::complex<double>* a, int lda, ampblas::complex<double>* b, int ldb, int& info)
+{
+    LAPACK_ZPOTRS(&uplo, &n, &nrhs, a, &lda, b, &ldb, &info);
+}
+
+} // namespace lapack
+
+//
+// Host Wrapper
+//
+
+namespace host {
+
+template <enum class ordering storage_type, typename value_type>
+void potrf(host_panel<value_type>& panel, enum class uplo uplo)
+{
+    const int n = require_square(panel.get_view());
+    const int lda = n;
+
+    // in column major order a row major block appears transposed, which for a Hermitian block
+    // is its conjugate; the factor of the opposite triangle then lands exactly where the row 
+    // major factor belongs, so the block needs no reordering
+    const char lapack_uplo = (storage_type == ordering::row_major ? to_char(uplo == uplo::upper ? uplo::lower : uplo::upper) : to_char(uplo));
+
+    // run host function (waits for the block to arrive)
+    int info = 0;
+    lapack::potrf(lapack_uplo, n, panel.get(), lda, info);
+
+    // copy from host to accelerator
+    panel.upload();
+
+    // check for errors
+    info_check(info);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void potrf(context& ctx, enum class uplo uplo, concurrency::array_view<value_type,2>& a)
+{
+    // copy from acclerator to page-locked host memory
+    host_panel<value_type> panel(ctx.get_staging_pool(), a);
+
+    potrf<storage_type>(panel, uplo);
+}
+
+} // namespace host
+
+//
+// Accelerator Block Factorization
+//
+
+namespace accl {
+
+// unblocked Cholesky factorization of an n by n diagonal block in place on the accelerator
+//
+// A single tile walks the columns: one thread takes the square root of the pivot, the tile 
+// scales the rest of the column (row) and then updates the trailing triangle with one thread
+// per row. The first column with a non-positive pivot (offset) is recorded in info and the
+// tile stops, leaving the rest of the block as it was.
+template <enum class ordering storage_type, typename value_type>
+void potf2(const concurrency::accelerator_view& av, enum class uplo uplo, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<int,1>& info, int offset)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    using concurrency::index;
+
+    static const int tile_size = 256;
+
+    const int n = require_square(a);
+    const bool upper = (uplo == uplo::upper);
+
+    concurrency::parallel_for_each(
+        av,
+        concurrency::extent<1>(tile_size).tile<tile_size>(),
+        [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        {
+            tile_static real_type pivot;
+            tile_static int failed;
+
+            const int tid = tidx.local[0];
+
+            for (int c = 0; c < n; c++)
+            {
+                // pivot
+                if (tid == 0)
+                {
+                    const real_type d = real_part(get_element<storage_type>(a, c, c));
+
+                    // also catches NaN
+                    failed = !(d > real_type(0));
+
+                    if (failed)
+                    {
+                        if (info[index<1>(0)] == 0)
+                            info[index<1>(0)] = c + 1 + offset;
+                    }
+                    else
+                    {
+                        pivot = square_root(d);
+                        get_element<storage_type>(a, c, c) = value_type(pivot);
+                    }
+                }
+
+                tidx.barrier.wait_with_global_memory_fence();
+
+                if (failed)
+                    break;
+
+                // scale column (lower) or row (upper)
+                const value_type scale = value_type(real_type(1) / pivot);
+
+                for (int i = c + 1 + tid; i < n; i += tile_size)
+                {
+                    if (upper)
+                        get_element<storage_type>(a, c, i) *= scale;
+                    else
+                        get_element<storage_type>(a, i, c) *= scale;
+                }
+
+                tidx.barrier.wait_with_global_memory_fence();
+
+                // trailing update of the triangle
+                for (int i = c + 1 + tid; i < n; i += tile_size)
+                {
+                    if (upper)
+                    {
+                        // a(i,j) -= conj(a(c,i)) * a(c,j) for j >= i
+                        const value_type aci = conjugate(get_element<storage_type>(a, c, i));
+
+                        for (int j = i; j < n; j++)
+                            get_element<storage_type>(a, i, j) -= aci * get_element<storage_type>(a, c, j);
+                    }
+                    else
+                    {
+                        // a(i,j) -= a(i,c) * conj(a(j,c)) for j <= i
+                        const value_type aic = get_element<storage_type>(a, i, c);
+
+                        for (int j = c + 1; j <= i; j++)
+                            get_element<storage_type>(a, i, j) -= aic * conjugate(get_element<storage_type>(a, j, c));
+                    }
+                }
+
+                tidx.barrier.wait_with_global_memory_fence();
+            }
+        }
+    );
+}
+
+} // namespace accl
+
+//
+// Blocked Factorization
+//
+
+// update of the diagonal block at j (size jb) by the previous block rows (upper) or columns (lower)
+template <enum class ordering storage_type, typename value_type>
+void potrf_update_diagonal(const concurrency::accelerator_view& av, enum class uplo uplo, const concurrency::array_view<value_type,2>& a, int j, int jb)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    int n_ = jb;
+    int k_ = j;
+
+    if (k_ == 0 || n_ == 0)
+        return;
+
+    array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(n_,n_));
+
+    if (uplo == uplo::upper)
+    {
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(0,j), extent<2>(k_,n_));
+        herk<storage_type>(av, ampblas::uplo::upper, ampblas::transpose::conj_trans, real_type(-1), a_sub, real_type(1), c_sub);
+    }
+    else
+    {
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,0), extent<2>(n_,k_));
+        herk<storage_type>(av, ampblas::uplo::lower, ampblas::transpose::no_trans, real_type(-1), a_sub, real_type(1), c_sub);
+    }
+}
+
+// update of the block row (upper) or column (lower) at j by the previous ones; does not depend on the diagonal block
+template <enum class ordering storage_type, typename value_type>
+void potrf_update_panel(const concurrency::accelerator_view& av, enum class uplo uplo, const concurrency::array_view<value_type,2>& a, int j, int jb)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const int n = require_square(a);
+
+    int m_ = jb;
+    int n_ = n-j-jb;
+    int k_ = j;
+
+    if (m_ == 0 || n_ == 0 || k_ == 0)
+        return;
+
+    if (uplo == uplo::upper)
+    {
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(0,j), extent<2>(k_,m_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(0,j+jb), extent<2>(k_,n_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a, index<2>(j,j+jb), extent<2>(m_,n_));
+        gemm<storage_type>(av, ampblas::transpose::conj_trans, ampblas::transpose::no_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
+    }
+    else
+    {
+        array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,0), extent<2>(n_,k_));
+        array_view<const value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(j,0), extent<2>(m_,k_));
+        array_view<value_type,2> c_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,j), extent<2>(n_,m_));
+        gemm<storage_type>(av, ampblas::transpose::no_trans, ampblas::transpose::conj_trans, value_type(-1), a_sub, b_sub, value_type(1), c_sub);
+    }
+}
+
+// solve of the block row (upper) or column (lower) at j with the factored diagonal block, restricted to c1:c2
+template <enum class ordering storage_type, typename value_type>
+void potrf_solve_panel(const concurrency::accelerator_view& av, enum class uplo uplo, const concurrency::array_view<value_type,2>& a, int j, int jb, int c1, int c2)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    int m_ = jb;
+    int n_ = c2-c1;
+
+    if (m_ <= 0 || n_ <= 0)
+        return;
+
+    array_view<const value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(m_,m_));
+
+    if (uplo == uplo::upper)
+    {
+        array_view<value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(j,c1), extent<2>(m_,n_));
+        trsm<storage_type>(av, ampblas::side::left, ampblas::uplo::upper, ampblas::transpose::conj_trans, ampblas::diag::non_unit, value_type(1), a_sub, b_sub);
+    }
+    else
+    {
+        array_view<value_type,2> b_sub = get_sub_matrix<storage_type>(a, index<2>(c1,j), extent<2>(n_,m_));
+        trsm<storage_type>(av, ampblas::side::right, ampblas::uplo::lower, ampblas::transpose::conj_trans, ampblas::diag::non_unit, value_type(1), a_sub, b_sub);
+    }
+}
+
+// TODO: a tuning framework
+const int potrf_block_size = 256;
+const int potrf_look_ahead_depth = 1;
+
+// queues a factorization with every diagonal block factored in place by accl::potf2; the host
+// never waits for the accelerator and the data error (0 if none) is left in an accelerator 
+// view, valid once the queued work has completed
+template <int block_size, enum class ordering storage_type, typename value_type>
+void potrf_queue(context& ctx, enum class uplo uplo, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<int,1>& info)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const concurrency::accelerator_view& av = ctx.get_view();
+
+    // matrix size
+    const int n = require_square(a);
+
+    // no data error so far
+    concurrency::parallel_for_each(av, info.extent, [=] (index<1> idx) restrict(amp) {
+        info[idx] = 0;
+    });
+
+    for (int j = 0; j < n; j += block_size)
+    {
+        int jb = std::min(block_size, n-j);
+
+        potrf_update_diagonal<storage_type>(av, uplo, a, j, jb);
+        potrf_update_panel<storage_type>(av, uplo, a, j, jb);
+
+        array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(jb,jb));
+        accl::potf2<storage_type>(av, uplo, a_sub, info, j);
+
+        potrf_solve_panel<storage_type>(av, uplo, a, j, jb, j+jb, n);
+        ctx.get_view().flush();
+    }
+}
+
+// Look ahead: the update of block row (column) j does not need the factored diagonal block,
+// so it is queued before the host factors that block. Once the block is uploaded the solve
+// is applied to the next look_ahead_depth blocks first, the next diagonal block is updated
+// and its download started, and only then is the rest of the solve queued. The host factors
+// the next diagonal block while the accelerator finishes the current solve and runs the 
+// next update. A depth of 0 still overlaps the update with the host factorization but does
+// not start the next diagonal block early.
+//
+// With block_factor_location::accelerator the factorization is queued by potrf_queue and 
+// only the final data error is moved to the host.
+template <int block_size, int look_ahead_depth, enum class ordering storage_type, enum class block_factor_location location, typename value_type>
+void potrf(context& ctx, enum class uplo uplo, const concurrency::array_view<value_type,2>& a)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    static_assert(look_ahead_depth >= 0, "look ahead depth must not be negative");
+
+    const concurrency::accelerator_view& av = ctx.get_view();
+
+    // matrix size
+    const int n = require_square(a);
+
+    if (location == block_factor_location::accelerator)
+    {
+        // first failing column found by the accelerator block factorization
+        std::vector<int> accl_info_data(1, 0);
+        array_view<int,1> accl_info(1, accl_info_data);
+
+        potrf_queue<block_size, storage_type>(ctx, uplo, a, accl_info);
+
+        // rethrow data error (if any)
+        const int info = accl_info[index<1>(0)];
+        if (info)
+            data_error(info);
+
+        return;
+    }
+
+    // the next diagonal block to be factored, if its download has already been started
+    std::unique_ptr<host_panel<value_type>> next_block;
+
+    // block stepping
+    for (int j = 0; j < n; j += block_size)
+    {
+        // current block size
+        int jb = std::min(block_size, n-j);
+
+        // update diagonal block and start moving it to the host
+        if (!next_block)
+        {
+            potrf_update_diagonal<storage_type>(av, uplo, a, j, jb);
+
+            array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j,j), extent<2>(jb,jb));
+            next_block.reset(new host_panel<value_type>(ctx.get_staging_pool(), a_sub));
+        }
+
+        std::unique_ptr<host_panel<value_type>> block(std::move(next_block));
+
+        // update the current block row (column) while the host factors the diagonal block
+        potrf_update_panel<storage_type>(av, uplo, a, j, jb);
+        ctx.get_view().flush();
+
+        // factorize current block
+        try
+        {
+            host::potrf<storage_type>(*block, uplo);
+        }
+        catch(const data_error_exception& e)
+        {
+            // offset local block error
+            data_error(e.get() + j);
+        }
+
+        if (j+jb < n)
+        {
+            // solve the look ahead blocks
+            const int ahead = std::min(n, j+jb+look_ahead_depth*block_size);
+            potrf_solve_panel<storage_type>(av, uplo, a, j, jb, j+jb, ahead);
+
+            // update the next diagonal block and start moving it to the host
+            if (look_ahead_depth > 0)
+            {
+                int jb_next = std::min(block_size, n-j-jb);
+                potrf_update_diagonal<storage_type>(av, uplo, a, j+jb, jb_next);
+
+                array_view<value_type,2> a_sub = get_sub_matrix<storage_type>(a, index<2>(j+jb,j+jb), extent<2>(jb_next,jb_next));
+                next_block.reset(new host_panel<value_type>(ctx.get_staging_pool(), a_sub));
+            }
+
+            // solve the remaining blocks
+            potrf_solve_panel<storage_type>(av, uplo, a, j, jb, ahead, n);
+            ctx.get_view().flush();
+        }
+    }
+}
+
+// solves a * x = b with the factor of an n by n potrf, overwriting b with x
+template <enum class ordering storage_type, typename value_type>
+void potrs(const concurrency::accelerator_view& av, enum class uplo uplo, const concurrency::array_view<const value_type,2>& a, concurrency::array_view<value_type,2>& b)
+{
+    if (uplo == uplo::upper)
+    {
+        // a = u' * u
+        trsm<storage_type>(av, ampblas::side::left, ampblas::uplo::upper, ampblas::transpose::conj_trans, ampblas::diag::non_unit, value_type(1), a, b);
+        trsm<storage_type>(av, ampblas::side::left, ampblas::uplo::upper, ampblas::transpose::no_trans, ampblas::diag::non_unit, value_type(1), a, b);
+    }
+    else
+    {
+        // a = l * l'
+        trsm<storage_type>(av, ampblas::side::left, ampblas::uplo::lower, ampblas::transpose::no_trans, ampblas::diag::non_unit, value_type(1), a, b);
+        trsm<storage_type>(av, ampblas::side::left, ampblas::uplo::lower, ampblas::transpose::conj_trans, ampblas::diag::non_unit, value_type(1), a, b);
+    }
+}
+
+// elements of b per chunk buffer: 2^24 (64 MB of float up to 256 MB of double complex) keeps
+// each copy long enough to run near the bus bandwidth and each trsm wide enough to fill the
+// accelerator, while the two buffers still fit beside a large factor in accelerator memory
+const int potrs_chunk_elements = 1 << 24;
+
+// Streaming: the right hand sides of a host matrix b (column major, n by nrhs) are solved 
+// against a factor already on the accelerator in chunks of columns, so b never has to fit 
+// on the accelerator. Two chunk buffers alternate: while one chunk is solved the next is 
+// uploaded into the other buffer and the previous result is downloaded from it.
+template <typename value_type>
+void potrs_stream(context& ctx, enum class uplo uplo, const concurrency::array_view<const value_type,2>& a, int nrhs, value_type* b, int ldb)
+{
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    const int n = require_square(a);
+
+    // columns per chunk
+    const int chunk = std::max(1, std::min(nrhs, potrs_chunk_elements / std::max(n,1)));
+    const int chunks = (nrhs + chunk - 1) / chunk;
+
+    array_view<value_type,2> host_view_b = array_view<value_type,2>(nrhs, ldb, b).section(index<2>(0,0), extent<2>(nrhs,n));
+
+    // double buffering
+    std::unique_ptr<pooled_array<value_type>> buffers[2];
+    concurrency::completion_future uploads[2];
+    concurrency::completion_future downloads[2];
+
+    for (int i = 0; i < std::min(chunks,2); i++)
+        buffers[i].reset(new pooled_array<value_type>(ctx.get_pool(), extent<2>(chunk,n)));
+
+    auto host_chunk = [&] (int c) -> array_view<value_type,2>
+    {
+        return host_view_b.section(index<2>(c*chunk,0), extent<2>(std::min(chunk, nrhs-c*chunk),n));
+    };
+
+    auto accl_chunk = [&] (int c) -> array_view<value_type,2>
+    {
+        return buffers[c%2]->get_view().section(index<2>(0,0), extent<2>(std::min(chunk, nrhs-c*chunk),n));
+    };
+
+    try
+    {
+        uploads[0] = concurrency::copy_async(host_chunk(0), accl_chunk(0));
+        ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_chunk(0).extent));
+
+        for (int c = 0; c < chunks; c++)
+        {
+            const int current = c%2;
+            const int next = 1-current;
+
+            // start the next upload once the previous download from its buffer has finished
+            if (c+1 < chunks)
+            {
+                if (downloads[next].valid())
+                    downloads[next].wait();
+
+                uploads[next] = concurrency::copy_async(host_chunk(c+1), accl_chunk(c+1));
+                ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_chunk(c+1).extent));
+            }
+
+            // solve the current chunk and start moving it back
+            uploads[current].wait();
+
+            array_view<value_type,2> x = accl_chunk(c);
+            potrs<ordering::column_major, value_type>(ctx.get_view(), uplo, a, x);
+
+            downloads[current] = concurrency::copy_async(x, host_chunk(c));
+            ctx.get_transfers().add_to_host(get_bytes<value_type>(x.extent));
+        }
+    }
+    catch(...)
+    {
+        // the buffers must outlive every copy still in flight
+        for (int i = 0; i < 2; i++)
+        {
+            try { if (uploads[i].valid()) uploads[i].wait(); } catch(...) {}
+            try { if (downloads[i].valid()) downloads[i].wait(); } catch(...) {}
+        }
+
+        throw;
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (downloads[i].valid())
+            downloads[i].wait();
+    }
+}
+
+//
+// Forwarding Functions
+//
+
+// this is a work around until VS std::bind can accept more paramaters
+template <typename value_type>
+struct potrf_async_params
+{
+    char uplo;
+    int n;
+    value_type* a;
+    int lda;
+
+    potrf_async_params(char uplo, int n, value_type* a, int lda)
+        : uplo(uplo), n(n), a(a), lda(lda)
+    {}
+};
+
+template <enum class execution_target target, typename value_type>
+void potrf_async_unpack(context& ctx, async_call& call, const potrf_async_params<value_type>& p)
+{
+    amplapack::potrf_async<target>(ctx, p.uplo, p.n, p.a, p.lda, call); 
+}
+
+template <typename value_type>
+struct potrs_params
+{
+    char uplo;
+    int n;
+    int nrhs;
+    const value_type* a;
+    int lda;
+    value_type* b;
+    int ldb;
+
+    potrs_params(char uplo, int n, int nrhs, const value_type* a, int lda, value_type* b, int ldb)
+        : uplo(uplo), n(n), nrhs(nrhs), a(a), lda(lda), b(b), ldb(ldb)
+    {}
+};
+
+template <enum class execution_target target, typename value_type>
+void potrs_unpack(context& ctx, const potrs_params<value_type>& p)
+{
+    amplapack::potrs<target>(ctx, p.uplo, p.n, p.nrhs, p.a, p.lda, p.b, p.ldb); 
+}
+
+template <typename value_type>
+struct posv_params
+{
+    char uplo;
+    int n;
+    int nrhs;
+    value_type* a;
+    int lda;
+    value_type* b;
+    int ldb;
+
+    posv_params(char uplo, int n, int nrhs, value_type* a, int lda, value_type* b, int ldb)
+        : uplo(uplo), n(n), nrhs(nrhs), a(a), lda(lda), b(b), ldb(ldb)
+    {}
+};
+
+template <enum class execution_target target, typename value_type>
+void posv_unpack(context& ctx, const posv_params<value_type>& p)
+{
+    amplapack::posv<target>(ctx, p.uplo, p.n, p.nrhs, p.a, p.lda, p.b, p.ldb); 
+}
+
+} // namespace _detail
+
+//
+// Array View Interface
+//
+
+template <enum class ordering storage_type, enum class block_factor_location location, typename value_type>
+void potrf(context& ctx, enum class uplo uplo, const concurrency::array_view<value_type,2>& a)
+{
+    _detail::potrf<_detail::potrf_block_size, _detail::potrf_look_ahead_depth, storage_type, location>(ctx, uplo, a);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void potrf(context& ctx, enum class uplo uplo, const concurrency::array_view<value_type,2>& a)
+{
+    potrf<storage_type, block_factor_location::host>(ctx, uplo, a);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void potrf(const concurrency::accelerator_view& av, enum class uplo uplo, const concurrency::array_view<value_type,2>& a)
+{
+    context ctx(av);
+    potrf<storage_type>(ctx, uplo, a);
+}
+
+// queues the factorization on the accelerator (as block_factor_location::accelerator) and 
+// returns without waiting for it; info (the first failing column, 0 if none) is written by
+// the queued work and is valid once the returned future has completed
+template <enum class ordering storage_type, typename value_type>
+concurrency::completion_future potrf_async(context& ctx, enum class uplo uplo, const concurrency::array_view<value_type,2>& a, concurrency::array_view<int,1>& info)
+{
+    _detail::potrf_queue<_detail::potrf_block_size, storage_type>(ctx, uplo, a, info);
+    return ctx.get_view().create_marker();
+}
+
+// solves a * x = b with the factor returned by potrf, overwriting b with x; the factor may stay
+// on the accelerator between the factorization and any number of solves
+template <enum class ordering storage_type, typename value_type>
+void potrs(context& ctx, enum class uplo uplo, const concurrency::array_view<const value_type,2>& a, concurrency::array_view<value_type,2>& b)
+{
+    _detail::potrs<storage_type>(ctx.get_view(), uplo, a, b);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void potrs(const concurrency::accelerator_view& av, enum class uplo uplo, const concurrency::array_view<const value_type,2>& a, concurrency::array_view<value_type,2>& b)
+{
+    context ctx(av);
+    potrs<storage_type>(ctx, uplo, a, b);
+}
+
+// factors a and solves a * x = b, overwriting the uplo triangle of a with its factor and b with x
+template <enum class ordering storage_type, enum class block_factor_location location, typename value_type>
+void posv(context& ctx, enum class uplo uplo, const concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,2>& b)
+{
+    potrf<storage_type, location>(ctx, uplo, a);
+    potrs<storage_type, value_type>(ctx, uplo, a, b);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void posv(context& ctx, enum class uplo uplo, const concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,2>& b)
+{
+    posv<storage_type, block_factor_location::host>(ctx, uplo, a, b);
+}
+
+template <enum class ordering storage_type, typename value_type>
+void posv(const concurrency::accelerator_view& av, enum class uplo uplo, const concurrency::array_view<value_type,2>& a, concurrency::array_view<value_type,2>& b)
+{
+    context ctx(av);
+    posv<storage_type>(ctx, uplo, a, b);
+}
+
+//
+// Host Interface Function
+//
+
+template <enum class execution_target target, typename value_type>
+void potrf(context& ctx, char uplo, int n, value_type* a, int lda)
+{
+    // quick return
+    if (n == 0)
+        return;
+    
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < n)
+        argument_error(5);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        int info;
+        _detail::lapack::potrf(uplo, n, a, lda, info);
+        info_check(info);
+        return;
+    }
+
+    // host views
+    concurrency::array_view<value_type,2> host_view_a(n, lda, a);
+    concurrency::array_view<value_type,2> host_view_a_sub = host_view_a.section(concurrency::index<2>(0,0), concurrency::extent<2>(n,n));
+
+    // accelerator copy of a (drawn from the context's pool)
+    pooled_array<value_type> accl_a(ctx.get_pool(), host_view_a_sub.extent);
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::copy(host_view_a_sub, accl_view_a);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+    // forwarding function
+    potrf<ordering::column_major, (target == execution_target::accelerator ? block_factor_location::accelerator : block_factor_location::host)>(ctx, to_option(uplo), accl_view_a);
+
+    // copy back to host
+    concurrency::copy(accl_view_a, host_view_a_sub);
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_a.extent));
+}
+
+template <typename value_type>
+void potrf(context& ctx, char uplo, int n, value_type* a, int lda)
+{
+    potrf<execution_target::hybrid>(ctx, uplo, n, a, lda);
+}
+
+template <typename value_type>
+void potrf(concurrency::accelerator_view& av, char uplo, int n, value_type* a, int lda)
+{
+    context ctx(av);
+    potrf(ctx, uplo, n, a, lda);
+}
+
+// queues potrf and returns once a has been uploaded; a is written back by a copy owned by 
+// call, which reports the data error when waited on. The host target factors a before
+// returning.
+template <enum class execution_target target, typename value_type>
+void potrf_async(context& ctx, char uplo, int n, value_type* a, int lda, async_call& call)
+{
+    // quick return
+    if (n == 0)
+        return;
+    
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < n)
+        argument_error(5);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        _detail::lapack::potrf(uplo, n, a, lda, *call.get_info());
+        return;
+    }
+
+    // host views
+    concurrency::array_view<value_type,2> host_view_a(n, lda, a);
+    concurrency::array_view<value_type,2> host_view_a_sub = host_view_a.section(concurrency::index<2>(0,0), concurrency::extent<2>(n,n));
+
+    // accelerator copies owned by the call until it completes (drawn from the context's pool)
+    pooled_array<value_type>& accl_a = call.hold(new pooled_array<value_type>(ctx.get_pool(), host_view_a_sub.extent));
+    pooled_array<int>& accl_info = call.hold(new pooled_array<int>(ctx.get_pool(), concurrency::extent<2>(1,1)));
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::array_view<int,1> accl_view_info = accl_info.get_view()[0];
+
+    concurrency::copy(host_view_a_sub, accl_view_a);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+    _detail::potrf_queue<_detail::potrf_block_size, ordering::column_major>(ctx, to_option(uplo), accl_view_a, accl_view_info);
+
+    // copies back to host (complete the call)
+    call.add(concurrency::copy_async(accl_view_a, host_view_a_sub));
+    call.add(concurrency::copy_async(accl_view_info, call.get_info()));
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_a.extent));
+}
+
+template <typename value_type>
+void potrf_async(context& ctx, char uplo, int n, value_type* a, int lda, async_call& call)
+{
+    potrf_async<execution_target::accelerator>(ctx, uplo, n, a, lda, call);
+}
+
+// b is streamed through the accelerator in chunks (see potrs_stream) and may be larger than 
+// the accelerator memory
+template <enum class execution_target target, typename value_type>
+void potrs(context& ctx, char uplo, int n, int nrhs, const value_type* a, int lda, value_type* b, int ldb)
+{
+    // quick return
+    if (n == 0 || nrhs == 0)
+        return;
+
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (nrhs < 0)
+        argument_error(4);
+    if (a == nullptr)
+        argument_error(5);
+    if (lda < n)
+        argument_error(6);
+    if (b == nullptr)
+        argument_error(7);
+    if (ldb < n)
+        argument_error(8);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        int info;
+        _detail::lapack::potrs(uplo, n, nrhs, a, lda, b, ldb, info);
+        info_check(info);
+        return;
+    }
+
+    // host view
+    concurrency::array_view<const value_type,2> host_view_a = concurrency::array_view<const value_type,2>(n, lda, a).section(concurrency::index<2>(0,0), concurrency::extent<2>(n,n));
+
+    // accelerator copy of the factor (drawn from the context's pool)
+    pooled_array<value_type> accl_a(ctx.get_pool(), host_view_a.extent);
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::copy(host_view_a, accl_view_a);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+    // solve
+    _detail::potrs_stream<value_type>(ctx, to_option(uplo), accl_view_a, nrhs, b, ldb);
+}
+
+template <typename value_type>
+void potrs(context& ctx, char uplo, int n, int nrhs, const value_type* a, int lda, value_type* b, int ldb)
+{
+    potrs<execution_target::hybrid>(ctx, uplo, n, nrhs, a, lda, b, ldb);
+}
+
+// the factor only crosses to the host once, after the solve
+template <enum class execution_target target, typename value_type>
+void posv(context& ctx, char uplo, int n, int nrhs, value_type* a, int lda, value_type* b, int ldb)
+{
+    // quick return
+    if (n == 0)
+        return;
+
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (nrhs < 0)
+        argument_error(4);
+    if (a == nullptr)
+        argument_error(5);
+    if (lda < n)
+        argument_error(6);
+    if (b == nullptr && nrhs > 0)
+        argument_error(7);
+    if (ldb < n)
+        argument_error(8);
+
+    // small problems skip the accelerator altogether
+    if (target == execution_target::host)
+    {
+        int info;
+        _detail::lapack::potrf(uplo, n, a, lda, info);
+        info_check(info);
+
+        if (nrhs > 0)
+        {
+            _detail::lapack::potrs(uplo, n, nrhs, a, lda, b, ldb, info);
+            info_check(info);
+        }
+
+        return;
+    }
+
+    // host view
+    concurrency::array_view<value_type,2> host_view_a = concurrency::array_view<value_type,2>(n, lda, a).section(concurrency::index<2>(0,0), concurrency::extent<2>(n,n));
+
+    // accelerator copy of a (drawn from the context's pool)
+    pooled_array<value_type> accl_a(ctx.get_pool(), host_view_a.extent);
+    concurrency::array_view<value_type,2> accl_view_a = accl_a.get_view();
+    concurrency::copy(host_view_a, accl_view_a);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+    auto copy_back = [&] {
+        concurrency::copy(accl_view_a, host_view_a);
+        ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_a.extent));
+    };
+
+    // factor and solve on the accelerator
+    try
+    {
+        potrf<ordering::column_major, (target == execution_target::accelerator ? block_factor_location::accelerator : block_factor_location::host)>(ctx, to_option(uplo), accl_view_a);
+    }
+    catch(const data_error_exception&)
+    {
+        // as LAPACK, return the partial factor of a matrix that is not positive definite
+        copy_back();
+        throw;
+    }
+
+    if (nrhs > 0)
+        _detail::potrs_stream<value_type>(ctx, to_option(uplo), accl_view_a, nrhs, b, ldb);
+
+    // copy back to host
+    copy_back();
+}
+
+template <typename value_type>
+void posv(context& ctx, char uplo, int n, int nrhs, value_type* a, int lda, value_type* b, int ldb)
+{
+    posv<execution_target::hybrid>(ctx, uplo, n, nrhs, a, lda, b, ldb);
+}
+
+// pooled device memory (in bytes) used by the host interface for an n by n problem
+template <typename value_type>
+size_t potrf_workspace(int n)
+{
+    workspace_query query;
+
+    // accelerator copy of a
+    query.add<value_type>(concurrency::extent<2>(n,n));
+
+    return query.get_bytes();
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_POTRF_H
@@ -0,0 +1,569 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* refine.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_REFINE_H
+#define AMPLAPACK_REFINE_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "amplapack_config.h"
+#include "getrf.h"
+#include "potrf.h"
+
+namespace amplapack {
+namespace _detail {
+
+//
+// Mixed Precision Iterative Refinement
+//
+// A double precision system is solved with a single precision factorization, which runs 
+// several times faster on most accelerators, and the solution is refined in double precision
+// as in LAPACK's dsgesv and dsposv: x = inv(a) * b in single precision, then r = b - a * x in 
+// double precision and x += inv(a) * r in single precision until the residual of every column
+// is below ||x|| * ||a|| * eps * sqrt(n). The matrix, right hand sides, solution and residual 
+// stay on the accelerator throughout; only the column norms are read back per iteration.
+//
+// When the single precision factorization cannot be used (an element overflows, the matrix is 
+// singular in single precision or the refinement does not converge) the system is factored 
+// and solved in double precision instead. The reason is reported as a negative iteration 
+// count:
+//
+//   -2                              an element of a, b or a residual overflows single precision
+//   -3                              the single precision factorization failed
+//   -(refine_max_iterations+1)      the refinement did not converge
+//
+
+// single precision counterpart of a double precision type
+template <typename value_type> struct lower_precision;
+template <> struct lower_precision<double> { typedef float type; };
+template <> struct lower_precision<ampblas::complex<double>> { typedef ampblas::complex<float> type; };
+
+// the limits used by LAPACK
+const int refine_max_iterations = 30;
+const double refine_backward_error = 1.0;
+
+// converts a to the lower precision of b, setting overflow[0] if an element is out of range
+template <typename value_type, typename low_type>
+void demote(const concurrency::accelerator_view& av, const concurrency::array_view<const value_type,2>& a, const concurrency::array_view<low_type,2>& b, const concurrency::array_view<int,1>& overflow)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+    typedef typename ampblas::real_type<low_type>::type low_real_type;
+
+    const real_type rmax = real_type(std::numeric_limits<low_real_type>::max());
+
+    concurrency::parallel_for_each(av, a.extent, [=] (concurrency::index<2> idx) restrict(amp)
+    {
+        const real_type re = real_part(a[idx]);
+        const real_type im = imag_part(a[idx]);
+
+        if (re < -rmax || re > rmax || im < -rmax || im > rmax)
+            overflow[concurrency::index<1>(0)] = 1;
+
+        low_type value;
+        from_parts(value, low_real_type(re), low_real_type(im));
+        b[idx] = value;
+    });
+}
+
+// converts a to the higher precision of b, adding it to b if accumulate is set
+template <typename low_type, typename value_type>
+void promote(const concurrency::accelerator_view& av, const concurrency::array_view<const low_type,2>& a, const concurrency::array_view<value_type,2>& b, bool accumulate)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    concurrency::parallel_for_each(av, a.extent, [=] (concurrency::index<2> idx) restrict(amp)
+    {
+        value_type value;
+        from_parts(value, real_type(real_part(a[idx])), real_type(imag_part(a[idx])));
+
+        b[idx] = (accumulate ? b[idx] + value : value);
+    });
+}
+
+// fills the triangle of an n by n hermitian matrix that is not referenced by uplo and drops the
+// imaginary part of its diagonal, so that it can be multiplied by gemm
+template <enum class ordering storage_type, typename value_type>
+void make_hermitian(const concurrency::accelerator_view& av, enum class uplo uplo, const concurrency::array_view<value_type,2>& a)
+{
+    const bool upper = (uplo == uplo::upper);
+
+    concurrency::parallel_for_each(av, a.extent, [=] (concurrency::index<2> idx) restrict(amp)
+    {
+        const int i = idx[0];
+        const int j = idx[1];
+
+        if (i == j)
+            from_parts(get_element<storage_type>(a, i, i), real_part(get_element<storage_type>(a, i, i)), imag_part(value_type()));
+        else if ((i > j) == upper)
+            get_element<storage_type>(a, i, j) = conjugate(get_element<storage_type>(a, j, i));
+    });
+}
+
+// largest element of each column of a, measured with |re| + |im| as LAPACK's convergence 
+// test does
+template <enum class ordering storage_type, typename value_type>
+void column_norms(const concurrency::accelerator_view& av, const concurrency::array_view<const value_type,2>& a, const concurrency::array_view<typename ampblas::real_type<value_type>::type,1>& norm)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    static const int tile_size = 256;
+    static const int max_tiles = 4096;
+
+    const int m = get_rows<storage_type>(a);
+    const int n = get_cols<storage_type>(a);
+
+    // one tile per column
+    const int tiles = std::min(n, max_tiles);
+
+    concurrency::parallel_for_each(
+        av,
+        concurrency::extent<1>(tiles*tile_size).tile<tile_size>(),
+        [=] (concurrency::tiled_index<tile_size> tidx) restrict(amp)
+        {
+            tile_static real_type partial[tile_size];
+
+            const int tid = tidx.local[0];
+
+            for (int j = tidx.tile[0]; j < n; j += tiles)
+            {
+                real_type value = real_type(0);
+
+                for (int i = tid; i < m; i += tile_size)
+                {
+                    const real_type candidate = abs1(get_element<storage_type>(a, i, j));
+
+                    if (candidate > value)
+                        value = candidate;
+                }
+
+                partial[tid] = value;
+                tidx.barrier.wait();
+
+                for (int stride = tile_size/2; stride > 0; stride /= 2)
+                {
+                    if (tid < stride && partial[tid+stride] > partial[tid])
+                        partial[tid] = partial[tid+stride];
+
+                    tidx.barrier.wait();
+                }
+
+                if (tid == 0)
+                    norm[concurrency::index<1>(j)] = partial[0];
+
+                tidx.barrier.wait();
+            }
+        }
+    );
+}
+
+// largest row sum of a (infinity norm), measured with |re| + |im|
+template <enum class ordering storage_type, typename value_type>
+typename ampblas::real_type<value_type>::type infinity_norm(const concurrency::accelerator_view& av, const concurrency::array_view<const value_type,2>& a)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    const int m = get_rows<storage_type>(a);
+    const int n = get_cols<storage_type>(a);
+
+    // one thread per row
+    std::vector<real_type> sums_data(m);
+    concurrency::array_view<real_type,1> sums(m, sums_data);
+    sums.discard_data();
+
+    concurrency::parallel_for_each(av, sums.extent, [=] (concurrency::index<1> idx) restrict(amp)
+    {
+        real_type sum = real_type(0);
+
+        for (int j = 0; j < n; j++)
+            sum += abs1(get_element<storage_type>(a, idx[0], j));
+
+        sums[idx] = sum;
+    });
+
+    sums.synchronize();
+    return *std::max_element(sums_data.begin(), sums_data.end());
+}
+
+// r = b - a * x
+template <typename value_type>
+void residual(const concurrency::accelerator_view& av, const concurrency::array_view<const value_type,2>& a, const concurrency::array_view<const value_type,2>& b, const concurrency::array_view<const value_type,2>& x, concurrency::array_view<value_type,2>& r)
+{
+    concurrency::copy(b, r);
+    gemm<ordering::column_major>(av, ampblas::transpose::no_trans, ampblas::transpose::no_trans, value_type(-1), a, x, value_type(1), r);
+}
+
+// refines the solution x of a * x = b (column major, on the accelerator) from a single 
+// precision factorization and returns the iteration count; factor(low_a) factors the single
+// precision copy of a in place and solve(low_a, low_x) overwrites low_x with inv(a) * low_x
+template <typename value_type, typename factor_function, typename solve_function>
+int refine(context& ctx, const concurrency::array_view<value_type,2>& a, const concurrency::array_view<value_type,2>& b, const concurrency::array_view<value_type,2>& x, factor_function factor, solve_function solve)
+{
+    typedef typename lower_precision<value_type>::type low_type;
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    using concurrency::array_view;
+
+    const concurrency::accelerator_view& av = ctx.get_view();
+
+    const int n = get_rows<ordering::column_major>(a);
+    const int nrhs = get_cols<ordering::column_major>(b);
+
+    // single precision copies of a and of the right hand side (or residual)
+    pooled_array<low_type> low_a_array(ctx.get_pool(), a.extent);
+    pooled_array<low_type> low_x_array(ctx.get_pool(), b.extent);
+    array_view<low_type,2> low_a = low_a_array.get_view();
+    array_view<low_type,2> low_x = low_x_array.get_view();
+
+    // double precision residual
+    pooled_array<value_type> r_array(ctx.get_pool(), b.extent);
+    array_view<value_type,2> r = r_array.get_view();
+
+    // results read back by the host
+    std::vector<int> overflow_data(1, 0);
+    array_view<int,1> overflow(1, overflow_data);
+
+    std::vector<real_type> x_norm_data(nrhs), r_norm_data(nrhs);
+    array_view<real_type,1> x_norm(nrhs, x_norm_data);
+    array_view<real_type,1> r_norm(nrhs, r_norm_data);
+
+    // the convergence threshold (LAPACK's eps is half the machine epsilon)
+    const real_type a_norm = infinity_norm<ordering::column_major, value_type>(av, a);
+    const real_type eps = std::numeric_limits<real_type>::epsilon() / real_type(2);
+    const real_type threshold = a_norm * eps * std::sqrt(real_type(n)) * real_type(refine_backward_error);
+
+    // single precision factorization
+    demote<value_type, low_type>(av, a, low_a, overflow);
+    demote<value_type, low_type>(av, b, low_x, overflow);
+
+    if (overflow[0])
+        return -2;
+
+    try
+    {
+        factor(low_a);
+    }
+    catch (const data_error_exception&)
+    {
+        return -3;
+    }
+
+    // initial solution
+    solve(low_a, low_x);
+    promote<low_type, value_type>(av, low_x, x, false);
+
+    for (int iteration = 0; ; iteration++)
+    {
+        // r = b - a * x
+        residual<value_type>(av, a, b, x, r);
+
+        // converged when ||r(:,j)|| <= ||x(:,j)|| * threshold for every column
+        column_norms<ordering::column_major, value_type>(av, x, x_norm);
+        column_norms<ordering::column_major, value_type>(av, r, r_norm);
+        x_norm.synchronize();
+        r_norm.synchronize();
+
+        bool converged = true;
+        for (int j = 0; j < nrhs; j++)
+            converged = converged && !(r_norm_data[j] > x_norm_data[j] * threshold);
+
+        if (converged)
+            return iteration;
+
+        if (iteration == refine_max_iterations)
+            return -(refine_max_iterations+1);
+
+        // x += inv(a) * r
+        demote<value_type, low_type>(av, r, low_x, overflow);
+
+        if (overflow[0])
+            return -2;
+
+        solve(low_a, low_x);
+        promote<low_type, value_type>(av, low_x, x, true);
+    }
+}
+
+//
+// Forwarding Functions
+//
+
+// this is a work around until VS std::bind can accept more paramaters
+template <typename value_type>
+struct gesv_mixed_params
+{
+    int n;
+    int nrhs;
+    value_type* a;
+    int lda;
+    int* ipiv;
+    value_type* b;
+    int ldb;
+    value_type* x;
+    int ldx;
+    int* iter;
+
+    gesv_mixed_params(int n, int nrhs, value_type* a, int lda, int* ipiv, value_type* b, int ldb, value_type* x, int ldx, int* iter)
+        : n(n), nrhs(nrhs), a(a), lda(lda), ipiv(ipiv), b(b), ldb(ldb), x(x), ldx(ldx), iter(iter)
+    {}
+};
+
+template <typename value_type>
+struct posv_mixed_params
+{
+    char uplo;
+    int n;
+    int nrhs;
+    value_type* a;
+    int lda;
+    value_type* b;
+    int ldb;
+    value_type* x;
+    int ldx;
+    int* iter;
+
+    posv_mixed_params(char uplo, int n, int nrhs, value_type* a, int lda, value_type* b, int ldb, value_type* x, int ldx, int* iter)
+        : uplo(uplo), n(n), nrhs(nrhs), a(a), lda(lda), b(b), ldb(ldb), x(x), ldx(ldx), iter(iter)
+    {}
+};
+
+template <typename value_type>
+void gesv_mixed_unpack(context& ctx, const gesv_mixed_params<value_type>& p)
+{
+    if (p.iter == nullptr)
+        argument_error(11);
+
+    amplapack::gesv_mixed(ctx, p.n, p.nrhs, p.a, p.lda, p.ipiv, p.b, p.ldb, p.x, p.ldx, *p.iter);
+}
+
+template <typename value_type>
+void posv_mixed_unpack(context& ctx, const posv_mixed_params<value_type>& p)
+{
+    if (p.iter == nullptr)
+        argument_error(11);
+
+    amplapack::posv_mixed(ctx, p.uplo, p.n, p.nrhs, p.a, p.lda, p.b, p.ldb, p.x, p.ldx, *p.iter);
+}
+
+} // namespace _detail
+
+//
+// Host Interface Functions
+//
+
+// solves a * x = b (n by n, nrhs right hand sides) for double precision a with a single 
+// precision LU factorization and iterative refinement; a is left unchanged and ipiv holds the
+// single precision pivots unless iter is negative, in which case a and ipiv hold the double 
+// precision factorization that was used instead
+template <typename value_type>
+void gesv_mixed(context& ctx, int n, int nrhs, value_type* a, int lda, int* ipiv, value_type* b, int ldb, value_type* x, int ldx, int& iter)
+{
+    typedef typename _detail::lower_precision<value_type>::type low_type;
+
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    // quick return
+    iter = 0;
+    if (n == 0 || nrhs == 0)
+        return;
+
+    // error checking
+    if (n < 0)
+        argument_error(2);
+    if (nrhs < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < n)
+        argument_error(5);
+    if (ipiv == nullptr)
+        argument_error(6);
+    if (b == nullptr)
+        argument_error(7);
+    if (ldb < n)
+        argument_error(8);
+    if (x == nullptr)
+        argument_error(9);
+    if (ldx < n)
+        argument_error(10);
+
+    // host views
+    array_view<value_type,2> host_view_a = array_view<value_type,2>(n, lda, a).section(index<2>(0,0), extent<2>(n,n));
+    array_view<value_type,2> host_view_b = array_view<value_type,2>(nrhs, ldb, b).section(index<2>(0,0), extent<2>(nrhs,n));
+    array_view<value_type,2> host_view_x = array_view<value_type,2>(nrhs, ldx, x).section(index<2>(0,0), extent<2>(nrhs,n));
+    array_view<int,1> host_view_ipiv(n, ipiv);
+
+    // accelerator copies (drawn from the context's pool)
+    pooled_array<value_type> accl_a(ctx.get_pool(), host_view_a.extent);
+    pooled_array<value_type> accl_b(ctx.get_pool(), host_view_b.extent);
+    pooled_array<value_type> accl_x(ctx.get_pool(), host_view_x.extent);
+    pooled_array<int> accl_ipiv(ctx.get_pool(), extent<2>(1,n));
+    array_view<value_type,2> accl_view_a = accl_a.get_view();
+    array_view<value_type,2> accl_view_b = accl_b.get_view();
+    array_view<value_type,2> accl_view_x = accl_x.get_view();
+    array_view<int,1> accl_view_ipiv = accl_ipiv.get_view()[0];
+
+    concurrency::copy(host_view_a, accl_view_a);
+    concurrency::copy(host_view_b, accl_view_b);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent) + get_bytes<value_type>(accl_view_b.extent));
+
+    // the single precision factorization runs where a single precision getrf of this size would
+    const bool accelerator_panels = (select_target(amplapack_getrf_routine, precision_of<low_type>(), n) == execution_target::accelerator);
+
+    auto factor = [&] (array_view<low_type,2>& low_a)
+    {
+        if (accelerator_panels)
+            getrf<ordering::column_major, block_factor_location::accelerator>(ctx, low_a, accl_view_ipiv);
+        else
+            getrf<ordering::column_major, block_factor_location::host>(ctx, low_a, accl_view_ipiv);
+    };
+
+    auto solve = [&] (const array_view<low_type,2>& low_a, array_view<low_type,2>& low_x)
+    {
+        _detail::getrs<ordering::column_major, low_type>(ctx, ampblas::transpose::no_trans, low_a, accl_view_ipiv, low_x);
+    };
+
+    iter = _detail::refine(ctx, accl_view_a, accl_view_b, accl_view_x, factor, solve);
+
+    // fall back to a double precision factorization
+    if (iter < 0)
+    {
+        getrf<ordering::column_major>(ctx, accl_view_a, accl_view_ipiv);
+
+        concurrency::copy(accl_view_b, accl_view_x);
+        _detail::getrs<ordering::column_major, value_type>(ctx, ampblas::transpose::no_trans, accl_view_a, accl_view_ipiv, accl_view_x);
+
+        concurrency::copy(accl_view_a, host_view_a);
+        ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_a.extent));
+    }
+
+    // copy back to host
+    concurrency::copy(accl_view_ipiv, host_view_ipiv);
+    concurrency::copy(accl_view_x, host_view_x);
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_x.extent) + get_bytes<int>(extent<1>(n)));
+}
+
+// solves a * x = b (n by n hermitian positive definite, nrhs right hand sides) for double 
+// precision a with a single precision Cholesky factorization and iterative refinement; a is
+// left unchanged unless iter is negative, in which case its uplo triangle holds the double 
+// precision factor that was used instead
+template <typename value_type>
+void posv_mixed(context& ctx, char uplo, int n, int nrhs, value_type* a, int lda, value_type* b, int ldb, value_type* x, int ldx, int& iter)
+{
+    typedef typename _detail::lower_precision<value_type>::type low_type;
+
+    using concurrency::array_view;
+    using concurrency::index;
+    using concurrency::extent;
+
+    // quick return
+    iter = 0;
+    if (n == 0 || nrhs == 0)
+        return;
+
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+    if (nrhs < 0)
+        argument_error(4);
+    if (a == nullptr)
+        argument_error(5);
+    if (lda < n)
+        argument_error(6);
+    if (b == nullptr)
+        argument_error(7);
+    if (ldb < n)
+        argument_error(8);
+    if (x == nullptr)
+        argument_error(9);
+    if (ldx < n)
+        argument_error(10);
+
+    const enum class uplo uplo_option = to_option(uplo);
+
+    // host views
+    array_view<value_type,2> host_view_a = array_view<value_type,2>(n, lda, a).section(index<2>(0,0), extent<2>(n,n));
+    array_view<value_type,2> host_view_b = array_view<value_type,2>(nrhs, ldb, b).section(index<2>(0,0), extent<2>(nrhs,n));
+    array_view<value_type,2> host_view_x = array_view<value_type,2>(nrhs, ldx, x).section(index<2>(0,0), extent<2>(nrhs,n));
+
+    // accelerator copies (drawn from the context's pool)
+    pooled_array<value_type> accl_a(ctx.get_pool(), host_view_a.extent);
+    pooled_array<value_type> accl_b(ctx.get_pool(), host_view_b.extent);
+    pooled_array<value_type> accl_x(ctx.get_pool(), host_view_x.extent);
+    array_view<value_type,2> accl_view_a = accl_a.get_view();
+    array_view<value_type,2> accl_view_b = accl_b.get_view();
+    array_view<value_type,2> accl_view_x = accl_x.get_view();
+
+    concurrency::copy(host_view_a, accl_view_a);
+    concurrency::copy(host_view_b, accl_view_b);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent) + get_bytes<value_type>(accl_view_b.extent));
+
+    // the residual is formed by gemm on the full matrix
+    _detail::make_hermitian<ordering::column_major>(ctx.get_view(), uplo_option, accl_view_a);
+
+    // the single precision factorization runs where a single precision potrf of this size would
+    const bool accelerator_panels = (select_target(amplapack_potrf_routine, precision_of<low_type>(), n) == execution_target::accelerator);
+
+    auto factor = [&] (array_view<low_type,2>& low_a)
+    {
+        if (accelerator_panels)
+            potrf<ordering::column_major, block_factor_location::accelerator>(ctx, uplo_option, low_a);
+        else
+            potrf<ordering::column_major, block_factor_location::host>(ctx, uplo_option, low_a);
+    };
+
+    auto solve = [&] (const array_view<low_type,2>& low_a, array_view<low_type,2>& low_x)
+    {
+        _detail::potrs<ordering::column_major, low_type>(ctx.get_view(), uplo_option, low_a, low_x);
+    };
+
+    iter = _detail::refine(ctx, accl_view_a, accl_view_b, accl_view_x, factor, solve);
+
+    // fall back to a double precision factorization of the unmodified matrix (the triangle
+    // filled in above is returned as it was passed)
+    if (iter < 0)
+    {
+        concurrency::copy(host_view_a, accl_view_a);
+        ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(accl_view_a.extent));
+
+        potrf<ordering::column_major>(ctx, uplo_option, accl_view_a);
+
+        concurrency::copy(accl_view_b, accl_view_x);
+        _detail::potrs<ordering::column_major, value_type>(ctx.get_view(), uplo_option, accl_view_a, accl_view_x);
+
+        concurrency::copy(accl_view_a, host_view_a);
+        ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_a.extent));
+    }
+
+    // copy back to host
+    concurrency::copy(accl_view_x, host_view_x);
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(accl_view_x.extent));
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_REFINE_H
@@ -0,0 +1,389 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* task_graph.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_TASK_GRAPH_H
+#define AMPLAPACK_TASK_GRAPH_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "amplapack_config.h"
+
+namespace amplapack {
+namespace _detail {
+
+//
+// Worker Pool
+//
+// Host threads started once and reused: run hands the same job to every worker and to the
+// calling thread and returns when all of them have finished it, so a routine that runs a 
+// graph per step (such as a panel factorization) pays for starting the threads only once.
+// A job must not throw.
+//
+
+class worker_pool
+{
+public:
+    typedef std::function<void(int)> job_type;
+
+    explicit worker_pool(int workers)
+        : generation(0), active(0), stopping(false)
+    {
+        for (int w = 0; w < std::max(1, workers); w++)
+            threads.push_back(std::thread([this, w] { loop(w); }));
+    }
+
+    ~worker_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+
+        wake.notify_all();
+        std::for_each(threads.begin(), threads.end(), [](std::thread& thread) { thread.join(); });
+    }
+
+    int size() const
+    {
+        return static_cast<int>(threads.size());
+    }
+
+    // runs job(w) on every worker w and job(-1) on the calling thread
+    void run(const job_type& job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            current = job;
+            active = size();
+            generation++;
+        }
+
+        wake.notify_all();
+
+        job(-1);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return active == 0; });
+        current = job_type();
+    }
+
+private:
+
+    // non-copyable
+    worker_pool(const worker_pool&);
+    worker_pool& operator=(const worker_pool&);
+
+    void loop(int w)
+    {
+        unsigned int seen = 0;
+
+        for (;;)
+        {
+            job_type job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return stopping || generation != seen; });
+
+                if (stopping)
+                    return;
+
+                seen = generation;
+                job = current;
+            }
+
+            job(w);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--active == 0)
+                done.notify_all();
+        }
+    }
+
+    std::vector<std::thread> threads;
+    job_type current;
+    unsigned int generation;
+    int active;
+    bool stopping;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+};
+
+//
+// Task Graph
+//
+// A task runs as soon as every task it depends on has finished. Each host worker thread
+// owns a deque of ready tasks: the tasks a worker releases are pushed onto its own deque and
+// popped from the back (most recent first, while their data is still in its cache), and an
+// idle worker steals from the front of another worker's deque (oldest first, closest to the
+// critical path). The calling thread drives the accelerator: it steals the oldest task with
+// an accelerator implementation from any deque, passing over host only tasks queued ahead of
+// it, so the accelerator takes work whenever the host workers leave some waiting.
+//
+
+class task_graph
+{
+public:
+    typedef std::function<void()> work_type;
+
+    // adds a task that runs host_work on a host worker or, if given, accelerator_work on the
+    // calling thread; returns its id
+    int add(const work_type& host_work, const work_type& accelerator_work = work_type())
+    {
+        task t;
+        t.host_work = host_work;
+        t.accelerator_work = accelerator_work;
+        t.dependencies = 0;
+
+        tasks.push_back(t);
+        return static_cast<int>(tasks.size()) - 1;
+    }
+
+    // task runs after predecessor has finished
+    void depend(int task_id, int predecessor)
+    {
+        if (task_id == predecessor)
+            return;
+
+        tasks[predecessor].successors.push_back(task_id);
+        tasks[task_id].dependencies++;
+    }
+
+    int size() const
+    {
+        return static_cast<int>(tasks.size());
+    }
+
+    // runs every task on host_workers threads and the calling thread; once a task throws no 
+    // further tasks are started and the first exception is rethrown
+    void run(int host_workers)
+    {
+        worker_pool pool(host_workers);
+        run(pool);
+    }
+
+    // as above, on the threads of a pool that outlives the graph
+    void run(worker_pool& pool)
+    {
+        workers = pool.size();
+        queues.clear();
+
+        for (int w = 0; w < workers; w++)
+            queues.push_back(std::unique_ptr<worker_queue>(new worker_queue));
+
+        pending.reset(new std::atomic<int>[tasks.size()]);
+        remaining = size();
+        ready = 0;
+        offloadable_ready = 0;
+        failed = false;
+        error = nullptr;
+
+        // initially ready tasks are dealt round robin
+        int next = 0;
+        for (int t = 0; t < size(); t++)
+        {
+            pending[t] = tasks[t].dependencies;
+
+            if (tasks[t].dependencies == 0)
+                push(next++ % workers, t);
+        }
+
+        // the calling thread serves the accelerator
+        pool.run([this] (int w) { work_loop(w); });
+
+        if (error != nullptr)
+            std::rethrow_exception(error);
+    }
+
+private:
+    struct task
+    {
+        work_type host_work;
+        work_type accelerator_work;
+        int dependencies;
+        std::vector<int> successors;
+    };
+
+    struct worker_queue
+    {
+        std::mutex mutex;
+        std::deque<int> tasks;
+    };
+
+    bool finished() const
+    {
+        return remaining == 0 || failed;
+    }
+
+    bool offloadable(int t) const
+    {
+        return static_cast<bool>(tasks[t].accelerator_work);
+    }
+
+    void push(int w, int t)
+    {
+        {
+            std::lock_guard<std::mutex> lock(queues[w]->mutex);
+            queues[w]->tasks.push_back(t);
+        }
+
+        // counted under the idle mutex so that a waiting worker cannot miss it
+        {
+            std::lock_guard<std::mutex> lock(idle_mutex);
+            ready++;
+            if (offloadable(t))
+                offloadable_ready++;
+        }
+
+        idle.notify_all();
+    }
+
+    // takes the newest task of the worker's own deque
+    bool pop(int w, int& t)
+    {
+        std::lock_guard<std::mutex> lock(queues[w]->mutex);
+
+        if (queues[w]->tasks.empty())
+            return false;
+
+        t = queues[w]->tasks.back();
+        queues[w]->tasks.pop_back();
+        taken(t);
+        return true;
+    }
+
+    // takes the oldest task of another worker's deque (the oldest offloadable task for the 
+    // accelerator, so that it succeeds whenever offloadable_ready is positive)
+    bool steal(int w, int& t)
+    {
+        const bool accelerator = (w < 0);
+
+        for (int i = 1; i <= workers; i++)
+        {
+            worker_queue& victim = *queues[(std::max(w,0) + i) % workers];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+
+            auto it = victim.tasks.begin();
+            if (accelerator)
+                it = std::find_if(victim.tasks.begin(), victim.tasks.end(), [this](int v) { return offloadable(v); });
+
+            if (it == victim.tasks.end())
+                continue;
+
+            t = *it;
+            victim.tasks.erase(it);
+            taken(t);
+            return true;
+        }
+
+        return false;
+    }
+
+    void taken(int t)
+    {
+        ready--;
+        if (offloadable(t))
+            offloadable_ready--;
+    }
+
+    // w is the worker's deque or -1 for the accelerator thread
+    void work_loop(int w)
+    {
+        const bool accelerator = (w < 0);
+
+        while (!finished())
+        {
+            int t;
+
+            if ((accelerator || !pop(w, t)) && !steal(w, t))
+            {
+                std::unique_lock<std::mutex> lock(idle_mutex);
+                idle.wait(lock, [&] { return finished() || (accelerator ? offloadable_ready > 0 : ready > 0); });
+                continue;
+            }
+
+            execute(t, accelerator ? tasks[t].accelerator_work : tasks[t].host_work, std::max(w,0));
+        }
+    }
+
+    void execute(int t, const work_type& work, int w)
+    {
+        try
+        {
+            work();
+        }
+        catch(...)
+        {
+            {
+                std::lock_guard<std::mutex> lock(idle_mutex);
+
+                if (!failed)
+                    error = std::current_exception();
+
+                failed = true;
+            }
+
+            idle.notify_all();
+            return;
+        }
+
+        // release the successors onto this worker's deque (the first one for the accelerator)
+        std::for_each(tasks[t].successors.begin(), tasks[t].successors.end(), [&](int s) {
+            if (--pending[s] == 0)
+                push(w, s);
+        });
+
+        if (--remaining == 0)
+        {
+            std::lock_guard<std::mutex> lock(idle_mutex);
+            idle.notify_all();
+        }
+    }
+
+    std::vector<task> tasks;
+
+    // execution state
+    int workers;
+    std::vector<std::unique_ptr<worker_queue>> queues;
+    std::unique_ptr<std::atomic<int>[]> pending;
+    std::atomic<int> remaining;
+    std::atomic<int> ready;
+    std::atomic<int> offloadable_ready;
+    std::atomic<bool> failed;
+    std::exception_ptr error;
+
+    std::mutex idle_mutex;
+    std::condition_variable idle;
+};
+
+} // namespace _detail
+} // namespace amplapack
+
+#endif // AMPLAPACK_TASK_GRAPH_H
@@ -0,0 +1,330 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* tile_layout.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_TILE_LAYOUT_H
+#define AMPLAPACK_TILE_LAYOUT_H
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "amplapack_config.h"
+
+namespace amplapack {
+
+//
+// Tile Major Layout
+//
+// An m by n matrix stored as square tiles of tile_size (smaller in the last tile row and 
+// column), each tile contiguous and column major. The tiles of a tile column follow each 
+// other and tile columns follow each other, so the tiles take exactly m*n elements and tile
+// (i,j) starts at j*tile_size*m + i*tile_size*(columns of tile column j). A tile_matrix is a
+// view; it does not own its elements. getrf, potrf and geqrf factor the tiles in place (see 
+// tiled_getrf.h, tiled_potrf.h and tiled_geqrf.h); matrices in the other orderings are 
+// converted with the functions below.
+//
+
+template <typename value_type>
+class tile_matrix
+{
+public:
+    tile_matrix(int m, int n, int tile_size, value_type* data)
+        : m(m), n(n), tile_size(tile_size), data(data)
+    {
+        if (m < 0)
+            argument_error(1);
+        if (n < 0)
+            argument_error(2);
+        if (tile_size < 1)
+            argument_error(3);
+        if (data == nullptr && m*n > 0)
+            argument_error(4);
+    }
+
+    int get_rows() const { return m; }
+    int get_cols() const { return n; }
+    int get_tile_size() const { return tile_size; }
+    value_type* get_data() const { return data; }
+
+    // tile grid
+    int get_tile_rows() const { return (m + tile_size - 1) / tile_size; }
+    int get_tile_cols() const { return (n + tile_size - 1) / tile_size; }
+
+    // rows of the tiles in tile row i, columns of the tiles in tile column j
+    int get_rows(int i) const { return std::min(tile_size, m - i*tile_size); }
+    int get_cols(int j) const { return std::min(tile_size, n - j*tile_size); }
+
+    value_type* get_tile(int i, int j) const
+    {
+        return data + get_offset(i, j);
+    }
+
+    size_t get_offset(int i, int j) const
+    {
+        return size_t(j)*tile_size*m + size_t(i)*tile_size*get_cols(j);
+    }
+
+    // position of element (i,j) in the tiles
+    size_t get_index(int i, int j) const
+    {
+        const int ti = i / tile_size;
+        const int tj = j / tile_size;
+
+        return get_offset(ti, tj) + size_t(j - tj*tile_size)*get_rows(ti) + (i - ti*tile_size);
+    }
+
+    // element (i,j) at position index of the tiles
+    void get_element(size_t index, int& i, int& j) const
+    {
+        const int tj = static_cast<int>(index / (size_t(tile_size)*m));
+        const size_t column_offset = index - size_t(tj)*tile_size*m;
+        const int cols = get_cols(tj);
+
+        const int ti = static_cast<int>(column_offset / (size_t(tile_size)*cols));
+        const size_t tile_offset = column_offset - size_t(ti)*tile_size*cols;
+        const int rows = get_rows(ti);
+
+        i = ti*tile_size + static_cast<int>(tile_offset % rows);
+        j = tj*tile_size + static_cast<int>(tile_offset / rows);
+    }
+
+private:
+    int m;
+    int n;
+    int tile_size;
+    value_type* data;
+};
+
+namespace _detail {
+
+// copies the tiles of b from (to_tiles) or to the matrix a
+template <typename value_type>
+void copy_tiles(enum class ordering storage_type, value_type* a, int lda, const tile_matrix<value_type>& b, bool to_tiles)
+{
+    const int tile_size = b.get_tile_size();
+
+    for (int tj = 0; tj < b.get_tile_cols(); tj++)
+    {
+        for (int ti = 0; ti < b.get_tile_rows(); ti++)
+        {
+            const int rows = b.get_rows(ti);
+            const int cols = b.get_cols(tj);
+            value_type* tile = b.get_tile(ti, tj);
+
+            if (storage_type == ordering::column_major)
+            {
+                // one contiguous run per column
+                value_type* block = a + size_t(tj)*tile_size*lda + ti*tile_size;
+
+                for (int j = 0; j < cols; j++)
+                {
+                    if (to_tiles)
+                        std::memcpy(tile + size_t(j)*rows, block + size_t(j)*lda, rows*sizeof(value_type));
+                    else
+                        std::memcpy(block + size_t(j)*lda, tile + size_t(j)*rows, rows*sizeof(value_type));
+                }
+            }
+            else
+            {
+                // transposed within the tile
+                value_type* block = a + size_t(ti)*tile_size*lda + tj*tile_size;
+
+                for (int i = 0; i < rows; i++)
+                {
+                    for (int j = 0; j < cols; j++)
+                    {
+                        if (to_tiles)
+                            tile[size_t(j)*rows+i] = block[size_t(i)*lda+j];
+                        else
+                            block[size_t(i)*lda+j] = tile[size_t(j)*rows+i];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// copies the tiles of tile column j from tile row k down to (to_panel) or from the column
+// major panel p, whose leading dimension is the number of rows from tile row k down; each
+// tile is one contiguous block of the tile column
+template <typename value_type>
+void copy_panel(const tile_matrix<value_type>& a, int k, int j, value_type* p, bool to_panel)
+{
+    const int tile_size = a.get_tile_size();
+    const int ldp = a.get_rows() - k*tile_size;
+    const int cols = a.get_cols(j);
+
+    for (int ti = k; ti < a.get_tile_rows(); ti++)
+    {
+        const int rows = a.get_rows(ti);
+        value_type* tile = a.get_tile(ti, j);
+        value_type* block = p + (ti-k)*tile_size;
+
+        for (int c = 0; c < cols; c++)
+        {
+            if (to_panel)
+                std::memcpy(block + size_t(c)*ldp, tile + size_t(c)*rows, rows*sizeof(value_type));
+            else
+                std::memcpy(tile + size_t(c)*rows, block + size_t(c)*ldp, rows*sizeof(value_type));
+        }
+    }
+}
+
+// moves every element of a to position destination(k) following the cycles of the 
+// permutation; visited marks the positions already written
+template <typename value_type, typename function_type>
+void permute_in_place(value_type* a, size_t size, function_type destination)
+{
+    std::vector<bool> visited(size);
+
+    for (size_t start = 0; start < size; start++)
+    {
+        if (visited[start])
+            continue;
+
+        value_type carry = a[start];
+        size_t k = start;
+
+        do
+        {
+            const size_t next = destination(k);
+            std::swap(carry, a[next]);
+            visited[next] = true;
+            k = next;
+        }
+        while (k != start);
+    }
+}
+
+} // namespace _detail
+
+//
+// Layout Conversion
+//
+
+// copies the matrix a (leading dimension lda) into the tiles of b, which give its size
+template <typename value_type>
+void to_tile_major(enum class ordering storage_type, const value_type* a, int lda, tile_matrix<value_type>& b)
+{
+    // error checking
+    if (a == nullptr && b.get_rows()*b.get_cols() > 0)
+        argument_error(2);
+    if (lda < std::max(1, storage_type == ordering::column_major ? b.get_rows() : b.get_cols()))
+        argument_error(3);
+
+    _detail::copy_tiles(storage_type, const_cast<value_type*>(a), lda, b, true);
+}
+
+// copies the tiles of a into the matrix b (leading dimension ldb)
+template <typename value_type>
+void from_tile_major(const tile_matrix<value_type>& a, enum class ordering storage_type, value_type* b, int ldb)
+{
+    // error checking
+    if (b == nullptr && a.get_rows()*a.get_cols() > 0)
+        argument_error(3);
+    if (ldb < std::max(1, storage_type == ordering::column_major ? a.get_rows() : a.get_cols()))
+        argument_error(4);
+
+    _detail::copy_tiles(storage_type, b, ldb, a, false);
+}
+
+// rearranges the m by n matrix a, which must not be padded (lda is m for column major and n
+// for row major), into tiles of tile_size and returns them; a column major matrix is 
+// converted one tile column at a time through a buffer of that size, a row major one by 
+// following the cycles of the permutation
+template <typename value_type>
+tile_matrix<value_type> to_tile_major_in_place(enum class ordering storage_type, int m, int n, value_type* a, int tile_size)
+{
+    tile_matrix<value_type> b(m, n, tile_size, a);
+
+    if (storage_type == ordering::column_major)
+    {
+        std::vector<value_type> buffer(size_t(m)*std::min(tile_size, n));
+
+        // a tile column of a covers the same elements as its tiles
+        for (int tj = 0; tj < b.get_tile_cols(); tj++)
+        {
+            value_type* block = a + size_t(tj)*tile_size*m;
+            const int cols = b.get_cols(tj);
+
+            std::copy(block, block + size_t(m)*cols, buffer.begin());
+
+            for (int ti = 0; ti < b.get_tile_rows(); ti++)
+            {
+                const int rows = b.get_rows(ti);
+                value_type* tile = b.get_tile(ti, tj);
+
+                for (int j = 0; j < cols; j++)
+                    std::memcpy(tile + size_t(j)*rows, buffer.data() + size_t(j)*m + ti*tile_size, rows*sizeof(value_type));
+            }
+        }
+    }
+    else
+    {
+        _detail::permute_in_place(a, size_t(m)*n, [&](size_t k) {
+            return b.get_index(static_cast<int>(k / n), static_cast<int>(k % n));
+        });
+    }
+
+    return b;
+}
+
+// rearranges the tiles of a back into an m by n matrix without padding
+template <typename value_type>
+void from_tile_major_in_place(const tile_matrix<value_type>& a, enum class ordering storage_type)
+{
+    const int m = a.get_rows();
+    const int n = a.get_cols();
+    const int tile_size = a.get_tile_size();
+
+    if (storage_type == ordering::column_major)
+    {
+        std::vector<value_type> buffer(size_t(m)*std::min(tile_size, n));
+
+        for (int tj = 0; tj < a.get_tile_cols(); tj++)
+        {
+            value_type* block = a.get_data() + size_t(tj)*tile_size*m;
+            const int cols = a.get_cols(tj);
+
+            for (int ti = 0; ti < a.get_tile_rows(); ti++)
+            {
+                const int rows = a.get_rows(ti);
+                const value_type* tile = a.get_tile(ti, tj);
+
+                for (int j = 0; j < cols; j++)
+                    std::memcpy(buffer.data() + size_t(j)*m + ti*tile_size, tile + size_t(j)*rows, rows*sizeof(value_type));
+            }
+
+            std::copy(buffer.begin(), buffer.begin() + size_t(m)*cols, block);
+        }
+    }
+    else
+    {
+        _detail::permute_in_place(a.get_data(), size_t(m)*n, [&](size_t k) -> size_t {
+            int i, j;
+            a.get_element(k, i, j);
+            return size_t(i)*n + j;
+        });
+    }
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_TILE_LAYOUT_H
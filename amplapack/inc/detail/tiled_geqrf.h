@@ -0,0 +1,197 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* tiled_geqrf.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_TILED_GEQRF_H
+#define AMPLAPACK_TILED_GEQRF_H
+
+#include <thread>
+#include <vector>
+
+#include "amplapack_config.h"
+#include "geqrf.h"
+#include "task_graph.h"
+#include "tile_layout.h"
+#include "tiled_potrf.h"
+
+namespace amplapack {
+namespace _detail {
+
+// builds the task graph of the right looking tiled QR factorization: for each k the tile 
+// column from the diagonal tile down is factored (GEQRF) and the block reflector formed 
+// (LARFT), then for every trailing tile column w = t' * v' * c is accumulated over its tiles
+// and each of its tiles updated as c = c - v * w (the GEMM tasks may also run on the 
+// accelerator). The panel is gathered from its tiles into a column major buffer for the host
+// LAPACK calls and scattered back, one contiguous run per tile column; the reflectors below 
+// the diagonal tile are used where they are, in the tiles, and only the unit triangle of the
+// diagonal tile is kept apart, since the tile itself holds r above it.
+template <typename value_type>
+void geqrf_tiled(context& ctx, const tile_matrix<value_type>& a, value_type* tau, int host_workers)
+{
+    const int m = a.get_rows();
+    const int n = a.get_cols();
+    const int tile_size = a.get_tile_size();
+    const int tile_rows = a.get_tile_rows();
+    const int tile_cols = a.get_tile_cols();
+    const int steps = (std::min(m,n) + tile_size - 1) / tile_size;
+    const size_t tile_elements = size_t(tile_size)*tile_size;
+
+    task_graph graph;
+    tile_dependencies dependencies(graph, tile_rows*tile_cols + tile_cols);
+
+    // the tiles, then the w of each tile column
+    auto id = [&](int i, int j) { return j*tile_rows + i; };
+    auto w_id = [&](int j) { return tile_rows*tile_cols + j; };
+
+    // the panels are factored one after the other, so they share a buffer
+    std::vector<value_type> panel(size_t(m)*std::min(tile_size, n));
+    value_type* p = panel.data();
+
+    // the unit triangle of each diagonal tile and the triangular factor of each step (the 
+    // strict lower triangle of t is never written and stays zero)
+    std::vector<value_type> v1(steps*tile_elements);
+    std::vector<value_type> t(steps*tile_elements, value_type());
+
+    // v' * c and t' * v' * c of each tile column, reused from step to step
+    std::vector<value_type> vc(tile_cols*tile_elements);
+    std::vector<value_type> w(tile_cols*tile_elements);
+
+    for (int k = 0; k < steps; k++)
+    {
+        const int rows = m - k*tile_size;
+        const int mk = a.get_rows(k);
+        const int nk = a.get_cols(k);
+        const int kb = std::min(rows, nk);
+        const bool trailing = (k+1 < tile_cols);
+
+        value_type* tau_k = tau + k*tile_size;
+        value_type* v1_k = v1.data() + k*tile_elements;
+        value_type* t_k = t.data() + k*tile_elements;
+
+        // GEQRF and LARFT
+        {
+            int task_id = graph.add([=] {
+                copy_panel(a, k, k, p, true);
+
+                int info = 0;
+                lapack::geqrf(rows, nk, p, rows, tau_k, info);
+
+                if (trailing)
+                {
+                    lapack::larft('F', 'C', rows, kb, p, rows, tau_k, t_k, tile_size);
+
+                    for (int c = 0; c < kb; c++)
+                        for (int r = 0; r < mk; r++)
+                            v1_k[size_t(c)*mk+r] = (r > c ? p[size_t(c)*rows+r] : value_type(r == c ? 1 : 0));
+                }
+
+                copy_panel(a, k, k, p, false);
+            });
+
+            for (int i = k; i < tile_rows; i++)
+                dependencies.write(task_id, id(i,k));
+        }
+
+        for (int j = k+1; j < tile_cols; j++)
+        {
+            const int nj = a.get_cols(j);
+            value_type* vc_j = vc.data() + j*tile_elements;
+            value_type* w_j = w.data() + j*tile_elements;
+
+            // w = t' * v' * c
+            {
+                int task_id = graph.add([=] {
+                    lapack::gemm('C', 'N', kb, nj, mk, value_type(1), v1_k, mk, a.get_tile(k,j), mk, value_type(0), vc_j, kb);
+
+                    for (int i = k+1; i < tile_rows; i++)
+                    {
+                        const int mi = a.get_rows(i);
+                        lapack::gemm('C', 'N', kb, nj, mi, value_type(1), a.get_tile(i,k), mi, a.get_tile(i,j), mi, value_type(1), vc_j, kb);
+                    }
+
+                    lapack::gemm('C', 'N', kb, nj, kb, value_type(1), t_k, tile_size, vc_j, kb, value_type(0), w_j, kb);
+                });
+
+                for (int i = k; i < tile_rows; i++)
+                {
+                    dependencies.read(task_id, id(i,k));
+                    dependencies.read(task_id, id(i,j));
+                }
+
+                dependencies.write(task_id, w_id(j));
+            }
+
+            // a(i,j) = a(i,j) - v(i) * w
+            for (int i = k; i < tile_rows; i++)
+            {
+                const int mi = a.get_rows(i);
+                const value_type* v_i = (i == k ? v1_k : a.get_tile(i,k));
+                value_type* aij = a.get_tile(i,j);
+
+                int task_id = graph.add(
+                    [=] { lapack::gemm('N', 'N', mi, nj, kb, value_type(-1), v_i, mi, w_j, kb, value_type(1), aij, mi); },
+                    [=, &ctx] { accelerator_gemm(ctx, 'N', 'N', mi, nj, kb, v_i, mi, w_j, kb, aij, mi); });
+
+                dependencies.read(task_id, id(i,k));
+                dependencies.read(task_id, w_id(j));
+                dependencies.write(task_id, id(i,j));
+            }
+        }
+    }
+
+    graph.run(host_workers);
+}
+
+} // namespace _detail
+
+//
+// Tiled Interface Functions
+//
+// The tiled QR factorization runs its tile tasks as soon as their tiles are ready, on 
+// host_workers threads (one per hardware thread but the calling one if host_workers < 1) 
+// and, for the trailing updates the host workers leave waiting, on the accelerator from the
+// calling thread. The reflectors and r are those of geqrf, left in the tiles of a.
+//
+
+template <typename value_type>
+void geqrf_tiled(context& ctx, const tile_matrix<value_type>& a, value_type* tau, int host_workers = 0)
+{
+    // quick return
+    if (a.get_rows() == 0 || a.get_cols() == 0)
+        return;
+
+    // error checking
+    if (tau == nullptr)
+        argument_error(3);
+
+    if (host_workers < 1)
+        host_workers = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+
+    _detail::geqrf_tiled(ctx, a, tau, host_workers);
+}
+
+template <typename value_type>
+void geqrf(context& ctx, const tile_matrix<value_type>& a, value_type* tau)
+{
+    geqrf_tiled(ctx, a, tau);
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_TILED_GEQRF_H
@@ -0,0 +1,204 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* tiled_getrf.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_TILED_GETRF_H
+#define AMPLAPACK_TILED_GETRF_H
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "amplapack_config.h"
+#include "getrf.h"
+#include "task_graph.h"
+#include "tile_layout.h"
+#include "tiled_potrf.h"
+
+namespace amplapack {
+namespace _detail {
+
+// interchanges rows r1 and r2 of tile column j
+template <typename value_type>
+void swap_tile_rows(const tile_matrix<value_type>& a, int j, int r1, int r2)
+{
+    if (r1 == r2)
+        return;
+
+    const int tile_size = a.get_tile_size();
+    const int rows1 = a.get_rows(r1 / tile_size);
+    const int rows2 = a.get_rows(r2 / tile_size);
+
+    value_type* a1 = a.get_tile(r1 / tile_size, j) + r1 % tile_size;
+    value_type* a2 = a.get_tile(r2 / tile_size, j) + r2 % tile_size;
+
+    for (int c = 0; c < a.get_cols(j); c++)
+        std::swap(a1[size_t(c)*rows1], a2[size_t(c)*rows2]);
+}
+
+// builds the task graph of the right looking tiled LU factorization: for each k the tile 
+// column from the diagonal tile down is factored with partial pivoting (GETRF), its row 
+// interchanges applied to every other tile column (LASWP), the tiles right of the diagonal
+// tile solved (TRSM) and every trailing tile updated (GEMM); the GEMM tasks may also run on
+// the accelerator. The panel is gathered from its tiles into a column major buffer for the 
+// host LAPACK call and scattered back, one contiguous run per tile column; all other tasks 
+// work on the tiles where they are.
+template <typename value_type>
+void getrf_tiled(context& ctx, const tile_matrix<value_type>& a, int* ipiv, int host_workers)
+{
+    const int m = a.get_rows();
+    const int n = a.get_cols();
+    const int tile_size = a.get_tile_size();
+    const int tile_rows = a.get_tile_rows();
+    const int tile_cols = a.get_tile_cols();
+    const int steps = (std::min(m,n) + tile_size - 1) / tile_size;
+
+    task_graph graph;
+    tile_dependencies dependencies(graph, tile_rows*tile_cols);
+
+    auto id = [&](int i, int j) { return j*tile_rows + i; };
+
+    // the panels are factored one after the other, so they share a buffer and the data error
+    std::vector<value_type> panel(size_t(m)*std::min(tile_size, n));
+    value_type* p = panel.data();
+
+    int info = 0;
+    int* first_info = &info;
+
+    for (int k = 0; k < steps; k++)
+    {
+        const int rows = m - k*tile_size;
+        const int mk = a.get_rows(k);
+        const int nk = a.get_cols(k);
+        const int kb = std::min(rows, nk);
+        int* ipiv_k = ipiv + k*tile_size;
+
+        // GETRF
+        {
+            int task_id = graph.add([=] {
+                copy_panel(a, k, k, p, true);
+
+                int panel_info = 0;
+                lapack::getrf(rows, nk, p, rows, ipiv_k, panel_info);
+
+                copy_panel(a, k, k, p, false);
+
+                for (int i = 0; i < kb; i++)
+                    ipiv_k[i] += k*tile_size;
+
+                if (panel_info != 0 && *first_info == 0)
+                    *first_info = k*tile_size + panel_info;
+            });
+
+            for (int i = k; i < tile_rows; i++)
+                dependencies.write(task_id, id(i,k));
+        }
+
+        // LASWP
+        for (int j = 0; j < tile_cols; j++)
+        {
+            if (j == k)
+                continue;
+
+            int task_id = graph.add([=] {
+                for (int i = 0; i < kb; i++)
+                    swap_tile_rows(a, j, k*tile_size + i, ipiv_k[i] - 1);
+            });
+
+            dependencies.read(task_id, id(k,k));
+
+            for (int i = k; i < tile_rows; i++)
+                dependencies.write(task_id, id(i,j));
+        }
+
+        // TRSM and GEMM
+        value_type* akk = a.get_tile(k,k);
+
+        for (int j = k+1; j < tile_cols; j++)
+        {
+            const int nj = a.get_cols(j);
+            value_type* akj = a.get_tile(k,j);
+
+            // a(k,j) = inv(l(k,k)) * a(k,j)
+            int task_id = graph.add([=] { lapack::trsm('L', 'L', 'N', 'U', mk, nj, value_type(1), akk, mk, akj, mk); });
+            dependencies.read(task_id, id(k,k));
+            dependencies.write(task_id, id(k,j));
+
+            // a(i,j) = a(i,j) - a(i,k) * a(k,j)
+            for (int i = k+1; i < tile_rows; i++)
+            {
+                const int mi = a.get_rows(i);
+                value_type* aik = a.get_tile(i,k);
+                value_type* aij = a.get_tile(i,j);
+
+                task_id = graph.add(
+                    [=] { lapack::gemm('N', 'N', mi, nj, kb, value_type(-1), aik, mi, akj, mk, value_type(1), aij, mi); },
+                    [=, &ctx] { accelerator_gemm(ctx, 'N', 'N', mi, nj, kb, aik, mi, akj, mk, aij, mi); });
+
+                dependencies.read(task_id, id(i,k));
+                dependencies.read(task_id, id(k,j));
+                dependencies.write(task_id, id(i,j));
+            }
+        }
+    }
+
+    graph.run(host_workers);
+
+    // as LAPACK, the factorization of a singular matrix is completed before it is reported
+    if (info)
+        data_error(info);
+}
+
+} // namespace _detail
+
+//
+// Tiled Interface Functions
+//
+// The tiled LU factorization runs its tile tasks as soon as their tiles are ready, on 
+// host_workers threads (one per hardware thread but the calling one if host_workers < 1) 
+// and, for the trailing updates the host workers leave waiting, on the accelerator from the
+// calling thread. The factors and pivots are those of getrf, left in the tiles of a.
+//
+
+template <typename value_type>
+void getrf_tiled(context& ctx, const tile_matrix<value_type>& a, int* ipiv, int host_workers = 0)
+{
+    // quick return
+    if (a.get_rows() == 0 || a.get_cols() == 0)
+        return;
+
+    // error checking
+    if (ipiv == nullptr)
+        argument_error(3);
+
+    if (host_workers < 1)
+        host_workers = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+
+    _detail::getrf_tiled(ctx, a, ipiv, host_workers);
+}
+
+template <typename value_type>
+void getrf(context& ctx, const tile_matrix<value_type>& a, int* ipiv)
+{
+    getrf_tiled(ctx, a, ipiv);
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_TILED_GETRF_H
@@ -0,0 +1,367 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* tiled_potrf.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_TILED_POTRF_H
+#define AMPLAPACK_TILED_POTRF_H
+
+#include <thread>
+#include <vector>
+
+#include "amplapack_config.h"
+#include "getrf.h"
+#include "potrf.h"
+#include "task_graph.h"
+#include "tile_layout.h"
+
+namespace amplapack {
+namespace _detail {
+
+//
+// External BLAS Wrappers
+// 
+
+namespace lapack {
+
+// herk for the complex types, syrk for the real ones
+template <typename value_type>
+void herk(char uplo, char trans, int n, int k, typename ampblas::real_type<value_type>::type alpha, const value_type* a, int lda, typename ampblas::real_type<value_type>::type beta, value_type* c, int ldc);
+
+template <>
+inline void herk(char uplo, char trans, int n, int k, float alpha, const float* a, int lda, float beta, float* c, int ldc)
+{
+    trans = (trans == 'C' ? 'T' : trans);
+    LAPACK_SSYRK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+
+template <>
+inline void herk(char uplo, char trans, int n, int k, double alpha, const double* a, int lda, double beta, double* c, int ldc)
+{
+    trans = (trans == 'C' ? 'T' : trans);
+    LAPACK_DSYRK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+
+template <>
+inline void herk(char uplo, char trans, int n, int k, float alpha, const ampblas::complex<float>* a, int lda, float beta, ampblas::complex<float>* c, int ldc)
+{
+    LAPACK_CHERK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+
+template <>
+inline void herk(char uplo, char trans, int n, int k, double alpha, const ampblas::complex<double>* a, int lda, double beta, ampblas::complex<double>* c, int ldc)
+{
+    LAPACK_ZHERK(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+}
+
+template <typename value_type>
+void gemm(char transa, char transb, int m, int n, int k, value_type alpha, const value_type* a, int lda, const value_type* b, int ldb, value_type beta, value_type* c, int ldc);
+
+template <>
+inline void gemm(char transa, char transb, int m, int n, int k, float alpha, const float* a, int lda, const float* b, int ldb, float beta, float* c, int ldc)
+{
+    LAPACK_SGEMM(&transa, &transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+}
+
+template <>
+inline void gemm(char transa, char transb, int m, int n, int k, double alpha, const double* a, int lda, const double* b, int ldb, double beta, double* c, int ldc)
+{
+    LAPACK_DGEMM(&transa, &transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+}
+
+template <>
+inline void gemm(char transa, char transb, int m, int n, int k, ampblas::complex<float> alpha, const ampblas::complex<float>* a, int lda, const ampblas::complex<float>* b, int ldb, ampblas::complex<float> beta, ampblas::complex<float>* c, int ldc)
+{
+    LAPACK_CGEMM(&transa, &transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+}
+
+template <>
+inline void gemm(char transa, char transb, int m, int n, int k, ampblas::complex<double> alpha, const ampblas::complex<double>* a, int lda, const ampblas::complex<double>* b, int ldb, ampblas::complex<double> beta, ampblas::complex<double>* c, int ldc)
+{
+    LAPACK_ZGEMM(&transa, &transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+}
+
+} // namespace lapack
+
+//
+// Tile Tasks
+//
+
+// orders the tasks of a graph by the tiles they touch: a task runs after the last writer of
+// each tile it reads or writes, and a writer also after the readers since the last write
+class tile_dependencies
+{
+public:
+    tile_dependencies(task_graph& graph, int tiles)
+        : graph(graph), writers(tiles, -1), readers(tiles)
+    {}
+
+    void read(int task_id, int tile)
+    {
+        if (writers[tile] >= 0)
+            graph.depend(task_id, writers[tile]);
+
+        readers[tile].push_back(task_id);
+    }
+
+    void write(int task_id, int tile)
+    {
+        if (writers[tile] >= 0)
+            graph.depend(task_id, writers[tile]);
+
+        std::for_each(readers[tile].begin(), readers[tile].end(), [&](int reader) {
+            graph.depend(task_id, reader);
+        });
+
+        readers[tile].clear();
+        writers[tile] = task_id;
+    }
+
+private:
+    // non-copyable
+    tile_dependencies(const tile_dependencies&);
+    tile_dependencies& operator=(const tile_dependencies&);
+
+    task_graph& graph;
+    std::vector<int> writers;
+    std::vector<std::vector<int>> readers;
+};
+
+// c = c - op(a) * op(b) for tiles on the accelerator; only called from the thread that runs 
+// the task graph, which owns ctx
+template <typename value_type>
+void accelerator_gemm(context& ctx, char transa, char transb, int m, int n, int k, const value_type* a, int lda, const value_type* b, int ldb, value_type* c, int ldc)
+{
+    const ordering storage_type = ordering::column_major;
+
+    pooled_array<value_type> accl_a(ctx.get_pool(), make_extent<storage_type>(lda, transa == 'N' ? k : m));
+    pooled_array<value_type> accl_b(ctx.get_pool(), make_extent<storage_type>(ldb, transb == 'N' ? n : k));
+    pooled_array<value_type> accl_c(ctx.get_pool(), make_extent<storage_type>(ldc, n));
+
+    concurrency::array_view<value_type,2> view_a = accl_a.get_view();
+    concurrency::array_view<value_type,2> view_b = accl_b.get_view();
+    concurrency::array_view<value_type,2> view_c = accl_c.get_view();
+
+    concurrency::copy(a, a + view_a.extent.size(), view_a);
+    concurrency::copy(b, b + view_b.extent.size(), view_b);
+    concurrency::copy(c, c + view_c.extent.size(), view_c);
+    ctx.get_transfers().add_to_accelerator(get_bytes<value_type>(view_a.extent) + get_bytes<value_type>(view_b.extent) + get_bytes<value_type>(view_c.extent));
+
+    {
+        concurrency::array_view<const value_type,2> a_sub = view_a;
+        concurrency::array_view<const value_type,2> b_sub = view_b;
+
+        gemm<storage_type>(ctx.get_view(), to_ampblas(to_transpose_option(transa)), to_ampblas(to_transpose_option(transb)), value_type(-1), a_sub, b_sub, value_type(1), view_c);
+    }
+
+    concurrency::copy(view_c, c);
+    ctx.get_transfers().add_to_host(get_bytes<value_type>(view_c.extent));
+}
+
+// builds the task graph of the right looking tiled Cholesky factorization: for each k the
+// diagonal tile is factored (POTRF), the tiles of its column (row for upper) solved (TRSM)
+// and every trailing tile updated (HERK on the diagonal, GEMM elsewhere); the GEMM tasks may
+// also run on the accelerator
+template <typename value_type>
+void potrf_tiled(context& ctx, enum class uplo uplo, const tile_matrix<value_type>& a, int host_workers)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    const int tiles = a.get_tile_rows();
+    const int tile_size = a.get_tile_size();
+    const bool lower = (uplo == uplo::lower);
+
+    task_graph graph;
+    tile_dependencies dependencies(graph, tiles*tiles);
+
+    // tile (i,j) of a and its leading dimension (rows)
+    auto tile = [&](int i, int j) { return a.get_tile(i, j); };
+    auto ld = [&](int i) { return a.get_rows(i); };
+    auto id = [&](int i, int j) { return j*tiles + i; };
+
+    for (int k = 0; k < tiles; k++)
+    {
+        const int nk = ld(k);
+        value_type* akk = tile(k,k);
+
+        // POTRF
+        {
+            const char lapack_uplo = to_char(uplo);
+
+            int task_id = graph.add([=] {
+                int info = 0;
+                lapack::potrf(lapack_uplo, nk, akk, nk, info);
+
+                if (info != 0)
+                    data_error(k*tile_size + info);
+            });
+
+            dependencies.write(task_id, id(k,k));
+        }
+
+        // TRSM
+        for (int i = k+1; i < tiles; i++)
+        {
+            const int ni = ld(i);
+            int task_id;
+
+            if (lower)
+            {
+                // a(i,k) = a(i,k) * inv(l(k,k))'
+                value_type* aik = tile(i,k);
+                task_id = graph.add([=] { lapack::trsm('R', 'L', 'C', 'N', ni, nk, value_type(1), akk, nk, aik, ni); });
+                dependencies.write(task_id, id(i,k));
+            }
+            else
+            {
+                // a(k,i) = inv(u(k,k))' * a(k,i)
+                value_type* aki = tile(k,i);
+                task_id = graph.add([=] { lapack::trsm('L', 'U', 'C', 'N', nk, ni, value_type(1), akk, nk, aki, nk); });
+                dependencies.write(task_id, id(k,i));
+            }
+
+            dependencies.read(task_id, id(k,k));
+        }
+
+        // HERK and GEMM
+        for (int i = k+1; i < tiles; i++)
+        {
+            const int ni = ld(i);
+            value_type* aii = tile(i,i);
+
+            if (lower)
+            {
+                // a(i,i) = a(i,i) - a(i,k) * a(i,k)'
+                value_type* aik = tile(i,k);
+                int task_id = graph.add([=] { lapack::herk('L', 'N', ni, nk, real_type(-1), aik, ni, real_type(1), aii, ni); });
+                dependencies.read(task_id, id(i,k));
+                dependencies.write(task_id, id(i,i));
+
+                // a(i,j) = a(i,j) - a(i,k) * a(j,k)'
+                for (int j = k+1; j < i; j++)
+                {
+                    const int nj = ld(j);
+                    value_type* ajk = tile(j,k);
+                    value_type* aij = tile(i,j);
+
+                    task_id = graph.add(
+                        [=] { lapack::gemm('N', 'C', ni, nj, nk, value_type(-1), aik, ni, ajk, nj, value_type(1), aij, ni); },
+                        [=, &ctx] { accelerator_gemm(ctx, 'N', 'C', ni, nj, nk, aik, ni, ajk, nj, aij, ni); });
+
+                    dependencies.read(task_id, id(i,k));
+                    dependencies.read(task_id, id(j,k));
+                    dependencies.write(task_id, id(i,j));
+                }
+            }
+            else
+            {
+                // a(i,i) = a(i,i) - a(k,i)' * a(k,i)
+                value_type* aki = tile(k,i);
+                int task_id = graph.add([=] { lapack::herk('U', 'C', ni, nk, real_type(-1), aki, nk, real_type(1), aii, ni); });
+                dependencies.read(task_id, id(k,i));
+                dependencies.write(task_id, id(i,i));
+
+                // a(j,i) = a(j,i) - a(k,j)' * a(k,i)
+                for (int j = k+1; j < i; j++)
+                {
+                    const int nj = ld(j);
+                    value_type* akj = tile(k,j);
+                    value_type* aji = tile(j,i);
+
+                    task_id = graph.add(
+                        [=] { lapack::gemm('C', 'N', nj, ni, nk, value_type(-1), akj, nk, aki, nk, value_type(1), aji, nj); },
+                        [=, &ctx] { accelerator_gemm(ctx, 'C', 'N', nj, ni, nk, akj, nk, aki, nk, aji, nj); });
+
+                    dependencies.read(task_id, id(k,j));
+                    dependencies.read(task_id, id(k,i));
+                    dependencies.write(task_id, id(j,i));
+                }
+            }
+        }
+    }
+
+    graph.run(host_workers);
+}
+
+} // namespace _detail
+
+//
+// Tiled Interface Functions
+//
+// The tiled Cholesky factorization runs its tile tasks as soon as their tiles are ready, on
+// host_workers threads (one per hardware thread but the calling one if host_workers < 1) 
+// and, for the trailing updates the host workers leave waiting, on the accelerator from the 
+// calling thread.
+//
+
+template <typename value_type>
+void potrf_tiled(context& ctx, char uplo, const tile_matrix<value_type>& a, int host_workers = 0)
+{
+    const int n = a.get_rows();
+
+    // quick return
+    if (n == 0)
+        return;
+
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        argument_error(2);
+    if (a.get_cols() != n)
+        argument_error(3);
+
+    if (host_workers < 1)
+        host_workers = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+
+    _detail::potrf_tiled(ctx, to_option(uplo), a, host_workers);
+}
+
+template <typename value_type>
+void potrf(context& ctx, char uplo, const tile_matrix<value_type>& a)
+{
+    potrf_tiled(ctx, uplo, a);
+}
+
+// copies a into tiles of the potrf block size and back
+template <typename value_type>
+void potrf_tiled(context& ctx, char uplo, int n, value_type* a, int lda, int host_workers = 0)
+{
+    // quick return
+    if (n == 0)
+        return;
+
+    // error checking
+    if (n < 0)
+        argument_error(3);
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < n)
+        argument_error(5);
+
+    std::vector<value_type> tiles(size_t(n)*n);
+    tile_matrix<value_type> a_tiles(n, n, _detail::potrf_block_size, tiles.data());
+
+    to_tile_major(ordering::column_major, a, lda, a_tiles);
+    potrf_tiled(ctx, uplo, a_tiles, host_workers);
+    from_tile_major(a_tiles, ordering::column_major, a, lda);
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_TILED_POTRF_H
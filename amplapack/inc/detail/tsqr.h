@@ -0,0 +1,422 @@
+/*----------------------------------------------------------------------------
+* Copyright  Microsoft Corp.
+*
+* Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+* use this file except in compliance with the License.  You may obtain a copy 
+* of the License at http://www.apache.org/licenses/LICENSE-2.0  
+* 
+* THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+* KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+* WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+* MERCHANTABLITY OR NON-INFRINGEMENT. 
+*
+* See the Apache Version 2.0 License for specific language governing 
+* permissions and limitations under the License.
+*---------------------------------------------------------------------------
+* 
+* tsqr.h
+*
+*---------------------------------------------------------------------------*/
+
+#ifndef AMPLAPACK_TSQR_H
+#define AMPLAPACK_TSQR_H
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "amplapack_config.h"
+#include "geqrf.h"
+#include "task_graph.h"
+
+namespace amplapack {
+namespace _detail {
+
+// rows of the row blocks factored independently at the bottom of the tree
+const int tsqr_block_rows = 4096;
+
+// one factorization of the reduction tree. A leaf is a row block of a whose reflectors stay
+// below its diagonal in a; an inner node factors the R factors of its children stacked on
+// top of each other and keeps its reflectors (and R) in v. The top n rows of every node map
+// to the rows of a starting at first, the top of the first leaf below it.
+template <typename value_type>
+struct tsqr_node
+{
+    int first;
+    int rows;
+    int child;
+    int children;
+    std::vector<value_type> v;
+    std::vector<value_type> tau;
+};
+
+template <typename value_type>
+struct tsqr_tree
+{
+    int m;
+    int n;
+    std::vector<std::vector<tsqr_node<value_type>>> levels;
+};
+
+} // namespace _detail
+
+//
+// TSQR Factors
+//
+// The implicit Q of a tall skinny QR factorization: the reflectors of each row block (kept
+// below the diagonal of a, as geqrf leaves them) and those of the reduction tree that
+// combines their R factors. Only ormqr_tsqr and orgqr_tsqr can apply it.
+//
+
+template <typename value_type>
+class tsqr_factors
+{
+public:
+    tsqr_factors()
+    {
+        tree.m = 0;
+        tree.n = 0;
+    }
+
+    int get_rows() const { return tree.m; }
+    int get_cols() const { return tree.n; }
+
+    // the number of row blocks factored independently and the depth of the reduction tree
+    int get_blocks() const { return tree.levels.empty() ? 0 : static_cast<int>(tree.levels.front().size()); }
+    int get_levels() const { return static_cast<int>(tree.levels.size()); }
+
+    // the tree itself, for the tsqr routines
+    _detail::tsqr_tree<value_type>& get_tree() { return tree; }
+    const _detail::tsqr_tree<value_type>& get_tree() const { return tree; }
+
+private:
+    _detail::tsqr_tree<value_type> tree;
+};
+
+namespace _detail {
+
+// copies an m by n column major matrix
+template <typename value_type>
+void copy_rows(int m, int n, const value_type* a, int lda, value_type* b, int ldb)
+{
+    for (int j = 0; j < n; j++)
+        std::copy(a + j*lda, a + j*lda + m, b + j*ldb);
+}
+
+// copies the upper triangle of an n by n matrix and zeros the rest
+template <typename value_type>
+void copy_upper(int n, const value_type* a, int lda, value_type* b, int ldb)
+{
+    for (int j = 0; j < n; j++)
+    {
+        std::copy(a + j*lda, a + j*lda + j+1, b + j*ldb);
+        std::fill(b + j*ldb + j+1, b + j*ldb + n, value_type());
+    }
+}
+
+// lays out the leaves (whole blocks of block_rows, the last one taking the remainder) and
+// the levels above them, each node stacking the n by n R factors of up to block_rows/n
+// children so that no node has more rows than a leaf
+template <typename value_type>
+void tsqr_build(tsqr_tree<value_type>& tree, int m, int n)
+{
+    const int block_rows = std::max(tsqr_block_rows, 2*n);
+    const int blocks = std::max(1, m / block_rows);
+    const int arity = std::max(2, block_rows / n);
+
+    tree.m = m;
+    tree.n = n;
+    tree.levels.assign(1, std::vector<tsqr_node<value_type>>(blocks));
+
+    for (int b = 0; b < blocks; b++)
+    {
+        tsqr_node<value_type>& leaf = tree.levels[0][b];
+        leaf.first = b*block_rows;
+        leaf.rows = (b == blocks-1 ? m - leaf.first : block_rows);
+        leaf.child = -1;
+        leaf.children = 0;
+        leaf.tau.resize(std::min(leaf.rows, n));
+    }
+
+    while (tree.levels.back().size() > 1)
+    {
+        const int below = static_cast<int>(tree.levels.back().size());
+        std::vector<tsqr_node<value_type>> level((below + arity - 1) / arity);
+
+        for (size_t p = 0; p < level.size(); p++)
+        {
+            tsqr_node<value_type>& node = level[p];
+            node.child = static_cast<int>(p)*arity;
+            node.children = std::min(arity, below - node.child);
+            node.first = tree.levels.back()[node.child].first;
+            node.rows = node.children*n;
+            node.v.resize(size_t(node.rows)*n);
+            node.tau.resize(n);
+        }
+
+        tree.levels.push_back(std::move(level));
+    }
+}
+
+// the leaves are factored in parallel, on host workers or on the accelerator, and every node
+// as soon as its children are; R ends up in the upper triangle of the top rows of a
+template <typename value_type>
+void geqrf_tsqr(context& ctx, value_type* a, int lda, tsqr_tree<value_type>& tree, int host_workers)
+{
+    const int n = tree.n;
+
+    task_graph graph;
+    std::vector<std::vector<int>> task_ids(tree.levels.size());
+
+    // leaves
+    for (size_t b = 0; b < tree.levels[0].size(); b++)
+    {
+        tsqr_node<value_type>* leaf = &tree.levels[0][b];
+        value_type* a_block = a + leaf->first;
+
+        task_ids[0].push_back(graph.add(
+            [=] {
+                int info;
+                lapack::geqrf(leaf->rows, n, a_block, lda, leaf->tau.data(), info);
+                info_check(info);
+            },
+            [=, &ctx] { amplapack::geqrf<execution_target::accelerator>(ctx, leaf->rows, n, a_block, lda, leaf->tau.data()); }));
+    }
+
+    // the reduction tree
+    for (size_t l = 1; l < tree.levels.size(); l++)
+    {
+        for (size_t p = 0; p < tree.levels[l].size(); p++)
+        {
+            tsqr_node<value_type>* node = &tree.levels[l][p];
+            const std::vector<tsqr_node<value_type>>* children = &tree.levels[l-1];
+            const bool above_leaves = (l == 1);
+
+            int task_id = graph.add([=] {
+                // stack the R factors of the children
+                for (int c = 0; c < node->children; c++)
+                {
+                    const tsqr_node<value_type>& child = (*children)[node->child + c];
+
+                    if (above_leaves)
+                        copy_upper(n, a + child.first, lda, node->v.data() + c*n, node->rows);
+                    else
+                        copy_upper(n, child.v.data(), child.rows, node->v.data() + c*n, node->rows);
+                }
+
+                int info;
+                lapack::geqrf(node->rows, n, node->v.data(), node->rows, node->tau.data(), info);
+                info_check(info);
+            });
+
+            for (int c = 0; c < node->children; c++)
+                graph.depend(task_id, task_ids[l-1][node->child + c]);
+
+            task_ids[l].push_back(task_id);
+        }
+    }
+
+    graph.run(host_workers);
+
+    // the R of the root replaces that of the first leaf, whose reflectors stay below it
+    if (tree.levels.size() > 1)
+    {
+        const tsqr_node<value_type>& root = tree.levels.back().front();
+
+        for (int j = 0; j < n; j++)
+            std::copy(root.v.data() + j*root.rows, root.v.data() + j*root.rows + j+1, a + j*lda);
+    }
+}
+
+// op(Q) * c from the left. Q' goes up the tree: the leaves apply their reflectors to their
+// row blocks of c, then every node gathers the top n rows of its children's blocks, applies
+// its own reflectors and scatters them back. Q goes down the tree in the opposite order.
+template <typename value_type>
+void ormqr_tsqr(context& ctx, char trans, int nrhs, const value_type* a, int lda, const tsqr_tree<value_type>& tree, value_type* c, int ldc, int host_workers)
+{
+    const bool complex_type = (precision_of<value_type>() == 'C' || precision_of<value_type>() == 'Z');
+
+    // the real routines only take 'T' and the complex ones only 'C'
+    const char trans_host = (trans == 'N' ? 'N' : (complex_type ? 'C' : 'T'));
+    const bool up = (trans != 'N');
+    const int n = tree.n;
+
+    task_graph graph;
+    std::vector<std::vector<int>> task_ids(tree.levels.size());
+
+    // leaves
+    for (size_t b = 0; b < tree.levels[0].size(); b++)
+    {
+        const tsqr_node<value_type>* leaf = &tree.levels[0][b];
+        const value_type* a_block = a + leaf->first;
+        value_type* c_block = c + leaf->first;
+        const int k = static_cast<int>(leaf->tau.size());
+
+        task_ids[0].push_back(graph.add(
+            [=] {
+                int info;
+                lapack::ormqr('L', trans_host, leaf->rows, nrhs, k, a_block, lda, leaf->tau.data(), c_block, ldc, info);
+                info_check(info);
+            },
+            [=, &ctx] { amplapack::ormqr<execution_target::accelerator>(ctx, 'L', trans_host, leaf->rows, nrhs, k, a_block, lda, leaf->tau.data(), c_block, ldc); }));
+    }
+
+    // the reduction tree
+    for (size_t l = 1; l < tree.levels.size(); l++)
+    {
+        for (size_t p = 0; p < tree.levels[l].size(); p++)
+        {
+            const tsqr_node<value_type>* node = &tree.levels[l][p];
+            const std::vector<tsqr_node<value_type>>* children = &tree.levels[l-1];
+
+            task_ids[l].push_back(graph.add([=] {
+                std::vector<value_type> w(size_t(node->rows)*nrhs);
+
+                for (int i = 0; i < node->children; i++)
+                    copy_rows(n, nrhs, c + (*children)[node->child + i].first, ldc, w.data() + i*n, node->rows);
+
+                int info;
+                lapack::ormqr('L', trans_host, node->rows, nrhs, n, node->v.data(), node->rows, node->tau.data(), w.data(), node->rows, info);
+                info_check(info);
+
+                for (int i = 0; i < node->children; i++)
+                    copy_rows(n, nrhs, w.data() + i*n, node->rows, c + (*children)[node->child + i].first, ldc);
+            }));
+        }
+    }
+
+    // a node runs after its children going up and before them going down
+    for (size_t l = 1; l < tree.levels.size(); l++)
+    {
+        for (size_t p = 0; p < tree.levels[l].size(); p++)
+        {
+            const tsqr_node<value_type>& node = tree.levels[l][p];
+
+            for (int i = 0; i < node.children; i++)
+            {
+                const int parent_id = task_ids[l][p];
+                const int child_id = task_ids[l-1][node.child + i];
+
+                if (up)
+                    graph.depend(parent_id, child_id);
+                else
+                    graph.depend(child_id, parent_id);
+            }
+        }
+    }
+
+    graph.run(host_workers);
+}
+
+} // namespace _detail
+
+//
+// TSQR Interface Functions
+//
+// For tall skinny matrices, geqrf_tsqr splits a into row blocks that are factored at once on
+// host_workers threads (one per hardware thread but the calling one if host_workers < 1)
+// and on the accelerator from the calling thread, then combines their R factors in a
+// reduction tree. Only R (in the upper triangle of a) matches geqrf, up to the signs of its
+// rows; Q is left in a and q, for ormqr_tsqr and orgqr_tsqr.
+//
+
+template <typename value_type>
+void geqrf_tsqr(context& ctx, int m, int n, value_type* a, int lda, tsqr_factors<value_type>& q, int host_workers = 0)
+{
+    // error checking
+    if (m < 0)
+        argument_error(2);
+    if (n < 0)
+        argument_error(3);
+
+    // quick return
+    if (n == 0 || m == 0)
+    {
+        q = tsqr_factors<value_type>();
+        return;
+    }
+
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < m)
+        argument_error(5);
+
+    if (host_workers < 1)
+        host_workers = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+
+    _detail::tsqr_build(q.get_tree(), m, n);
+    _detail::geqrf_tsqr(ctx, a, lda, q.get_tree(), host_workers);
+}
+
+// op(Q) * c from the left for the m by nrhs matrix c, with a and q from geqrf_tsqr; any trans
+// other than 'N' applies Q'
+template <typename value_type>
+void ormqr_tsqr(context& ctx, char trans, int nrhs, const value_type* a, int lda, const tsqr_factors<value_type>& q, value_type* c, int ldc, int host_workers = 0)
+{
+    const bool complex_type = (precision_of<value_type>() == 'C' || precision_of<value_type>() == 'Z');
+    const int m = q.get_rows();
+
+    // error checking
+    trans = static_cast<char>(toupper(trans));
+
+    if (trans != 'N' && trans != 'C' && (trans != 'T' || complex_type))
+        argument_error(2);
+    if (nrhs < 0)
+        argument_error(3);
+
+    // quick return
+    if (m == 0 || nrhs == 0 || q.get_cols() == 0)
+        return;
+
+    if (a == nullptr)
+        argument_error(4);
+    if (lda < m)
+        argument_error(5);
+    if (c == nullptr)
+        argument_error(7);
+    if (ldc < m)
+        argument_error(8);
+
+    if (host_workers < 1)
+        host_workers = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+
+    _detail::ormqr_tsqr(ctx, trans, nrhs, a, lda, q.get_tree(), c, ldc, host_workers);
+}
+
+// the first n columns of Q, in the m by n matrix b, with a and q from geqrf_tsqr
+template <typename value_type>
+void orgqr_tsqr(context& ctx, const value_type* a, int lda, const tsqr_factors<value_type>& q, value_type* b, int ldb, int host_workers = 0)
+{
+    const int m = q.get_rows();
+    const int n = q.get_cols();
+
+    // quick return
+    if (m == 0 || n == 0)
+        return;
+
+    // error checking
+    if (a == nullptr)
+        argument_error(2);
+    if (lda < m)
+        argument_error(3);
+    if (b == nullptr)
+        argument_error(5);
+    if (ldb < m)
+        argument_error(6);
+
+    // Q * [I; 0]
+    for (int j = 0; j < n; j++)
+    {
+        std::fill(b + j*ldb, b + j*ldb + m, value_type());
+
+        if (j < m)
+            b[j*ldb + j] = value_type(1);
+    }
+
+    ormqr_tsqr(ctx, 'N', n, a, lda, q, b, ldb, host_workers);
+}
+
+} // namespace amplapack
+
+#endif // AMPLAPACK_TSQR_H
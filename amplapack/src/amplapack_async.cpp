@@ -0,0 +1,53 @@
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * amplapack_async.cpp
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <functional>
+
+#include <amp.h>
+
+#include "ampclapack.h"      
+#include "amplapack_runtime.h"
+
+extern "C" {
+
+amplapack_status amplapack_async_test(amplapack_async token, int* done)
+{
+    if (token == nullptr || done == nullptr)
+        return amplapack_argument_error;
+
+    *done = token->call.is_done() ? 1 : 0;
+    return amplapack_success;
+}
+
+amplapack_status amplapack_async_wait(amplapack_async token, int* info)
+{
+    if (token == nullptr || info == nullptr)
+        return amplapack_argument_error;
+
+    // reports the data error of the routine, or any runtime error of its queued work
+    std::function<void()> f = std::bind(&amplapack::async_call::wait, &token->call);
+    amplapack_status status = amplapack::safe_call_interface(f, *info);
+
+    // the call is complete (or failed); release its memory and context
+    delete token;
+    return status;
+}
+
+} // extern "C"
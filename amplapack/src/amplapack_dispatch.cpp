@@ -0,0 +1,127 @@
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * amplapack_dispatch.cpp
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <climits>
+#include <cctype>
+#include <mutex>
+
+#include "ampclapack.h"
+#include "amplapack_runtime.h"
+
+namespace amplapack {
+namespace {
+
+// crossover points of one routine and precision
+struct crossover
+{
+    int host;
+    int accelerator;
+};
+
+// Problems below one panel gain nothing from the hybrid algorithm and problems of a few 
+// panels are dominated by its transfers and launches, so the host crossovers sit a small 
+// multiple of the block size above it, earlier for the complex types that do more work per
+// byte moved. The accelerator only algorithm is never chosen by default.
+// These are starting points; the dispatch test prints the timings of each target to 
+// calibrate them for a given system.
+crossover crossovers[3][4] =
+{
+    //  S                D                C                Z
+    { {512, INT_MAX}, {384, INT_MAX}, {256, INT_MAX}, {192, INT_MAX} }, // getrf
+    { {384, INT_MAX}, {256, INT_MAX}, {192, INT_MAX}, {128, INT_MAX} }, // geqrf
+    { {768, INT_MAX}, {512, INT_MAX}, {384, INT_MAX}, {256, INT_MAX} }  // potrf
+};
+
+// guards the crossovers against concurrent updates
+std::mutex crossover_mutex;
+
+// table position of a routine and precision; false if either is invalid
+bool find_crossover(amplapack_routine routine, char precision, int& row, int& col)
+{
+    switch (routine)
+    {
+    case amplapack_getrf_routine: row = 0; break;
+    case amplapack_geqrf_routine: row = 1; break;
+    case amplapack_potrf_routine: row = 2; break;
+    default: return false;
+    }
+
+    switch (toupper(precision))
+    {
+    case 'S': col = 0; break;
+    case 'D': col = 1; break;
+    case 'C': col = 2; break;
+    case 'Z': col = 3; break;
+    default: return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+execution_target select_target(amplapack_routine routine, char precision, int size)
+{
+    int row, col;
+    if (!find_crossover(routine, precision, row, col))
+        return execution_target::hybrid;
+
+    std::lock_guard<std::mutex> lock(crossover_mutex);
+    const crossover& c = crossovers[row][col];
+
+    if (size < c.host)
+        return execution_target::host;
+    else if (size >= c.accelerator)
+        return execution_target::accelerator;
+    else
+        return execution_target::hybrid;
+}
+
+} // namespace amplapack
+
+extern "C" {
+
+amplapack_status amplapack_set_crossover(amplapack_routine routine, char precision, int host_crossover, int accelerator_crossover)
+{
+    int row, col;
+    if (!amplapack::find_crossover(routine, precision, row, col) || host_crossover < 0 || accelerator_crossover < 0)
+        return amplapack_argument_error;
+
+    std::lock_guard<std::mutex> lock(amplapack::crossover_mutex);
+    amplapack::crossovers[row][col].host = host_crossover;
+    amplapack::crossovers[row][col].accelerator = accelerator_crossover;
+
+    return amplapack_success;
+}
+
+amplapack_status amplapack_get_crossover(amplapack_routine routine, char precision, int* host_crossover, int* accelerator_crossover)
+{
+    int row, col;
+    if (!amplapack::find_crossover(routine, precision, row, col) || host_crossover == nullptr || accelerator_crossover == nullptr)
+        return amplapack_argument_error;
+
+    std::lock_guard<std::mutex> lock(amplapack::crossover_mutex);
+    *host_crossover = amplapack::crossovers[row][col].host;
+    *accelerator_crossover = amplapack::crossovers[row][col].accelerator;
+
+    return amplapack_success;
+}
+
+} // extern "C"
@@ -0,0 +1,173 @@
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * amplapack_handle.cpp
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <amp.h>
+
+#include "ampclapack.h"      
+#include "amplapack_runtime.h"
+
+#include "detail\getrf.h"    
+#include "detail\geqrf.h"    
+#include "detail\potrf.h"    
+
+namespace _detail {
+
+// resets a to the n by n identity
+template <typename value_type>
+void make_identity(int n, std::vector<value_type>& a)
+{
+    std::fill(a.begin(), a.end(), value_type());
+    for (int i = 0; i < n; i++)
+        a[i*n+i] = value_type(1);
+}
+
+// runs every routine once so the kernels used by the blocked algorithms are
+// created on the handle's view before the first real call
+template <typename value_type>
+void warm_up(amplapack::context& ctx)
+{
+    // spans two panels of the default block size so that every update kernel is launched
+    const int n = 257;
+
+    std::vector<value_type> a(n*n);
+    std::vector<value_type> tau(n);
+    std::vector<int> ipiv(n);
+
+    make_identity(n, a);
+    amplapack::getrf(ctx, n, n, a.data(), n, ipiv.data());
+
+    make_identity(n, a);
+    amplapack::potrf(ctx, 'L', n, a.data(), n);
+
+    make_identity(n, a);
+    amplapack::potrf(ctx, 'U', n, a.data(), n);
+
+    make_identity(n, a);
+    amplapack::geqrf(ctx, n, n, a.data(), n, tau.data());
+}
+
+void create_handle(concurrency::accelerator_view& av, amplapack_handle* handle)
+{
+    // the handle owns its own queue on the default accelerator
+    std::unique_ptr<amplapack_handle_t> new_handle(new amplapack_handle_t(av.get_accelerator().create_view()));
+
+    warm_up<float>(new_handle->ctx);
+    warm_up<ampblas::complex<float>>(new_handle->ctx);
+
+    if (av.get_accelerator().get_supports_double_precision())
+    {
+        warm_up<double>(new_handle->ctx);
+        warm_up<ampblas::complex<double>>(new_handle->ctx);
+    }
+
+    *handle = new_handle.release();
+}
+
+void reserve_workspace(amplapack::context& ctx, size_t size)
+{
+    ctx.get_pool().reserve(size);
+}
+
+void trim_workspace(amplapack::context& ctx)
+{
+    ctx.get_pool().trim();
+    ctx.get_staging_pool().trim();
+}
+
+} // namespace _detail
+
+extern "C" {
+
+amplapack_status amplapack_create_handle(amplapack_handle* handle)
+{
+    if (handle == nullptr)
+        return amplapack_argument_error;
+
+    *handle = nullptr;
+
+    // create interface functor
+    std::function<void(concurrency::accelerator_view&)> f = std::bind(_detail::create_handle, std::placeholders::_1, handle);
+
+    // execute using interface
+    int info = 0;
+    return amplapack::safe_call_interface(f, info);
+}
+
+amplapack_status amplapack_destroy_handle(amplapack_handle handle)
+{
+    // destroying a null handle is a no-op
+    delete handle;
+    return amplapack_success;
+}
+
+amplapack_status amplapack_reserve_workspace(amplapack_handle handle, size_t size)
+{
+    std::function<void(amplapack::context&)> f = std::bind(_detail::reserve_workspace, std::placeholders::_1, size);
+
+    int info = 0;
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+amplapack_status amplapack_trim_workspace(amplapack_handle handle)
+{
+    std::function<void(amplapack::context&)> f = std::bind(_detail::trim_workspace, std::placeholders::_1);
+
+    int info = 0;
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+amplapack_status amplapack_get_transfer_bytes(amplapack_handle handle, size_t* to_host, size_t* to_accelerator)
+{
+    if (handle == nullptr || to_host == nullptr || to_accelerator == nullptr)
+        return amplapack_argument_error;
+
+    const amplapack::transfer_counter& transfers = handle->ctx.get_transfers();
+    *to_host = transfers.get_bytes_to_host();
+    *to_accelerator = transfers.get_bytes_to_accelerator();
+
+    return amplapack_success;
+}
+
+amplapack_status amplapack_set_panel_pivoting(amplapack_handle handle, amplapack_pivoting pivoting)
+{
+    if (handle == nullptr)
+        return amplapack_argument_error;
+
+    switch (pivoting)
+    {
+    case amplapack_partial_pivoting:
+        handle->ctx.set_panel_pivoting(amplapack::panel_pivoting::partial);
+        break;
+    case amplapack_tournament_pivoting:
+        handle->ctx.set_panel_pivoting(amplapack::panel_pivoting::tournament);
+        break;
+    default:
+        return amplapack_argument_error;
+    }
+
+    return amplapack_success;
+}
+
+} // extern "C"
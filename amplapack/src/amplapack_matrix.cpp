@@ -0,0 +1,228 @@
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * amplapack_matrix.cpp
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <functional>
+#include <memory>
+
+#include <amp.h>
+
+#include "ampclapack.h"      
+#include "amplapack_runtime.h"
+
+#include "detail\geqrf.h"    
+
+namespace _detail {
+
+// this is a work around until VS std::bind can accept more paramaters
+template <typename value_type>
+struct matrix_params
+{
+    int m;
+    int n;
+    const value_type* a;
+    int lda;
+
+    matrix_params(int m, int n, const value_type* a, int lda)
+        : m(m), n(n), a(a), lda(lda)
+    {}
+};
+
+// copies the host matrix a into the device matrix view
+template <typename value_type>
+void upload_matrix(amplapack::context& ctx, const concurrency::array_view<value_type,2>& view, const value_type* a, int lda)
+{
+    const int m = view.extent[1];
+    const int n = view.extent[0];
+
+    concurrency::array_view<const value_type,2> host_view_a = concurrency::array_view<const value_type,2>(n, lda, a).section(concurrency::index<2>(0,0), concurrency::extent<2>(n,m));
+    concurrency::copy(host_view_a, view);
+    ctx.get_transfers().add_to_accelerator(amplapack::get_bytes<value_type>(view.extent));
+}
+
+template <typename value_type>
+void create_matrix(amplapack::context& ctx, amplapack_handle handle, const matrix_params<value_type>& p, amplapack_matrix* matrix)
+{
+    using amplapack::argument_error;
+
+    // error checking
+    if (p.m < 1)
+        argument_error(2);
+    if (p.n < 1)
+        argument_error(3);
+    if (p.a != nullptr && p.lda < p.m)
+        argument_error(5);
+    if (matrix == nullptr)
+        argument_error(6);
+
+    *matrix = nullptr;
+
+    std::shared_ptr<concurrency::array<value_type,2>> data(new concurrency::array<value_type,2>(p.n, p.m, ctx.get_view()));
+
+    if (p.a != nullptr)
+    {
+        upload_matrix<value_type>(ctx, *data, p.a, p.lda);
+    }
+    else
+    {
+        // arrays start out undefined
+        amplapack::_detail::fill(ctx.get_view(), concurrency::array_view<value_type,2>(*data), value_type());
+    }
+
+    *matrix = new amplapack_matrix_t(handle, amplapack::precision_of<value_type>(), p.m, p.n, data);
+}
+
+template <typename value_type>
+void set_matrix(amplapack::context& ctx, amplapack_matrix matrix, const value_type* a, int lda)
+{
+    concurrency::array_view<value_type,2> view = amplapack::get_matrix_view<value_type>(ctx, matrix, 1);
+
+    // error checking
+    if (a == nullptr)
+        amplapack::argument_error(2);
+    if (lda < matrix->m)
+        amplapack::argument_error(3);
+
+    upload_matrix(ctx, view, a, lda);
+}
+
+template <typename value_type>
+void get_matrix(amplapack::context& ctx, amplapack_matrix matrix, value_type* a, int lda)
+{
+    concurrency::array_view<value_type,2> view = amplapack::get_matrix_view<value_type>(ctx, matrix, 1);
+
+    // error checking
+    if (a == nullptr)
+        amplapack::argument_error(2);
+    if (lda < matrix->m)
+        amplapack::argument_error(3);
+
+    concurrency::array_view<value_type,2> host_view_a = concurrency::array_view<value_type,2>(matrix->n, lda, a).section(concurrency::index<2>(0,0), view.extent);
+    concurrency::copy(view, host_view_a);
+    ctx.get_transfers().add_to_host(amplapack::get_bytes<value_type>(view.extent));
+}
+
+template <typename value_type>
+amplapack_status do_create_matrix(amplapack_handle handle, int m, int n, const value_type* a, int lda, amplapack_matrix* matrix, int& info)
+{
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    matrix_params<value_type> params(m, n, a, lda);
+    std::function<void(amplapack::context&)> f = std::bind(create_matrix<value_type>, std::placeholders::_1, handle, params, matrix);
+
+    // the matrix lives on the handle's view
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+amplapack_status do_set_matrix(amplapack_matrix matrix, const value_type* a, int lda, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(set_matrix<value_type>, std::placeholders::_1, matrix, a, lda);
+    return amplapack::safe_call_interface(f, matrix, 1, info);
+}
+
+template <typename value_type>
+amplapack_status do_get_matrix(amplapack_matrix matrix, value_type* a, int lda, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(get_matrix<value_type>, std::placeholders::_1, matrix, a, lda);
+    return amplapack::safe_call_interface(f, matrix, 1, info);
+}
+
+} // namespace _detail
+
+extern "C" {
+
+amplapack_status amplapack_screate_matrix(amplapack_handle handle, int m, int n, const float* a, int lda, amplapack_matrix* matrix, int* info)
+{
+    return _detail::do_create_matrix(handle, m, n, a, lda, matrix, *info);
+}
+
+amplapack_status amplapack_dcreate_matrix(amplapack_handle handle, int m, int n, const double* a, int lda, amplapack_matrix* matrix, int* info)
+{
+    return _detail::do_create_matrix(handle, m, n, a, lda, matrix, *info);
+}
+
+amplapack_status amplapack_ccreate_matrix(amplapack_handle handle, int m, int n, const amplapack_fcomplex* a, int lda, amplapack_matrix* matrix, int* info)
+{
+    return _detail::do_create_matrix(handle, m, n, amplapack::amplapack_cast(a), lda, matrix, *info);
+}
+
+amplapack_status amplapack_zcreate_matrix(amplapack_handle handle, int m, int n, const amplapack_dcomplex* a, int lda, amplapack_matrix* matrix, int* info)
+{
+    return _detail::do_create_matrix(handle, m, n, amplapack::amplapack_cast(a), lda, matrix, *info);
+}
+
+amplapack_status amplapack_destroy_matrix(amplapack_matrix matrix)
+{
+    // destroying a null matrix is a no-op
+    delete matrix;
+    return amplapack_success;
+}
+
+amplapack_status amplapack_get_matrix_size(amplapack_matrix matrix, int* m, int* n)
+{
+    if (matrix == nullptr || m == nullptr || n == nullptr)
+        return amplapack_argument_error;
+
+    *m = matrix->m;
+    *n = matrix->n;
+
+    return amplapack_success;
+}
+
+amplapack_status amplapack_sset_matrix(amplapack_matrix matrix, const float* a, int lda, int* info)
+{
+    return _detail::do_set_matrix(matrix, a, lda, *info);
+}
+
+amplapack_status amplapack_dset_matrix(amplapack_matrix matrix, const double* a, int lda, int* info)
+{
+    return _detail::do_set_matrix(matrix, a, lda, *info);
+}
+
+amplapack_status amplapack_cset_matrix(amplapack_matrix matrix, const amplapack_fcomplex* a, int lda, int* info)
+{
+    return _detail::do_set_matrix(matrix, amplapack::amplapack_cast(a), lda, *info);
+}
+
+amplapack_status amplapack_zset_matrix(amplapack_matrix matrix, const amplapack_dcomplex* a, int lda, int* info)
+{
+    return _detail::do_set_matrix(matrix, amplapack::amplapack_cast(a), lda, *info);
+}
+
+amplapack_status amplapack_sget_matrix(amplapack_matrix matrix, float* a, int lda, int* info)
+{
+    return _detail::do_get_matrix(matrix, a, lda, *info);
+}
+
+amplapack_status amplapack_dget_matrix(amplapack_matrix matrix, double* a, int lda, int* info)
+{
+    return _detail::do_get_matrix(matrix, a, lda, *info);
+}
+
+amplapack_status amplapack_cget_matrix(amplapack_matrix matrix, amplapack_fcomplex* a, int lda, int* info)
+{
+    return _detail::do_get_matrix(matrix, amplapack::amplapack_cast(a), lda, *info);
+}
+
+amplapack_status amplapack_zget_matrix(amplapack_matrix matrix, amplapack_dcomplex* a, int lda, int* info)
+{
+    return _detail::do_get_matrix(matrix, amplapack::amplapack_cast(a), lda, *info);
+}
+
+} // extern "C"
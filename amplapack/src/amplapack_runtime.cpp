@@ -1,65 +1,222 @@
-#include "amplapack_runtime.h"
-
-namespace amplapack {
-
-// exception safe execution wrapper
-amplapack_status safe_call_interface(std::function<void(concurrency::accelerator_view& av)>& functor, int& info)
-{
-    const bool allow_unsafe = false;
-
-    if (allow_unsafe)
-    {
-        // only used for debugging
-        concurrency::accelerator_view av(concurrency::accelerator().default_view);
-        functor(av);
-        return amplapack_success;
-    }
-
-    try
-    {
-        // for now, simply use the default view
-        concurrency::accelerator_view av(concurrency::accelerator().default_view);
-
-        // safely call the amplack routine with the specific view
-        functor(av);
-    }
-    catch(const data_error_exception& e)
-    {
-        // in traditional LAPACK interface a positive info represents a data error
-        // this data error differs from routine to routine, but is typically used to indicate a specific point of failure
-        info = e.get();
-        return amplapack_data_error;
-    }
-    catch(const argument_error_exception& e)
-    {
-        // in traditional LAPACK interfaces a negative info represents a parameter error
-        info = -static_cast<int>(e.get());
-        return amplapack_argument_error;
-    }
-    catch(const runtime_error_exception&)
-    {
-        // this typically indicates an algorithmic error
-        return amplapack_internal_error;
-    }
-    catch (const std::bad_alloc&)
-    {
-        return amplapack_memory_error;
-    }
-    catch(const concurrency::runtime_exception& e)
-    {
-        // return the AMP runtime error code
-        info = e.get_error_code();
-        return amplapack_runtime_error;
-    }
-    catch(...)
-    {
-        // this should not be encountered under normal operation
-        return amplapack_unknown_error;
-    }
-
-    // no error!
-    info = 0;
-    return amplapack_success;
-}
-
-} // namespace amplapack
+#include "amplapack_runtime.h"
+
+namespace amplapack {
+namespace {
+
+// maps library and runtime exceptions onto status codes
+template <typename functor_type>
+amplapack_status guarded_call(functor_type& functor, int& info)
+{
+    const bool allow_unsafe = false;
+
+    if (allow_unsafe)
+    {
+        // only used for debugging
+        functor();
+        return amplapack_success;
+    }
+
+    try
+    {
+        // safely call the amplack routine
+        functor();
+    }
+    catch(const data_error_exception& e)
+    {
+        // in traditional LAPACK interface a positive info represents a data error
+        // this data error differs from routine to routine, but is typically used to indicate a specific point of failure
+        info = e.get();
+        return amplapack_data_error;
+    }
+    catch(const argument_error_exception& e)
+    {
+        // in traditional LAPACK interfaces a negative info represents a parameter error
+        info = -static_cast<int>(e.get());
+        return amplapack_argument_error;
+    }
+    catch(const runtime_error_exception&)
+    {
+        // this typically indicates an algorithmic error
+        return amplapack_internal_error;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return amplapack_memory_error;
+    }
+    catch (const concurrency::out_of_memory&)
+    {
+        // the accelerator could not satisfy an allocation
+        return amplapack_memory_error;
+    }
+    catch(const concurrency::runtime_exception& e)
+    {
+        // return the AMP runtime error code
+        info = e.get_error_code();
+        return amplapack_runtime_error;
+    }
+    catch(...)
+    {
+        // this should not be encountered under normal operation
+        return amplapack_unknown_error;
+    }
+
+    // no error!
+    info = 0;
+    return amplapack_success;
+}
+
+// binds a view functor to the default view
+struct default_view_call
+{
+    std::function<void(concurrency::accelerator_view& av)>& functor;
+
+    default_view_call(std::function<void(concurrency::accelerator_view& av)>& functor)
+        : functor(functor)
+    {}
+
+    void operator()()
+    {
+        // for now, simply use the default view
+        concurrency::accelerator_view av(concurrency::accelerator().default_view);
+        functor(av);
+    }
+};
+
+// binds a context functor to a temporary context on the default view
+struct default_context_call
+{
+    std::function<void(context& ctx)>& functor;
+
+    default_context_call(std::function<void(context& ctx)>& functor)
+        : functor(functor)
+    {}
+
+    void operator()()
+    {
+        context ctx(concurrency::accelerator().default_view);
+        functor(ctx);
+    }
+};
+
+// binds a context functor to an existing context
+struct context_call
+{
+    std::function<void(context& ctx)>& functor;
+    context& ctx;
+
+    context_call(std::function<void(context& ctx)>& functor, context& ctx)
+        : functor(functor), ctx(ctx)
+    {}
+
+    void operator()()
+    {
+        // the transfer counter reports the traffic of the last call only
+        ctx.get_transfers().reset();
+        functor(ctx);
+    }
+};
+
+// binds an asynchronous functor to a new call on an existing context (or on a context of the
+// default view owned by the call's token) and hands the token out once the work is queued
+struct async_context_call
+{
+    std::function<void(context& ctx, async_call& call)>& functor;
+    context* ctx;
+    amplapack_async& token;
+
+    async_context_call(std::function<void(context& ctx, async_call& call)>& functor, context* ctx, amplapack_async& token)
+        : functor(functor), ctx(ctx), token(token)
+    {}
+
+    void operator()()
+    {
+        std::unique_ptr<amplapack_async_t> new_token(new amplapack_async_t);
+
+        if (ctx == nullptr)
+            new_token->ctx.reset(new context(concurrency::accelerator().default_view));
+
+        context& call_ctx = (ctx != nullptr ? *ctx : *new_token->ctx);
+
+        // the transfer counter reports the traffic of the last call only
+        call_ctx.get_transfers().reset();
+        functor(call_ctx, new_token->call);
+
+        token = new_token.release();
+    }
+};
+
+} // namespace
+
+// exception safe execution wrapper
+amplapack_status safe_call_interface(std::function<void(concurrency::accelerator_view& av)>& functor, int& info)
+{
+    default_view_call call(functor);
+    return guarded_call(call, info);
+}
+
+amplapack_status safe_call_interface(std::function<void(context& ctx)>& functor, int& info)
+{
+    default_context_call call(functor);
+    return guarded_call(call, info);
+}
+
+amplapack_status safe_call_interface(std::function<void(context& ctx)>& functor, amplapack_handle handle, int& info)
+{
+    // the handle is the first argument of every handle variant
+    if (handle == nullptr)
+    {
+        info = -1;
+        return amplapack_argument_error;
+    }
+
+    context_call call(functor, handle->ctx);
+    return guarded_call(call, info);
+}
+
+amplapack_status safe_call_interface(std::function<void()>& functor, int& info)
+{
+    return guarded_call(functor, info);
+}
+
+amplapack_status safe_call_interface(std::function<void(context& ctx, async_call& call)>& functor, amplapack_async* token, int& info)
+{
+    if (token == nullptr)
+        return amplapack_argument_error;
+
+    *token = nullptr;
+
+    async_context_call call(functor, nullptr, *token);
+    return guarded_call(call, info);
+}
+
+amplapack_status safe_call_interface(std::function<void(context& ctx, async_call& call)>& functor, amplapack_handle handle, amplapack_async* token, int& info)
+{
+    // the handle is the first argument of every handle variant
+    if (handle == nullptr)
+    {
+        info = -1;
+        return amplapack_argument_error;
+    }
+
+    if (token == nullptr)
+        return amplapack_argument_error;
+
+    *token = nullptr;
+
+    async_context_call call(functor, &handle->ctx, *token);
+    return guarded_call(call, info);
+}
+
+amplapack_status safe_call_interface(std::function<void(context& ctx)>& functor, amplapack_matrix matrix, int argument, int& info)
+{
+    if (matrix == nullptr)
+    {
+        info = -argument;
+        return amplapack_argument_error;
+    }
+
+    context_call call(functor, matrix->handle->ctx);
+    return guarded_call(call, info);
+}
+
+} // namespace amplapack
@@ -0,0 +1,361 @@
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * amplapack_stream.cpp
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include <amp.h>
+
+#include "ampclapack.h"
+#include "amplapack_runtime.h"
+
+#include "detail\out_of_core.h"
+
+namespace _detail {
+
+// the tile stream of the C interface
+template <typename value_type>
+class callback_stream : public amplapack::tile_stream<value_type>
+{
+public:
+    callback_stream(const amplapack_tile_stream& stream)
+        : stream(stream)
+    {}
+
+    void read(int i, int j, int m, int n, value_type* buffer, int ld)
+    {
+        if (stream.read(stream.user_data, i, j, m, n, buffer, ld) != 0)
+            amplapack::runtime_error();
+    }
+
+    void write(int i, int j, int m, int n, const value_type* buffer, int ld)
+    {
+        if (stream.write(stream.user_data, i, j, m, n, buffer, ld) != 0)
+            amplapack::runtime_error();
+    }
+
+    void progress(int done, int total)
+    {
+        if (stream.progress)
+            stream.progress(stream.user_data, done, total);
+    }
+
+private:
+    amplapack_tile_stream stream;
+};
+
+// a column major matrix in a file; the columns are mapped a chunk of at most max_view_bytes 
+// at a time, so that neither host memory nor the address space needs to hold the matrix
+template <typename value_type>
+class mapped_file_stream : public amplapack::tile_stream<value_type>
+{
+public:
+    static const long long max_view_bytes = 64 << 20;
+
+    mapped_file_stream(const char* file_name, long long offset, int n, int lda, amplapack_progress progress_callback, void* user_data)
+        : file(INVALID_HANDLE_VALUE), mapping(nullptr), offset(offset), lda(lda), progress_callback(progress_callback), user_data(user_data)
+    {
+        file = CreateFileA(file_name, GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+            amplapack::argument_error(4);
+
+        // the last column only needs its first n elements
+        LARGE_INTEGER size;
+        const long long required = offset + (static_cast<long long>(n-1)*lda + n)*sizeof(value_type);
+
+        if (!GetFileSizeEx(file, &size) || size.QuadPart < required)
+        {
+            CloseHandle(file);
+            amplapack::argument_error(4);
+        }
+
+        file_size = size.QuadPart;
+
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+
+        if (mapping == nullptr)
+        {
+            CloseHandle(file);
+            amplapack::runtime_error();
+        }
+
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        granularity = info.dwAllocationGranularity;
+    }
+
+    ~mapped_file_stream()
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+    }
+
+    void read(int i, int j, int m, int n, value_type* buffer, int ld)
+    {
+        map_columns(j, n, [&](char* column, int first, int count) {
+            for (int c = 0; c < count; c++)
+                std::memcpy(buffer + (first-j+c)*ld, column + (static_cast<long long>(c)*lda + i)*sizeof(value_type), m*sizeof(value_type));
+        });
+    }
+
+    void write(int i, int j, int m, int n, const value_type* buffer, int ld)
+    {
+        map_columns(j, n, [&](char* column, int first, int count) {
+            for (int c = 0; c < count; c++)
+                std::memcpy(column + (static_cast<long long>(c)*lda + i)*sizeof(value_type), buffer + (first-j+c)*ld, m*sizeof(value_type));
+        });
+    }
+
+    void progress(int done, int total)
+    {
+        if (progress_callback)
+            progress_callback(user_data, done, total);
+    }
+
+private:
+    // non-copyable
+    mapped_file_stream(const mapped_file_stream&);
+    mapped_file_stream& operator=(const mapped_file_stream&);
+
+    // maps the columns j:j+n a chunk at a time and calls f(column, first, count) with the 
+    // address of column first of each chunk
+    template <typename function_type>
+    void map_columns(int j, int n, function_type f)
+    {
+        const long long column_bytes = static_cast<long long>(lda)*sizeof(value_type);
+        const int chunk = static_cast<int>(std::max(1LL, max_view_bytes / column_bytes));
+
+        for (int first = j; first < j+n; first += chunk)
+        {
+            const int count = std::min(chunk, j+n-first);
+
+            // views start on the allocation granularity and may not extend past the file
+            const long long begin = offset + first*column_bytes;
+            const long long aligned = begin - begin % granularity;
+            const long long end = std::min(begin + count*column_bytes, file_size);
+
+            void* view = MapViewOfFile(mapping, FILE_MAP_WRITE, static_cast<DWORD>(aligned >> 32), static_cast<DWORD>(aligned & 0xffffffff), static_cast<SIZE_T>(end - aligned));
+
+            if (view == nullptr)
+                amplapack::runtime_error();
+
+            f(static_cast<char*>(view) + (begin - aligned), first, count);
+
+            UnmapViewOfFile(view);
+        }
+    }
+
+    HANDLE file;
+    HANDLE mapping;
+    long long file_size;
+    long long offset;
+    long long granularity;
+    int lda;
+    amplapack_progress progress_callback;
+    void* user_data;
+};
+
+template <typename value_type>
+void potrf_stream(amplapack::context& ctx, char uplo, int n, const amplapack_tile_stream* a, size_t workspace)
+{
+    // error checking
+    if (a == nullptr || a->read == nullptr || a->write == nullptr)
+        amplapack::argument_error(4);
+
+    callback_stream<value_type> stream(*a);
+    amplapack::potrf_stream(ctx, uplo, n, stream, workspace);
+}
+
+// NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+struct potrf_file_params
+{
+    char uplo;
+    int n;
+    const char* file_name;
+    long long offset;
+    int lda;
+    size_t workspace;
+    amplapack_progress progress;
+    void* user_data;
+
+    potrf_file_params(char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data)
+        : uplo(uplo), n(n), file_name(file_name), offset(offset), lda(lda), workspace(workspace), progress(progress), user_data(user_data)
+    {}
+};
+
+template <typename value_type>
+void potrf_file(amplapack::context& ctx, const potrf_file_params& p)
+{
+    // quick return
+    if (p.n == 0)
+        return;
+
+    // error checking
+    const char uplo = static_cast<char>(toupper(p.uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        amplapack::argument_error(2);
+    if (p.n < 0)
+        amplapack::argument_error(3);
+    if (p.file_name == nullptr)
+        amplapack::argument_error(4);
+    if (p.offset < 0)
+        amplapack::argument_error(5);
+    if (p.lda < p.n)
+        amplapack::argument_error(6);
+
+    const int slab = amplapack::_detail::ooc::get_potrf_slab_width<value_type>(p.n, p.workspace);
+
+    if (slab == 0)
+        amplapack::argument_error(7);
+
+    mapped_file_stream<value_type> stream(p.file_name, p.offset, p.n, p.lda, p.progress, p.user_data);
+
+    amplapack::_detail::ooc::stream_source<value_type> source(stream, size_t(p.n)*slab);
+    amplapack::_detail::ooc::potrf<amplapack::_detail::potrf_block_size>(ctx, amplapack::to_option(uplo), p.n, source, slab);
+}
+
+template <typename value_type>
+amplapack_status do_potrf_stream(char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(potrf_stream<value_type>, std::placeholders::_1, uplo, n, a, workspace);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_potrf_stream(amplapack_handle handle, char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(potrf_stream<value_type>, std::placeholders::_1, uplo, n, a, workspace);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+amplapack_status do_potrf_file(const potrf_file_params& params, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(potrf_file<value_type>, std::placeholders::_1, params);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_potrf_file(amplapack_handle handle, const potrf_file_params& params, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(potrf_file<value_type>, std::placeholders::_1, params);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+} // namespace _detail
+
+extern "C" {
+
+amplapack_status amplapack_spotrf_stream(char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info)
+{
+    return _detail::do_potrf_stream<float>(uplo, n, a, workspace, *info); 
+}
+
+amplapack_status amplapack_dpotrf_stream(char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info)
+{
+    return _detail::do_potrf_stream<double>(uplo, n, a, workspace, *info); 
+}
+
+amplapack_status amplapack_cpotrf_stream(char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info)
+{
+    return _detail::do_potrf_stream<ampblas::complex<float>>(uplo, n, a, workspace, *info); 
+}
+
+amplapack_status amplapack_zpotrf_stream(char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info)
+{
+    return _detail::do_potrf_stream<ampblas::complex<double>>(uplo, n, a, workspace, *info); 
+}
+
+amplapack_status amplapack_spotrf_stream_h(amplapack_handle handle, char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info)
+{
+    return _detail::do_potrf_stream<float>(handle, uplo, n, a, workspace, *info); 
+}
+
+amplapack_status amplapack_dpotrf_stream_h(amplapack_handle handle, char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info)
+{
+    return _detail::do_potrf_stream<double>(handle, uplo, n, a, workspace, *info); 
+}
+
+amplapack_status amplapack_cpotrf_stream_h(amplapack_handle handle, char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info)
+{
+    return _detail::do_potrf_stream<ampblas::complex<float>>(handle, uplo, n, a, workspace, *info); 
+}
+
+amplapack_status amplapack_zpotrf_stream_h(amplapack_handle handle, char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info)
+{
+    return _detail::do_potrf_stream<ampblas::complex<double>>(handle, uplo, n, a, workspace, *info); 
+}
+
+amplapack_status amplapack_spotrf_file(char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info)
+{
+    return _detail::do_potrf_file<float>(_detail::potrf_file_params(uplo, n, file_name, offset, lda, workspace, progress, user_data), *info); 
+}
+
+amplapack_status amplapack_dpotrf_file(char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info)
+{
+    return _detail::do_potrf_file<double>(_detail::potrf_file_params(uplo, n, file_name, offset, lda, workspace, progress, user_data), *info); 
+}
+
+amplapack_status amplapack_cpotrf_file(char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info)
+{
+    return _detail::do_potrf_file<ampblas::complex<float>>(_detail::potrf_file_params(uplo, n, file_name, offset, lda, workspace, progress, user_data), *info); 
+}
+
+amplapack_status amplapack_zpotrf_file(char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info)
+{
+    return _detail::do_potrf_file<ampblas::complex<double>>(_detail::potrf_file_params(uplo, n, file_name, offset, lda, workspace, progress, user_data), *info); 
+}
+
+amplapack_status amplapack_spotrf_file_h(amplapack_handle handle, char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info)
+{
+    return _detail::do_potrf_file<float>(handle, _detail::potrf_file_params(uplo, n, file_name, offset, lda, workspace, progress, user_data), *info); 
+}
+
+amplapack_status amplapack_dpotrf_file_h(amplapack_handle handle, char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info)
+{
+    return _detail::do_potrf_file<double>(handle, _detail::potrf_file_params(uplo, n, file_name, offset, lda, workspace, progress, user_data), *info); 
+}
+
+amplapack_status amplapack_cpotrf_file_h(amplapack_handle handle, char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info)
+{
+    return _detail::do_potrf_file<ampblas::complex<float>>(handle, _detail::potrf_file_params(uplo, n, file_name, offset, lda, workspace, progress, user_data), *info); 
+}
+
+amplapack_status amplapack_zpotrf_file_h(amplapack_handle handle, char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info)
+{
+    return _detail::do_potrf_file<ampblas::complex<double>>(handle, _detail::potrf_file_params(uplo, n, file_name, offset, lda, workspace, progress, user_data), *info); 
+}
+
+} // extern "C"
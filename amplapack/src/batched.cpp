@@ -0,0 +1,426 @@
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * batched.cpp
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <functional>
+
+#include <amp.h>
+
+#include "ampclapack.h"      
+#include "amplapack_runtime.h"
+
+#include "detail\batched.h"    
+
+namespace _detail {
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_getrf_batched(int m, int n, value_type** a_array, int lda, int** ipiv_array, int* info_array, int batch_count)
+{
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    return std::bind(amplapack::_detail::getrf_batched_unpack<value_type>, std::placeholders::_1, amplapack::_detail::getrf_batched_params<value_type>(m, n, a_array, lda, ipiv_array, info_array, batch_count));
+}
+
+template <typename value_type>
+amplapack_status do_getrf_batched(int m, int n, value_type** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_getrf_batched(m, n, a_array, lda, ipiv_array, info_array, batch_count);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_getrf_batched(amplapack_handle handle, int m, int n, value_type** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_getrf_batched(m, n, a_array, lda, ipiv_array, info_array, batch_count);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_getrf_strided_batched(int m, int n, value_type* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count)
+{
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    return std::bind(amplapack::_detail::getrf_strided_batched_unpack<value_type>, std::placeholders::_1, amplapack::_detail::getrf_strided_batched_params<value_type>(m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count));
+}
+
+template <typename value_type>
+amplapack_status do_getrf_strided_batched(int m, int n, value_type* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_getrf_strided_batched(m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_getrf_strided_batched(amplapack_handle handle, int m, int n, value_type* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_getrf_strided_batched(m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_potrf_batched(char uplo, int n, value_type** a_array, int lda, int* info_array, int batch_count)
+{
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    return std::bind(amplapack::_detail::potrf_batched_unpack<value_type>, std::placeholders::_1, amplapack::_detail::potrf_batched_params<value_type>(uplo, n, a_array, lda, info_array, batch_count));
+}
+
+template <typename value_type>
+amplapack_status do_potrf_batched(char uplo, int n, value_type** a_array, int lda, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_potrf_batched(uplo, n, a_array, lda, info_array, batch_count);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_potrf_batched(amplapack_handle handle, char uplo, int n, value_type** a_array, int lda, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_potrf_batched(uplo, n, a_array, lda, info_array, batch_count);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_potrf_strided_batched(char uplo, int n, value_type* a, int lda, int stride_a, int* info_array, int batch_count)
+{
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    return std::bind(amplapack::_detail::potrf_strided_batched_unpack<value_type>, std::placeholders::_1, amplapack::_detail::potrf_strided_batched_params<value_type>(uplo, n, a, lda, stride_a, info_array, batch_count));
+}
+
+template <typename value_type>
+amplapack_status do_potrf_strided_batched(char uplo, int n, value_type* a, int lda, int stride_a, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_potrf_strided_batched(uplo, n, a, lda, stride_a, info_array, batch_count);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_potrf_strided_batched(amplapack_handle handle, char uplo, int n, value_type* a, int lda, int stride_a, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_potrf_strided_batched(uplo, n, a, lda, stride_a, info_array, batch_count);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_geqrf_batched(int m, int n, value_type** a_array, int lda, value_type** tau_array, int* info_array, int batch_count)
+{
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    return std::bind(amplapack::_detail::geqrf_batched_unpack<value_type>, std::placeholders::_1, amplapack::_detail::geqrf_batched_params<value_type>(m, n, a_array, lda, tau_array, info_array, batch_count));
+}
+
+template <typename value_type>
+amplapack_status do_geqrf_batched(int m, int n, value_type** a_array, int lda, value_type** tau_array, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_geqrf_batched(m, n, a_array, lda, tau_array, info_array, batch_count);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_geqrf_batched(amplapack_handle handle, int m, int n, value_type** a_array, int lda, value_type** tau_array, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_geqrf_batched(m, n, a_array, lda, tau_array, info_array, batch_count);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_geqrf_strided_batched(int m, int n, value_type* a, int lda, int stride_a, value_type* tau, int stride_tau, int* info_array, int batch_count)
+{
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    return std::bind(amplapack::_detail::geqrf_strided_batched_unpack<value_type>, std::placeholders::_1, amplapack::_detail::geqrf_strided_batched_params<value_type>(m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count));
+}
+
+template <typename value_type>
+amplapack_status do_geqrf_strided_batched(int m, int n, value_type* a, int lda, int stride_a, value_type* tau, int stride_tau, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_geqrf_strided_batched(m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_geqrf_strided_batched(amplapack_handle handle, int m, int n, value_type* a, int lda, int stride_a, value_type* tau, int stride_tau, int* info_array, int batch_count, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_geqrf_strided_batched(m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+} // namespace _detail
+
+extern "C" {
+
+amplapack_status amplapack_sgetrf_batched(int m, int n, float** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_batched(m, n, a_array, lda, ipiv_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dgetrf_batched(int m, int n, double** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_batched(m, n, a_array, lda, ipiv_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cgetrf_batched(int m, int n, amplapack_fcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_batched(m, n, amplapack::amplapack_cast(a_array), lda, ipiv_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zgetrf_batched(int m, int n, amplapack_dcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_batched(m, n, amplapack::amplapack_cast(a_array), lda, ipiv_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_sgetrf_batched_h(amplapack_handle handle, int m, int n, float** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_batched(handle, m, n, a_array, lda, ipiv_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dgetrf_batched_h(amplapack_handle handle, int m, int n, double** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_batched(handle, m, n, a_array, lda, ipiv_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cgetrf_batched_h(amplapack_handle handle, int m, int n, amplapack_fcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_batched(handle, m, n, amplapack::amplapack_cast(a_array), lda, ipiv_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zgetrf_batched_h(amplapack_handle handle, int m, int n, amplapack_dcomplex** a_array, int lda, int** ipiv_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_batched(handle, m, n, amplapack::amplapack_cast(a_array), lda, ipiv_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_sgetrf_strided_batched(int m, int n, float* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_strided_batched(m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dgetrf_strided_batched(int m, int n, double* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_strided_batched(m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cgetrf_strided_batched(int m, int n, amplapack_fcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_strided_batched(m, n, amplapack::amplapack_cast(a), lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zgetrf_strided_batched(int m, int n, amplapack_dcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_strided_batched(m, n, amplapack::amplapack_cast(a), lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_sgetrf_strided_batched_h(amplapack_handle handle, int m, int n, float* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_strided_batched(handle, m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dgetrf_strided_batched_h(amplapack_handle handle, int m, int n, double* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_strided_batched(handle, m, n, a, lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cgetrf_strided_batched_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_strided_batched(handle, m, n, amplapack::amplapack_cast(a), lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zgetrf_strided_batched_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int stride_a, int* ipiv, int stride_ipiv, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_getrf_strided_batched(handle, m, n, amplapack::amplapack_cast(a), lda, stride_a, ipiv, stride_ipiv, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_spotrf_batched(char uplo, int n, float** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_batched(uplo, n, a_array, lda, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dpotrf_batched(char uplo, int n, double** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_batched(uplo, n, a_array, lda, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cpotrf_batched(char uplo, int n, amplapack_fcomplex** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_batched(uplo, n, amplapack::amplapack_cast(a_array), lda, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zpotrf_batched(char uplo, int n, amplapack_dcomplex** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_batched(uplo, n, amplapack::amplapack_cast(a_array), lda, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_spotrf_batched_h(amplapack_handle handle, char uplo, int n, float** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_batched(handle, uplo, n, a_array, lda, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dpotrf_batched_h(amplapack_handle handle, char uplo, int n, double** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_batched(handle, uplo, n, a_array, lda, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cpotrf_batched_h(amplapack_handle handle, char uplo, int n, amplapack_fcomplex** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_batched(handle, uplo, n, amplapack::amplapack_cast(a_array), lda, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zpotrf_batched_h(amplapack_handle handle, char uplo, int n, amplapack_dcomplex** a_array, int lda, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_batched(handle, uplo, n, amplapack::amplapack_cast(a_array), lda, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_spotrf_strided_batched(char uplo, int n, float* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_strided_batched(uplo, n, a, lda, stride_a, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dpotrf_strided_batched(char uplo, int n, double* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_strided_batched(uplo, n, a, lda, stride_a, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cpotrf_strided_batched(char uplo, int n, amplapack_fcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_strided_batched(uplo, n, amplapack::amplapack_cast(a), lda, stride_a, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zpotrf_strided_batched(char uplo, int n, amplapack_dcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_strided_batched(uplo, n, amplapack::amplapack_cast(a), lda, stride_a, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_spotrf_strided_batched_h(amplapack_handle handle, char uplo, int n, float* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_strided_batched(handle, uplo, n, a, lda, stride_a, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dpotrf_strided_batched_h(amplapack_handle handle, char uplo, int n, double* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_strided_batched(handle, uplo, n, a, lda, stride_a, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cpotrf_strided_batched_h(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_strided_batched(handle, uplo, n, amplapack::amplapack_cast(a), lda, stride_a, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zpotrf_strided_batched_h(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, int stride_a, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_potrf_strided_batched(handle, uplo, n, amplapack::amplapack_cast(a), lda, stride_a, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_sgeqrf_batched(int m, int n, float** a_array, int lda, float** tau_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_batched(m, n, a_array, lda, tau_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dgeqrf_batched(int m, int n, double** a_array, int lda, double** tau_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_batched(m, n, a_array, lda, tau_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cgeqrf_batched(int m, int n, amplapack_fcomplex** a_array, int lda, amplapack_fcomplex** tau_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_batched(m, n, amplapack::amplapack_cast(a_array), lda, amplapack::amplapack_cast(tau_array), info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zgeqrf_batched(int m, int n, amplapack_dcomplex** a_array, int lda, amplapack_dcomplex** tau_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_batched(m, n, amplapack::amplapack_cast(a_array), lda, amplapack::amplapack_cast(tau_array), info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_sgeqrf_batched_h(amplapack_handle handle, int m, int n, float** a_array, int lda, float** tau_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_batched(handle, m, n, a_array, lda, tau_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dgeqrf_batched_h(amplapack_handle handle, int m, int n, double** a_array, int lda, double** tau_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_batched(handle, m, n, a_array, lda, tau_array, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cgeqrf_batched_h(amplapack_handle handle, int m, int n, amplapack_fcomplex** a_array, int lda, amplapack_fcomplex** tau_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_batched(handle, m, n, amplapack::amplapack_cast(a_array), lda, amplapack::amplapack_cast(tau_array), info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zgeqrf_batched_h(amplapack_handle handle, int m, int n, amplapack_dcomplex** a_array, int lda, amplapack_dcomplex** tau_array, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_batched(handle, m, n, amplapack::amplapack_cast(a_array), lda, amplapack::amplapack_cast(tau_array), info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_sgeqrf_strided_batched(int m, int n, float* a, int lda, int stride_a, float* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_strided_batched(m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dgeqrf_strided_batched(int m, int n, double* a, int lda, int stride_a, double* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_strided_batched(m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cgeqrf_strided_batched(int m, int n, amplapack_fcomplex* a, int lda, int stride_a, amplapack_fcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_strided_batched(m, n, amplapack::amplapack_cast(a), lda, stride_a, amplapack::amplapack_cast(tau), stride_tau, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zgeqrf_strided_batched(int m, int n, amplapack_dcomplex* a, int lda, int stride_a, amplapack_dcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_strided_batched(m, n, amplapack::amplapack_cast(a), lda, stride_a, amplapack::amplapack_cast(tau), stride_tau, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_sgeqrf_strided_batched_h(amplapack_handle handle, int m, int n, float* a, int lda, int stride_a, float* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_strided_batched(handle, m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_dgeqrf_strided_batched_h(amplapack_handle handle, int m, int n, double* a, int lda, int stride_a, double* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_strided_batched(handle, m, n, a, lda, stride_a, tau, stride_tau, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_cgeqrf_strided_batched_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int stride_a, amplapack_fcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_strided_batched(handle, m, n, amplapack::amplapack_cast(a), lda, stride_a, amplapack::amplapack_cast(tau), stride_tau, info_array, batch_count, *info); 
+}
+
+amplapack_status amplapack_zgeqrf_strided_batched_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int stride_a, amplapack_dcomplex* tau, int stride_tau, int* info_array, int batch_count, int* info)
+{
+    return _detail::do_geqrf_strided_batched(handle, m, n, amplapack::amplapack_cast(a), lda, stride_a, amplapack::amplapack_cast(tau), stride_tau, info_array, batch_count, *info); 
+}
+
+} // extern "C"
@@ -1,67 +1,637 @@
-/*----------------------------------------------------------------------------
- * Copyright  Microsoft Corp.
- *
- * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
- * use this file except in compliance with the License.  You may obtain a copy 
- * of the License at http://www.apache.org/licenses/LICENSE-2.0  
- * 
- * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
- * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
- * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
- * MERCHANTABLITY OR NON-INFRINGEMENT. 
- *
- * See the Apache Version 2.0 License for specific language governing 
- * permissions and limitations under the License.
- *---------------------------------------------------------------------------
- * 
- * geqrf.cpp
- *
- *---------------------------------------------------------------------------*/
-
-#include <functional>
-
-#include <amp.h>
-
-#include "ampclapack.h"      
-#include "amplapack_runtime.h"
-
-#include "detail\geqrf.h"    
-
-namespace _detail {
-
-template <typename value_type>
-amplapack_status do_geqrf(int m, int n, value_type* a, int lda, value_type* tau, int& info)
-{
-    // create interface functor
-    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
-    std::function<void(concurrency::accelerator_view&)> f = std::bind(amplapack::_detail::geqrf_unpack<value_type>, std::placeholders::_1, amplapack::_detail::geqrf_params<value_type>(m, n, a, lda, tau));
-
-    // execute using interface
-    return amplapack::safe_call_interface(f, info);
-}
-
-} // namespace _detail
-
-extern "C" {
-
-amplapack_status amplapack_sgeqrf(int m, int n, float* a, int lda, float* tau, int* info)
-{
-    return _detail::do_geqrf(m, n, a, lda, tau, *info); 
-}
-
-amplapack_status amplapack_dgeqrf(int m, int n, double* a, int lda, double* tau, int* info)
-{
-    return _detail::do_geqrf(m, n, a, lda, tau, *info); 
-}
-
-amplapack_status amplapack_cgeqrf(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, int* info)
-{
-    return _detail::do_geqrf(m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), *info); 
-}
-
-amplapack_status amplapack_zgeqrf(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, int* info)
-{
-    return _detail::do_geqrf(m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), *info); 
-}
-
-} // extern "C"
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * geqrf.cpp
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <functional>
+
+#include <amp.h>
+
+#include "ampclapack.h"      
+#include "amplapack_runtime.h"
+
+#include "detail\geqrf.h"
+#include "detail\out_of_core.h"
+
+namespace _detail {
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_geqrf(int m, int n, value_type* a, int lda, value_type* tau)
+{
+    using amplapack::execution_target;
+
+    // create interface functor
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::geqrf_params<value_type> params(m, n, a, lda, tau);
+
+    // run where the problem size is best served
+    switch (amplapack::select_target(amplapack_geqrf_routine, amplapack::precision_of<value_type>(), std::min(m,n)))
+    {
+    case execution_target::host:
+        return std::bind(amplapack::_detail::geqrf_unpack<execution_target::host, value_type>, std::placeholders::_1, params);
+    case execution_target::accelerator:
+        return std::bind(amplapack::_detail::geqrf_unpack<execution_target::accelerator, value_type>, std::placeholders::_1, params);
+    case execution_target::hybrid:
+    default:
+        return std::bind(amplapack::_detail::geqrf_unpack<execution_target::hybrid, value_type>, std::placeholders::_1, params);
+    }
+}
+
+template <typename value_type>
+amplapack_status do_geqrf(int m, int n, value_type* a, int lda, value_type* tau, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_geqrf(m, n, a, lda, tau);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_geqrf(amplapack_handle handle, int m, int n, value_type* a, int lda, value_type* tau, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_geqrf(m, n, a, lda, tau);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_ormqr(char side, char trans, int m, int n, int k, const value_type* a, int lda, const value_type* tau, value_type* c, int ldc)
+{
+    using amplapack::execution_target;
+
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::ormqr_params<value_type> params(side, trans, m, n, k, a, lda, tau, c, ldc);
+
+    // the number of reflectors stands in for the problem size
+    if (amplapack::select_target(amplapack_geqrf_routine, amplapack::precision_of<value_type>(), k) == execution_target::host)
+        return std::bind(amplapack::_detail::ormqr_unpack<execution_target::host, value_type>, std::placeholders::_1, params);
+    else
+        return std::bind(amplapack::_detail::ormqr_unpack<execution_target::hybrid, value_type>, std::placeholders::_1, params);
+}
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_orgqr(int m, int n, int k, value_type* a, int lda, const value_type* tau)
+{
+    using amplapack::execution_target;
+
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::orgqr_params<value_type> params(m, n, k, a, lda, tau);
+
+    if (amplapack::select_target(amplapack_geqrf_routine, amplapack::precision_of<value_type>(), n) == execution_target::host)
+        return std::bind(amplapack::_detail::orgqr_unpack<execution_target::host, value_type>, std::placeholders::_1, params);
+    else
+        return std::bind(amplapack::_detail::orgqr_unpack<execution_target::hybrid, value_type>, std::placeholders::_1, params);
+}
+
+template <typename value_type>
+amplapack_status do_ormqr(char side, char trans, int m, int n, int k, const value_type* a, int lda, const value_type* tau, value_type* c, int ldc, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_ormqr(side, trans, m, n, k, a, lda, tau, c, ldc);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_ormqr(amplapack_handle handle, char side, char trans, int m, int n, int k, const value_type* a, int lda, const value_type* tau, value_type* c, int ldc, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_ormqr(side, trans, m, n, k, a, lda, tau, c, ldc);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+amplapack_status do_orgqr(int m, int n, int k, value_type* a, int lda, const value_type* tau, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_orgqr(m, n, k, a, lda, tau);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_orgqr(amplapack_handle handle, int m, int n, int k, value_type* a, int lda, const value_type* tau, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_orgqr(m, n, k, a, lda, tau);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+amplapack_status do_geqrf_workspace(int m, int n, size_t* size)
+{
+    if (m < 0 || n < 0 || size == nullptr)
+        return amplapack_argument_error;
+
+    *size = amplapack::geqrf_workspace<value_type>(m, n);
+    return amplapack_success;
+}
+
+// the asynchronous variant never returns to the host between panels, so it runs on the 
+// accelerator unless the problem is small enough for the host
+template <typename value_type>
+std::function<void(amplapack::context&, amplapack::async_call&)> make_geqrf_async(int m, int n, value_type* a, int lda, value_type* tau)
+{
+    using amplapack::execution_target;
+
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::geqrf_params<value_type> params(m, n, a, lda, tau);
+
+    if (amplapack::select_target(amplapack_geqrf_routine, amplapack::precision_of<value_type>(), std::min(m,n)) == execution_target::host)
+        return std::bind(amplapack::_detail::geqrf_async_unpack<execution_target::host, value_type>, std::placeholders::_1, std::placeholders::_2, params);
+    else
+        return std::bind(amplapack::_detail::geqrf_async_unpack<execution_target::accelerator, value_type>, std::placeholders::_1, std::placeholders::_2, params);
+}
+
+template <typename value_type>
+amplapack_status do_geqrf_async(int m, int n, value_type* a, int lda, value_type* tau, amplapack_async* token, int& info)
+{
+    std::function<void(amplapack::context&, amplapack::async_call&)> f = make_geqrf_async(m, n, a, lda, tau);
+
+    // the token owns the context of the call
+    return amplapack::safe_call_interface(f, token, info);
+}
+
+template <typename value_type>
+amplapack_status do_geqrf_async(amplapack_handle handle, int m, int n, value_type* a, int lda, value_type* tau, amplapack_async* token, int& info)
+{
+    std::function<void(amplapack::context&, amplapack::async_call&)> f = make_geqrf_async(m, n, a, lda, tau);
+
+    // queue on the handle's context
+    return amplapack::safe_call_interface(f, handle, token, info);
+}
+
+// the reflectors stay on the accelerator; only tau is moved to the host
+template <typename value_type>
+void geqrf_matrix(amplapack::context& ctx, amplapack_matrix a, value_type* tau)
+{
+    using amplapack::block_factor_location;
+    using amplapack::execution_target;
+    using amplapack::ordering;
+
+    concurrency::array_view<value_type,2> view_a = amplapack::get_matrix_view<value_type>(ctx, a, 1);
+
+    // error checking
+    if (tau == nullptr)
+        amplapack::argument_error(2);
+
+    const int k = std::min(a->m, a->n);
+    concurrency::array_view<value_type,1> view_tau(k, tau);
+
+    // the matrix is already on the accelerator, so the crossovers only place the panel factorization
+    if (amplapack::select_target(amplapack_geqrf_routine, amplapack::precision_of<value_type>(), k) == execution_target::accelerator)
+        amplapack::geqrf<ordering::column_major, block_factor_location::accelerator>(ctx, view_a, view_tau);
+    else
+        amplapack::geqrf<ordering::column_major, block_factor_location::host>(ctx, view_a, view_tau);
+}
+
+// accelerator copy of the first k entries of tau (drawn from the context's pool)
+template <typename value_type>
+concurrency::array_view<value_type,1> upload_tau(amplapack::context& ctx, amplapack::pooled_array<value_type>& accl_tau, int k, const value_type* tau)
+{
+    concurrency::array_view<value_type,1> accl_view_tau = accl_tau.get_view()[0];
+
+    if (k > 0)
+    {
+        concurrency::copy(concurrency::array_view<const value_type,1>(k, tau), accl_view_tau.section(0,k));
+        ctx.get_transfers().add_to_accelerator(amplapack::get_bytes<value_type>(concurrency::extent<2>(1,k)));
+    }
+
+    return accl_view_tau;
+}
+
+// this is a work around until VS std::bind can accept more paramaters
+template <typename value_type>
+struct ormqr_matrix_params
+{
+    char side;
+    char trans;
+    int k;
+    amplapack_matrix a;
+    const value_type* tau;
+    amplapack_matrix c;
+
+    ormqr_matrix_params(char side, char trans, int k, amplapack_matrix a, const value_type* tau, amplapack_matrix c)
+        : side(side), trans(trans), k(k), a(a), tau(tau), c(c)
+    {}
+};
+
+template <typename value_type>
+void ormqr_matrix(amplapack::context& ctx, const ormqr_matrix_params<value_type>& p)
+{
+    using amplapack::argument_error;
+
+    const bool complex_type = (amplapack::precision_of<value_type>() == 'C' || amplapack::precision_of<value_type>() == 'Z');
+
+    // error checking
+    const char side = static_cast<char>(toupper(p.side));
+    const char trans = static_cast<char>(toupper(p.trans));
+
+    if (side != 'L' && side != 'R')
+        argument_error(1);
+    if (trans != 'N' && trans != 'C' && (trans != 'T' || complex_type))
+        argument_error(2);
+
+    concurrency::array_view<value_type,2> view_a = amplapack::get_matrix_view<value_type>(ctx, p.a, 4);
+    concurrency::array_view<value_type,2> view_c = amplapack::get_matrix_view<value_type>(ctx, p.c, 6);
+
+    const int nq = (side == 'L' ? p.c->m : p.c->n);
+
+    if (p.k < 0 || p.k > nq || p.k > p.a->n)
+        argument_error(3);
+    if (p.a->m != nq)
+        argument_error(4);
+
+    // quick return
+    if (p.k == 0)
+        return;
+
+    if (p.tau == nullptr)
+        argument_error(5);
+
+    amplapack::pooled_array<value_type> accl_tau(ctx.get_pool(), concurrency::extent<2>(1,p.k));
+    concurrency::array_view<value_type,1> accl_view_tau = upload_tau(ctx, accl_tau, p.k, p.tau);
+
+    amplapack::ormqr<amplapack::ordering::column_major>(ctx, (side == 'L' ? amplapack::side::left : amplapack::side::right), amplapack::to_transpose_option(trans), view_a.section(concurrency::index<2>(0,0), concurrency::extent<2>(p.k,nq)), accl_view_tau, view_c);
+}
+
+template <typename value_type>
+void orgqr_matrix(amplapack::context& ctx, int k, amplapack_matrix a, const value_type* tau)
+{
+    concurrency::array_view<value_type,2> view_a = amplapack::get_matrix_view<value_type>(ctx, a, 2);
+
+    // error checking
+    if (a->n > a->m)
+        amplapack::argument_error(2);
+    if (k < 0 || k > a->n)
+        amplapack::argument_error(1);
+    if (tau == nullptr && k > 0)
+        amplapack::argument_error(3);
+
+    amplapack::pooled_array<value_type> accl_tau(ctx.get_pool(), concurrency::extent<2>(1,std::max(k,1)));
+    concurrency::array_view<value_type,1> accl_view_tau = upload_tau(ctx, accl_tau, k, tau);
+
+    amplapack::orgqr<amplapack::ordering::column_major>(ctx, k, view_a, accl_view_tau);
+}
+
+template <typename value_type>
+amplapack_status do_geqrf_matrix(amplapack_matrix a, value_type* tau, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(geqrf_matrix<value_type>, std::placeholders::_1, a, tau);
+
+    // execute using the context of the matrix's handle
+    return amplapack::safe_call_interface(f, a, 1, info);
+}
+
+template <typename value_type>
+amplapack_status do_ormqr_matrix(char side, char trans, int k, amplapack_matrix a, const value_type* tau, amplapack_matrix c, int& info)
+{
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    ormqr_matrix_params<value_type> params(side, trans, k, a, tau, c);
+    std::function<void(amplapack::context&)> f = std::bind(ormqr_matrix<value_type>, std::placeholders::_1, params);
+
+    // execute using the context of the matrix's handle
+    return amplapack::safe_call_interface(f, a, 4, info);
+}
+
+template <typename value_type>
+amplapack_status do_orgqr_matrix(int k, amplapack_matrix a, const value_type* tau, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(orgqr_matrix<value_type>, std::placeholders::_1, k, a, tau);
+
+    // execute using the context of the matrix's handle
+    return amplapack::safe_call_interface(f, a, 2, info);
+}
+
+// a never leaves the host as a whole; the slabs are sized by workspace rather than by the 
+// crossovers
+template <typename value_type>
+std::function<void(amplapack::context&)> make_geqrf_ooc(int m, int n, value_type* a, int lda, value_type* tau, size_t workspace)
+{
+    // create interface functor
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::geqrf_ooc_params<value_type> params(m, n, a, lda, tau, workspace);
+    return std::bind(amplapack::_detail::geqrf_ooc_unpack<value_type>, std::placeholders::_1, params);
+}
+
+template <typename value_type>
+amplapack_status do_geqrf_ooc(int m, int n, value_type* a, int lda, value_type* tau, size_t workspace, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_geqrf_ooc(m, n, a, lda, tau, workspace);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_geqrf_ooc(amplapack_handle handle, int m, int n, value_type* a, int lda, value_type* tau, size_t workspace, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_geqrf_ooc(m, n, a, lda, tau, workspace);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+} // namespace _detail
+
+extern "C" {
+
+amplapack_status amplapack_sgeqrf(int m, int n, float* a, int lda, float* tau, int* info)
+{
+    return _detail::do_geqrf(m, n, a, lda, tau, *info); 
+}
+
+amplapack_status amplapack_dgeqrf(int m, int n, double* a, int lda, double* tau, int* info)
+{
+    return _detail::do_geqrf(m, n, a, lda, tau, *info); 
+}
+
+amplapack_status amplapack_cgeqrf(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, int* info)
+{
+    return _detail::do_geqrf(m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_zgeqrf(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, int* info)
+{
+    return _detail::do_geqrf(m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_sgeqrf_h(amplapack_handle handle, int m, int n, float* a, int lda, float* tau, int* info)
+{
+    return _detail::do_geqrf(handle, m, n, a, lda, tau, *info); 
+}
+
+amplapack_status amplapack_dgeqrf_h(amplapack_handle handle, int m, int n, double* a, int lda, double* tau, int* info)
+{
+    return _detail::do_geqrf(handle, m, n, a, lda, tau, *info); 
+}
+
+amplapack_status amplapack_cgeqrf_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, int* info)
+{
+    return _detail::do_geqrf(handle, m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_zgeqrf_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, int* info)
+{
+    return _detail::do_geqrf(handle, m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_sormqr(char side, char trans, int m, int n, int k, const float* a, int lda, const float* tau, float* c, int ldc, int* info)
+{
+    return _detail::do_ormqr(side, trans, m, n, k, a, lda, tau, c, ldc, *info); 
+}
+
+amplapack_status amplapack_dormqr(char side, char trans, int m, int n, int k, const double* a, int lda, const double* tau, double* c, int ldc, int* info)
+{
+    return _detail::do_ormqr(side, trans, m, n, k, a, lda, tau, c, ldc, *info); 
+}
+
+amplapack_status amplapack_cunmqr(char side, char trans, int m, int n, int k, const amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, amplapack_fcomplex* c, int ldc, int* info)
+{
+    return _detail::do_ormqr(side, trans, m, n, k, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), amplapack::amplapack_cast(c), ldc, *info); 
+}
+
+amplapack_status amplapack_zunmqr(char side, char trans, int m, int n, int k, const amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, amplapack_dcomplex* c, int ldc, int* info)
+{
+    return _detail::do_ormqr(side, trans, m, n, k, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), amplapack::amplapack_cast(c), ldc, *info); 
+}
+
+amplapack_status amplapack_sormqr_h(amplapack_handle handle, char side, char trans, int m, int n, int k, const float* a, int lda, const float* tau, float* c, int ldc, int* info)
+{
+    return _detail::do_ormqr(handle, side, trans, m, n, k, a, lda, tau, c, ldc, *info); 
+}
+
+amplapack_status amplapack_dormqr_h(amplapack_handle handle, char side, char trans, int m, int n, int k, const double* a, int lda, const double* tau, double* c, int ldc, int* info)
+{
+    return _detail::do_ormqr(handle, side, trans, m, n, k, a, lda, tau, c, ldc, *info); 
+}
+
+amplapack_status amplapack_cunmqr_h(amplapack_handle handle, char side, char trans, int m, int n, int k, const amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, amplapack_fcomplex* c, int ldc, int* info)
+{
+    return _detail::do_ormqr(handle, side, trans, m, n, k, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), amplapack::amplapack_cast(c), ldc, *info); 
+}
+
+amplapack_status amplapack_zunmqr_h(amplapack_handle handle, char side, char trans, int m, int n, int k, const amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, amplapack_dcomplex* c, int ldc, int* info)
+{
+    return _detail::do_ormqr(handle, side, trans, m, n, k, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), amplapack::amplapack_cast(c), ldc, *info); 
+}
+
+amplapack_status amplapack_sorgqr(int m, int n, int k, float* a, int lda, const float* tau, int* info)
+{
+    return _detail::do_orgqr(m, n, k, a, lda, tau, *info); 
+}
+
+amplapack_status amplapack_dorgqr(int m, int n, int k, double* a, int lda, const double* tau, int* info)
+{
+    return _detail::do_orgqr(m, n, k, a, lda, tau, *info); 
+}
+
+amplapack_status amplapack_cungqr(int m, int n, int k, amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, int* info)
+{
+    return _detail::do_orgqr(m, n, k, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_zungqr(int m, int n, int k, amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, int* info)
+{
+    return _detail::do_orgqr(m, n, k, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_sorgqr_h(amplapack_handle handle, int m, int n, int k, float* a, int lda, const float* tau, int* info)
+{
+    return _detail::do_orgqr(handle, m, n, k, a, lda, tau, *info); 
+}
+
+amplapack_status amplapack_dorgqr_h(amplapack_handle handle, int m, int n, int k, double* a, int lda, const double* tau, int* info)
+{
+    return _detail::do_orgqr(handle, m, n, k, a, lda, tau, *info); 
+}
+
+amplapack_status amplapack_cungqr_h(amplapack_handle handle, int m, int n, int k, amplapack_fcomplex* a, int lda, const amplapack_fcomplex* tau, int* info)
+{
+    return _detail::do_orgqr(handle, m, n, k, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_zungqr_h(amplapack_handle handle, int m, int n, int k, amplapack_dcomplex* a, int lda, const amplapack_dcomplex* tau, int* info)
+{
+    return _detail::do_orgqr(handle, m, n, k, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_sgeqrf_workspace(int m, int n, size_t* size)
+{
+    return _detail::do_geqrf_workspace<float>(m, n, size);
+}
+
+amplapack_status amplapack_dgeqrf_workspace(int m, int n, size_t* size)
+{
+    return _detail::do_geqrf_workspace<double>(m, n, size);
+}
+
+amplapack_status amplapack_cgeqrf_workspace(int m, int n, size_t* size)
+{
+    return _detail::do_geqrf_workspace<ampblas::complex<float>>(m, n, size);
+}
+
+amplapack_status amplapack_zgeqrf_workspace(int m, int n, size_t* size)
+{
+    return _detail::do_geqrf_workspace<ampblas::complex<double>>(m, n, size);
+}
+
+amplapack_status amplapack_sgeqrf_async(int m, int n, float* a, int lda, float* tau, amplapack_async* token, int* info)
+{
+    return _detail::do_geqrf_async(m, n, a, lda, tau, token, *info); 
+}
+
+amplapack_status amplapack_dgeqrf_async(int m, int n, double* a, int lda, double* tau, amplapack_async* token, int* info)
+{
+    return _detail::do_geqrf_async(m, n, a, lda, tau, token, *info); 
+}
+
+amplapack_status amplapack_cgeqrf_async(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, amplapack_async* token, int* info)
+{
+    return _detail::do_geqrf_async(m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), token, *info); 
+}
+
+amplapack_status amplapack_zgeqrf_async(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, amplapack_async* token, int* info)
+{
+    return _detail::do_geqrf_async(m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), token, *info); 
+}
+
+amplapack_status amplapack_sgeqrf_async_h(amplapack_handle handle, int m, int n, float* a, int lda, float* tau, amplapack_async* token, int* info)
+{
+    return _detail::do_geqrf_async(handle, m, n, a, lda, tau, token, *info); 
+}
+
+amplapack_status amplapack_dgeqrf_async_h(amplapack_handle handle, int m, int n, double* a, int lda, double* tau, amplapack_async* token, int* info)
+{
+    return _detail::do_geqrf_async(handle, m, n, a, lda, tau, token, *info); 
+}
+
+amplapack_status amplapack_cgeqrf_async_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, amplapack_async* token, int* info)
+{
+    return _detail::do_geqrf_async(handle, m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), token, *info); 
+}
+
+amplapack_status amplapack_zgeqrf_async_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, amplapack_async* token, int* info)
+{
+    return _detail::do_geqrf_async(handle, m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), token, *info); 
+}
+
+amplapack_status amplapack_sgeqrf_m(amplapack_matrix a, float* tau, int* info)
+{
+    return _detail::do_geqrf_matrix(a, tau, *info); 
+}
+
+amplapack_status amplapack_dgeqrf_m(amplapack_matrix a, double* tau, int* info)
+{
+    return _detail::do_geqrf_matrix(a, tau, *info); 
+}
+
+amplapack_status amplapack_cgeqrf_m(amplapack_matrix a, amplapack_fcomplex* tau, int* info)
+{
+    return _detail::do_geqrf_matrix(a, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_zgeqrf_m(amplapack_matrix a, amplapack_dcomplex* tau, int* info)
+{
+    return _detail::do_geqrf_matrix(a, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_sormqr_m(char side, char trans, int k, amplapack_matrix a, const float* tau, amplapack_matrix c, int* info)
+{
+    return _detail::do_ormqr_matrix(side, trans, k, a, tau, c, *info); 
+}
+
+amplapack_status amplapack_dormqr_m(char side, char trans, int k, amplapack_matrix a, const double* tau, amplapack_matrix c, int* info)
+{
+    return _detail::do_ormqr_matrix(side, trans, k, a, tau, c, *info); 
+}
+
+amplapack_status amplapack_cunmqr_m(char side, char trans, int k, amplapack_matrix a, const amplapack_fcomplex* tau, amplapack_matrix c, int* info)
+{
+    return _detail::do_ormqr_matrix(side, trans, k, a, amplapack::amplapack_cast(tau), c, *info); 
+}
+
+amplapack_status amplapack_zunmqr_m(char side, char trans, int k, amplapack_matrix a, const amplapack_dcomplex* tau, amplapack_matrix c, int* info)
+{
+    return _detail::do_ormqr_matrix(side, trans, k, a, amplapack::amplapack_cast(tau), c, *info); 
+}
+
+amplapack_status amplapack_sorgqr_m(int k, amplapack_matrix a, const float* tau, int* info)
+{
+    return _detail::do_orgqr_matrix(k, a, tau, *info); 
+}
+
+amplapack_status amplapack_dorgqr_m(int k, amplapack_matrix a, const double* tau, int* info)
+{
+    return _detail::do_orgqr_matrix(k, a, tau, *info); 
+}
+
+amplapack_status amplapack_cungqr_m(int k, amplapack_matrix a, const amplapack_fcomplex* tau, int* info)
+{
+    return _detail::do_orgqr_matrix(k, a, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_zungqr_m(int k, amplapack_matrix a, const amplapack_dcomplex* tau, int* info)
+{
+    return _detail::do_orgqr_matrix(k, a, amplapack::amplapack_cast(tau), *info); 
+}
+
+amplapack_status amplapack_sgeqrf_ooc(int m, int n, float* a, int lda, float* tau, size_t workspace, int* info)
+{
+    return _detail::do_geqrf_ooc(m, n, a, lda, tau, workspace, *info); 
+}
+
+amplapack_status amplapack_dgeqrf_ooc(int m, int n, double* a, int lda, double* tau, size_t workspace, int* info)
+{
+    return _detail::do_geqrf_ooc(m, n, a, lda, tau, workspace, *info); 
+}
+
+amplapack_status amplapack_cgeqrf_ooc(int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, size_t workspace, int* info)
+{
+    return _detail::do_geqrf_ooc(m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), workspace, *info); 
+}
+
+amplapack_status amplapack_zgeqrf_ooc(int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, size_t workspace, int* info)
+{
+    return _detail::do_geqrf_ooc(m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), workspace, *info); 
+}
+
+amplapack_status amplapack_sgeqrf_ooc_h(amplapack_handle handle, int m, int n, float* a, int lda, float* tau, size_t workspace, int* info)
+{
+    return _detail::do_geqrf_ooc(handle, m, n, a, lda, tau, workspace, *info); 
+}
+
+amplapack_status amplapack_dgeqrf_ooc_h(amplapack_handle handle, int m, int n, double* a, int lda, double* tau, size_t workspace, int* info)
+{
+    return _detail::do_geqrf_ooc(handle, m, n, a, lda, tau, workspace, *info); 
+}
+
+amplapack_status amplapack_cgeqrf_ooc_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, amplapack_fcomplex* tau, size_t workspace, int* info)
+{
+    return _detail::do_geqrf_ooc(handle, m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), workspace, *info); 
+}
+
+amplapack_status amplapack_zgeqrf_ooc_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, amplapack_dcomplex* tau, size_t workspace, int* info)
+{
+    return _detail::do_geqrf_ooc(handle, m, n, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(tau), workspace, *info); 
+}
+
+} // extern "C"
@@ -1,68 +1,551 @@
-/*----------------------------------------------------------------------------
- * Copyright  Microsoft Corp.
- *
- * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
- * use this file except in compliance with the License.  You may obtain a copy 
- * of the License at http://www.apache.org/licenses/LICENSE-2.0  
- * 
- * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
- * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
- * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
- * MERCHANTABLITY OR NON-INFRINGEMENT. 
- *
- * See the Apache Version 2.0 License for specific language governing 
- * permissions and limitations under the License.
- *---------------------------------------------------------------------------
- * 
- * getrf.cpp
- *
- *---------------------------------------------------------------------------*/
-
-#include <functional>
-
-#include <amp.h>
-
-#include "ampclapack.h"      
-#include "amplapack_runtime.h"
-
-#include "detail\getrf.h"    
-
-namespace _detail {
-
-template <typename value_type>
-amplapack_status do_getrf(int m, int n, value_type* a, int lda, int* ipiv, int& info)
-{
-    // create interface functor
-    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
-    // std::function<void(concurrency::accelerator_view&)> f = std::bind(amplapack::_detail::getrf<value_type>, std::placeholders::_1, m, n, a, lda, ipiv);
-    std::function<void(concurrency::accelerator_view&)> f = std::bind(amplapack::_detail::getrf_unpack<value_type>, std::placeholders::_1, amplapack::_detail::getrf_params<value_type>(m, n, a, lda, ipiv));
-
-    // execute using interface
-    return amplapack::safe_call_interface(f, info);
-}
-
-} // namespace _detail
-
-extern "C" {
-
-amplapack_status amplapack_sgetrf(int m, int n, float* a, int lda, int* ipiv, int* info)
-{
-    return _detail::do_getrf(m, n, a, lda, ipiv, *info); 
-}
-
-amplapack_status amplapack_dgetrf(int m, int n, double* a, int lda, int* ipiv, int* info)
-{
-    return _detail::do_getrf(m, n, a, lda, ipiv, *info); 
-}
-
-amplapack_status amplapack_cgetrf(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, int* info)
-{
-    return _detail::do_getrf(m, n, amplapack::amplapack_cast(a), lda, ipiv, *info); 
-}
-
-amplapack_status amplapack_zgetrf(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, int* info)
-{
-    return _detail::do_getrf(m, n, amplapack::amplapack_cast(a), lda, ipiv, *info); 
-}
-
-} // extern "C"
\ No newline at end of file
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * getrf.cpp
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <functional>
+
+#include <amp.h>
+
+#include "ampclapack.h"      
+#include "amplapack_runtime.h"
+
+#include "detail\getrf.h"
+#include "detail\out_of_core.h"
+
+namespace _detail {
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_getrf(int m, int n, value_type* a, int lda, int* ipiv)
+{
+    using amplapack::execution_target;
+
+    // create interface functor
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    // std::function<void(amplapack::context&)> f = std::bind(amplapack::_detail::getrf<value_type>, std::placeholders::_1, m, n, a, lda, ipiv);
+    amplapack::_detail::getrf_params<value_type> params(m, n, a, lda, ipiv);
+
+    // run where the problem size is best served
+    switch (amplapack::select_target(amplapack_getrf_routine, amplapack::precision_of<value_type>(), std::min(m,n)))
+    {
+    case execution_target::host:
+        return std::bind(amplapack::_detail::getrf_unpack<execution_target::host, value_type>, std::placeholders::_1, params);
+    case execution_target::accelerator:
+        return std::bind(amplapack::_detail::getrf_unpack<execution_target::accelerator, value_type>, std::placeholders::_1, params);
+    case execution_target::hybrid:
+    default:
+        return std::bind(amplapack::_detail::getrf_unpack<execution_target::hybrid, value_type>, std::placeholders::_1, params);
+    }
+}
+
+template <typename value_type>
+amplapack_status do_getrf(int m, int n, value_type* a, int lda, int* ipiv, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_getrf(m, n, a, lda, ipiv);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_getrf(amplapack_handle handle, int m, int n, value_type* a, int lda, int* ipiv, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_getrf(m, n, a, lda, ipiv);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+// the getrf crossovers are used for both; a solve alone runs on the accelerator unless the
+// factorization of its matrix would not
+template <typename value_type>
+std::function<void(amplapack::context&)> make_getrs(char trans, int n, int nrhs, const value_type* a, int lda, const int* ipiv, value_type* b, int ldb)
+{
+    using amplapack::execution_target;
+
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::getrs_params<value_type> params(trans, n, nrhs, a, lda, ipiv, b, ldb);
+
+    if (amplapack::select_target(amplapack_getrf_routine, amplapack::precision_of<value_type>(), n) == execution_target::host)
+        return std::bind(amplapack::_detail::getrs_unpack<execution_target::host, value_type>, std::placeholders::_1, params);
+    else
+        return std::bind(amplapack::_detail::getrs_unpack<execution_target::hybrid, value_type>, std::placeholders::_1, params);
+}
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_gesv(int n, int nrhs, value_type* a, int lda, int* ipiv, value_type* b, int ldb)
+{
+    using amplapack::execution_target;
+
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::gesv_params<value_type> params(n, nrhs, a, lda, ipiv, b, ldb);
+
+    switch (amplapack::select_target(amplapack_getrf_routine, amplapack::precision_of<value_type>(), n))
+    {
+    case execution_target::host:
+        return std::bind(amplapack::_detail::gesv_unpack<execution_target::host, value_type>, std::placeholders::_1, params);
+    case execution_target::accelerator:
+        return std::bind(amplapack::_detail::gesv_unpack<execution_target::accelerator, value_type>, std::placeholders::_1, params);
+    case execution_target::hybrid:
+    default:
+        return std::bind(amplapack::_detail::gesv_unpack<execution_target::hybrid, value_type>, std::placeholders::_1, params);
+    }
+}
+
+template <typename value_type>
+amplapack_status do_getrs(char trans, int n, int nrhs, const value_type* a, int lda, const int* ipiv, value_type* b, int ldb, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_getrs(trans, n, nrhs, a, lda, ipiv, b, ldb);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_getrs(amplapack_handle handle, char trans, int n, int nrhs, const value_type* a, int lda, const int* ipiv, value_type* b, int ldb, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_getrs(trans, n, nrhs, a, lda, ipiv, b, ldb);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+amplapack_status do_gesv(int n, int nrhs, value_type* a, int lda, int* ipiv, value_type* b, int ldb, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_gesv(n, nrhs, a, lda, ipiv, b, ldb);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_gesv(amplapack_handle handle, int n, int nrhs, value_type* a, int lda, int* ipiv, value_type* b, int ldb, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_gesv(n, nrhs, a, lda, ipiv, b, ldb);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+amplapack_status do_getrf_workspace(int m, int n, size_t* size)
+{
+    if (m < 0 || n < 0 || size == nullptr)
+        return amplapack_argument_error;
+
+    *size = amplapack::getrf_workspace<value_type>(m, n);
+    return amplapack_success;
+}
+
+// the asynchronous variant never returns to the host between panels, so it runs on the 
+// accelerator unless the problem is small enough for the host
+template <typename value_type>
+std::function<void(amplapack::context&, amplapack::async_call&)> make_getrf_async(int m, int n, value_type* a, int lda, int* ipiv)
+{
+    using amplapack::execution_target;
+
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::getrf_params<value_type> params(m, n, a, lda, ipiv);
+
+    if (amplapack::select_target(amplapack_getrf_routine, amplapack::precision_of<value_type>(), std::min(m,n)) == execution_target::host)
+        return std::bind(amplapack::_detail::getrf_async_unpack<execution_target::host, value_type>, std::placeholders::_1, std::placeholders::_2, params);
+    else
+        return std::bind(amplapack::_detail::getrf_async_unpack<execution_target::accelerator, value_type>, std::placeholders::_1, std::placeholders::_2, params);
+}
+
+template <typename value_type>
+amplapack_status do_getrf_async(int m, int n, value_type* a, int lda, int* ipiv, amplapack_async* token, int& info)
+{
+    std::function<void(amplapack::context&, amplapack::async_call&)> f = make_getrf_async(m, n, a, lda, ipiv);
+
+    // the token owns the context of the call
+    return amplapack::safe_call_interface(f, token, info);
+}
+
+template <typename value_type>
+amplapack_status do_getrf_async(amplapack_handle handle, int m, int n, value_type* a, int lda, int* ipiv, amplapack_async* token, int& info)
+{
+    std::function<void(amplapack::context&, amplapack::async_call&)> f = make_getrf_async(m, n, a, lda, ipiv);
+
+    // queue on the handle's context
+    return amplapack::safe_call_interface(f, handle, token, info);
+}
+
+// the factors stay on the accelerator; only the pivots are moved to the host
+template <typename value_type>
+void getrf_matrix(amplapack::context& ctx, amplapack_matrix a, int* ipiv)
+{
+    using amplapack::block_factor_location;
+    using amplapack::execution_target;
+    using amplapack::ordering;
+
+    concurrency::array_view<value_type,2> view_a = amplapack::get_matrix_view<value_type>(ctx, a, 1);
+
+    // error checking
+    if (ipiv == nullptr)
+        amplapack::argument_error(2);
+
+    const int k = std::min(a->m, a->n);
+    concurrency::array_view<int,1> view_ipiv(k, ipiv);
+
+    // the matrix is already on the accelerator, so the crossovers only place the panel factorization
+    if (amplapack::select_target(amplapack_getrf_routine, amplapack::precision_of<value_type>(), k) == execution_target::accelerator)
+        amplapack::getrf<ordering::column_major, block_factor_location::accelerator>(ctx, view_a, view_ipiv);
+    else
+        amplapack::getrf<ordering::column_major, block_factor_location::host>(ctx, view_a, view_ipiv);
+}
+
+template <typename value_type>
+void getrs_matrix(amplapack::context& ctx, char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b)
+{
+    // error checking
+    trans = static_cast<char>(toupper(trans));
+
+    if (trans != 'N' && trans != 'T' && trans != 'C')
+        amplapack::argument_error(1);
+
+    concurrency::array_view<value_type,2> view_a = amplapack::get_matrix_view<value_type>(ctx, a, 2);
+
+    if (a->m != a->n)
+        amplapack::argument_error(2);
+    if (ipiv == nullptr)
+        amplapack::argument_error(3);
+
+    concurrency::array_view<value_type,2> view_b = amplapack::get_matrix_view<value_type>(ctx, b, 4);
+
+    if (b->m != a->n)
+        amplapack::argument_error(4);
+
+    concurrency::array_view<const int,1> view_ipiv(a->n, ipiv);
+
+    amplapack::getrs<amplapack::ordering::column_major, value_type>(ctx, amplapack::to_transpose_option(trans), view_a, view_ipiv, view_b);
+}
+
+template <typename value_type>
+amplapack_status do_getrf_matrix(amplapack_matrix a, int* ipiv, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(getrf_matrix<value_type>, std::placeholders::_1, a, ipiv);
+
+    // execute using the context of the matrix's handle
+    return amplapack::safe_call_interface(f, a, 1, info);
+}
+
+template <typename value_type>
+amplapack_status do_getrs_matrix(char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(getrs_matrix<value_type>, std::placeholders::_1, trans, a, ipiv, b);
+
+    // execute using the context of the matrix's handle
+    return amplapack::safe_call_interface(f, a, 2, info);
+}
+
+// a never leaves the host as a whole; the slabs are sized by workspace rather than by the 
+// crossovers
+template <typename value_type>
+std::function<void(amplapack::context&)> make_getrf_ooc(int m, int n, value_type* a, int lda, int* ipiv, size_t workspace)
+{
+    // create interface functor
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::getrf_ooc_params<value_type> params(m, n, a, lda, ipiv, workspace);
+    return std::bind(amplapack::_detail::getrf_ooc_unpack<value_type>, std::placeholders::_1, params);
+}
+
+template <typename value_type>
+amplapack_status do_getrf_ooc(int m, int n, value_type* a, int lda, int* ipiv, size_t workspace, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_getrf_ooc(m, n, a, lda, ipiv, workspace);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_getrf_ooc(amplapack_handle handle, int m, int n, value_type* a, int lda, int* ipiv, size_t workspace, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_getrf_ooc(m, n, a, lda, ipiv, workspace);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+} // namespace _detail
+
+extern "C" {
+
+amplapack_status amplapack_sgetrf(int m, int n, float* a, int lda, int* ipiv, int* info)
+{
+    return _detail::do_getrf(m, n, a, lda, ipiv, *info); 
+}
+
+amplapack_status amplapack_dgetrf(int m, int n, double* a, int lda, int* ipiv, int* info)
+{
+    return _detail::do_getrf(m, n, a, lda, ipiv, *info); 
+}
+
+amplapack_status amplapack_cgetrf(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, int* info)
+{
+    return _detail::do_getrf(m, n, amplapack::amplapack_cast(a), lda, ipiv, *info); 
+}
+
+amplapack_status amplapack_zgetrf(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, int* info)
+{
+    return _detail::do_getrf(m, n, amplapack::amplapack_cast(a), lda, ipiv, *info); 
+}
+
+amplapack_status amplapack_sgetrf_h(amplapack_handle handle, int m, int n, float* a, int lda, int* ipiv, int* info)
+{
+    return _detail::do_getrf(handle, m, n, a, lda, ipiv, *info); 
+}
+
+amplapack_status amplapack_dgetrf_h(amplapack_handle handle, int m, int n, double* a, int lda, int* ipiv, int* info)
+{
+    return _detail::do_getrf(handle, m, n, a, lda, ipiv, *info); 
+}
+
+amplapack_status amplapack_cgetrf_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, int* info)
+{
+    return _detail::do_getrf(handle, m, n, amplapack::amplapack_cast(a), lda, ipiv, *info); 
+}
+
+amplapack_status amplapack_zgetrf_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, int* info)
+{
+    return _detail::do_getrf(handle, m, n, amplapack::amplapack_cast(a), lda, ipiv, *info); 
+}
+
+amplapack_status amplapack_sgetrs(char trans, int n, int nrhs, const float* a, int lda, const int* ipiv, float* b, int ldb, int* info)
+{
+    return _detail::do_getrs(trans, n, nrhs, a, lda, ipiv, b, ldb, *info); 
+}
+
+amplapack_status amplapack_dgetrs(char trans, int n, int nrhs, const double* a, int lda, const int* ipiv, double* b, int ldb, int* info)
+{
+    return _detail::do_getrs(trans, n, nrhs, a, lda, ipiv, b, ldb, *info); 
+}
+
+amplapack_status amplapack_cgetrs(char trans, int n, int nrhs, const amplapack_fcomplex* a, int lda, const int* ipiv, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return _detail::do_getrs(trans, n, nrhs, amplapack::amplapack_cast(a), lda, ipiv, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_zgetrs(char trans, int n, int nrhs, const amplapack_dcomplex* a, int lda, const int* ipiv, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return _detail::do_getrs(trans, n, nrhs, amplapack::amplapack_cast(a), lda, ipiv, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_sgetrs_h(amplapack_handle handle, char trans, int n, int nrhs, const float* a, int lda, const int* ipiv, float* b, int ldb, int* info)
+{
+    return _detail::do_getrs(handle, trans, n, nrhs, a, lda, ipiv, b, ldb, *info); 
+}
+
+amplapack_status amplapack_dgetrs_h(amplapack_handle handle, char trans, int n, int nrhs, const double* a, int lda, const int* ipiv, double* b, int ldb, int* info)
+{
+    return _detail::do_getrs(handle, trans, n, nrhs, a, lda, ipiv, b, ldb, *info); 
+}
+
+amplapack_status amplapack_cgetrs_h(amplapack_handle handle, char trans, int n, int nrhs, const amplapack_fcomplex* a, int lda, const int* ipiv, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return _detail::do_getrs(handle, trans, n, nrhs, amplapack::amplapack_cast(a), lda, ipiv, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_zgetrs_h(amplapack_handle handle, char trans, int n, int nrhs, const amplapack_dcomplex* a, int lda, const int* ipiv, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return _detail::do_getrs(handle, trans, n, nrhs, amplapack::amplapack_cast(a), lda, ipiv, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_sgesv(int n, int nrhs, float* a, int lda, int* ipiv, float* b, int ldb, int* info)
+{
+    return _detail::do_gesv(n, nrhs, a, lda, ipiv, b, ldb, *info); 
+}
+
+amplapack_status amplapack_dgesv(int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, int* info)
+{
+    return _detail::do_gesv(n, nrhs, a, lda, ipiv, b, ldb, *info); 
+}
+
+amplapack_status amplapack_cgesv(int n, int nrhs, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return _detail::do_gesv(n, nrhs, amplapack::amplapack_cast(a), lda, ipiv, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_zgesv(int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return _detail::do_gesv(n, nrhs, amplapack::amplapack_cast(a), lda, ipiv, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_sgesv_h(amplapack_handle handle, int n, int nrhs, float* a, int lda, int* ipiv, float* b, int ldb, int* info)
+{
+    return _detail::do_gesv(handle, n, nrhs, a, lda, ipiv, b, ldb, *info); 
+}
+
+amplapack_status amplapack_dgesv_h(amplapack_handle handle, int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, int* info)
+{
+    return _detail::do_gesv(handle, n, nrhs, a, lda, ipiv, b, ldb, *info); 
+}
+
+amplapack_status amplapack_cgesv_h(amplapack_handle handle, int n, int nrhs, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return _detail::do_gesv(handle, n, nrhs, amplapack::amplapack_cast(a), lda, ipiv, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_zgesv_h(amplapack_handle handle, int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return _detail::do_gesv(handle, n, nrhs, amplapack::amplapack_cast(a), lda, ipiv, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_sgetrf_workspace(int m, int n, size_t* size)
+{
+    return _detail::do_getrf_workspace<float>(m, n, size);
+}
+
+amplapack_status amplapack_dgetrf_workspace(int m, int n, size_t* size)
+{
+    return _detail::do_getrf_workspace<double>(m, n, size);
+}
+
+amplapack_status amplapack_cgetrf_workspace(int m, int n, size_t* size)
+{
+    return _detail::do_getrf_workspace<ampblas::complex<float>>(m, n, size);
+}
+
+amplapack_status amplapack_zgetrf_workspace(int m, int n, size_t* size)
+{
+    return _detail::do_getrf_workspace<ampblas::complex<double>>(m, n, size);
+}
+
+amplapack_status amplapack_sgetrf_async(int m, int n, float* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return _detail::do_getrf_async(m, n, a, lda, ipiv, token, *info); 
+}
+
+amplapack_status amplapack_dgetrf_async(int m, int n, double* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return _detail::do_getrf_async(m, n, a, lda, ipiv, token, *info); 
+}
+
+amplapack_status amplapack_cgetrf_async(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return _detail::do_getrf_async(m, n, amplapack::amplapack_cast(a), lda, ipiv, token, *info); 
+}
+
+amplapack_status amplapack_zgetrf_async(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return _detail::do_getrf_async(m, n, amplapack::amplapack_cast(a), lda, ipiv, token, *info); 
+}
+
+amplapack_status amplapack_sgetrf_async_h(amplapack_handle handle, int m, int n, float* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return _detail::do_getrf_async(handle, m, n, a, lda, ipiv, token, *info); 
+}
+
+amplapack_status amplapack_dgetrf_async_h(amplapack_handle handle, int m, int n, double* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return _detail::do_getrf_async(handle, m, n, a, lda, ipiv, token, *info); 
+}
+
+amplapack_status amplapack_cgetrf_async_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return _detail::do_getrf_async(handle, m, n, amplapack::amplapack_cast(a), lda, ipiv, token, *info); 
+}
+
+amplapack_status amplapack_zgetrf_async_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_async* token, int* info)
+{
+    return _detail::do_getrf_async(handle, m, n, amplapack::amplapack_cast(a), lda, ipiv, token, *info); 
+}
+
+amplapack_status amplapack_sgetrf_m(amplapack_matrix a, int* ipiv, int* info)
+{
+    return _detail::do_getrf_matrix<float>(a, ipiv, *info); 
+}
+
+amplapack_status amplapack_dgetrf_m(amplapack_matrix a, int* ipiv, int* info)
+{
+    return _detail::do_getrf_matrix<double>(a, ipiv, *info); 
+}
+
+amplapack_status amplapack_cgetrf_m(amplapack_matrix a, int* ipiv, int* info)
+{
+    return _detail::do_getrf_matrix<ampblas::complex<float>>(a, ipiv, *info); 
+}
+
+amplapack_status amplapack_zgetrf_m(amplapack_matrix a, int* ipiv, int* info)
+{
+    return _detail::do_getrf_matrix<ampblas::complex<double>>(a, ipiv, *info); 
+}
+
+amplapack_status amplapack_sgetrs_m(char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b, int* info)
+{
+    return _detail::do_getrs_matrix<float>(trans, a, ipiv, b, *info); 
+}
+
+amplapack_status amplapack_dgetrs_m(char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b, int* info)
+{
+    return _detail::do_getrs_matrix<double>(trans, a, ipiv, b, *info); 
+}
+
+amplapack_status amplapack_cgetrs_m(char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b, int* info)
+{
+    return _detail::do_getrs_matrix<ampblas::complex<float>>(trans, a, ipiv, b, *info); 
+}
+
+amplapack_status amplapack_zgetrs_m(char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b, int* info)
+{
+    return _detail::do_getrs_matrix<ampblas::complex<double>>(trans, a, ipiv, b, *info); 
+}
+
+amplapack_status amplapack_sgetrf_ooc(int m, int n, float* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return _detail::do_getrf_ooc(m, n, a, lda, ipiv, workspace, *info); 
+}
+
+amplapack_status amplapack_dgetrf_ooc(int m, int n, double* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return _detail::do_getrf_ooc(m, n, a, lda, ipiv, workspace, *info); 
+}
+
+amplapack_status amplapack_cgetrf_ooc(int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return _detail::do_getrf_ooc(m, n, amplapack::amplapack_cast(a), lda, ipiv, workspace, *info); 
+}
+
+amplapack_status amplapack_zgetrf_ooc(int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return _detail::do_getrf_ooc(m, n, amplapack::amplapack_cast(a), lda, ipiv, workspace, *info); 
+}
+
+amplapack_status amplapack_sgetrf_ooc_h(amplapack_handle handle, int m, int n, float* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return _detail::do_getrf_ooc(handle, m, n, a, lda, ipiv, workspace, *info); 
+}
+
+amplapack_status amplapack_dgetrf_ooc_h(amplapack_handle handle, int m, int n, double* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return _detail::do_getrf_ooc(handle, m, n, a, lda, ipiv, workspace, *info); 
+}
+
+amplapack_status amplapack_cgetrf_ooc_h(amplapack_handle handle, int m, int n, amplapack_fcomplex* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return _detail::do_getrf_ooc(handle, m, n, amplapack::amplapack_cast(a), lda, ipiv, workspace, *info); 
+}
+
+amplapack_status amplapack_zgetrf_ooc_h(amplapack_handle handle, int m, int n, amplapack_dcomplex* a, int lda, int* ipiv, size_t workspace, int* info)
+{
+    return _detail::do_getrf_ooc(handle, m, n, amplapack::amplapack_cast(a), lda, ipiv, workspace, *info); 
+}
+
+} // extern "C"
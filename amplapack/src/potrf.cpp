@@ -1,66 +1,552 @@
-/*----------------------------------------------------------------------------
- * Copyright  Microsoft Corp.
- *
- * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
- * use this file except in compliance with the License.  You may obtain a copy 
- * of the License at http://www.apache.org/licenses/LICENSE-2.0  
- * 
- * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
- * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
- * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
- * MERCHANTABLITY OR NON-INFRINGEMENT. 
- *
- * See the Apache Version 2.0 License for specific language governing 
- * permissions and limitations under the License.
- *---------------------------------------------------------------------------
- * 
- * potrf.cpp
- *
- *---------------------------------------------------------------------------*/
-
-#include <functional>
-
-#include <amp.h>
-
-#include "ampclapack.h"      
-#include "amplapack_runtime.h"
-
-#include "detail\potrf.h"    
-
-namespace _detail {
-
-template <typename float_type>
-amplapack_status do_potrf(char uplo, int n, float_type* a, int lda, int& info)
-{
-    // create interface functor
-    std::function<void(concurrency::accelerator_view&)> f = std::bind(amplapack::potrf<float_type>, std::placeholders::_1, uplo, n, a, lda);
-
-    // execute using interface
-    return amplapack::safe_call_interface(f, info);
-}
-
-} // namespace _detail
-
-extern "C" {
-
-amplapack_status amplapack_spotrf(char uplo, int n, float* a, int lda, int* info)
-{
-    return _detail::do_potrf(uplo, n, a, lda, *info); 
-}
-
-amplapack_status amplapack_dpotrf(char uplo, int n, double* a, int lda, int* info)
-{
-    return _detail::do_potrf(uplo, n, a, lda, *info); 
-}
-
-amplapack_status amplapack_cpotrf(char uplo, int n, amplapack_fcomplex* a, int lda, int* info)
-{
-    return _detail::do_potrf(uplo, n, amplapack::amplapack_cast(a), lda, *info); 
-}
-
-amplapack_status amplapack_zpotrf(char uplo, int n, amplapack_dcomplex* a, int lda, int* info)
-{
-    return _detail::do_potrf(uplo, n, amplapack::amplapack_cast(a), lda, *info); 
-}
-
-} // extern "C"
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * potrf.cpp
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <functional>
+
+#include <amp.h>
+
+#include "ampclapack.h"      
+#include "amplapack_runtime.h"
+
+#include "detail\potrf.h"
+#include "detail\out_of_core.h"
+
+namespace _detail {
+
+template <amplapack::execution_target target, typename float_type>
+std::function<void(amplapack::context&)> bind_potrf(char uplo, int n, float_type* a, int lda)
+{
+    // select the context overload of the host interface
+    void (*potrf)(amplapack::context&, char, int, float_type*, int) = amplapack::potrf<target, float_type>;
+
+    // create interface functor
+    return std::bind(potrf, std::placeholders::_1, uplo, n, a, lda);
+}
+
+template <typename float_type>
+std::function<void(amplapack::context&)> make_potrf(char uplo, int n, float_type* a, int lda)
+{
+    using amplapack::execution_target;
+
+    // run where the problem size is best served
+    switch (amplapack::select_target(amplapack_potrf_routine, amplapack::precision_of<float_type>(), n))
+    {
+    case execution_target::host:
+        return bind_potrf<execution_target::host>(uplo, n, a, lda);
+    case execution_target::accelerator:
+        return bind_potrf<execution_target::accelerator>(uplo, n, a, lda);
+    case execution_target::hybrid:
+    default:
+        return bind_potrf<execution_target::hybrid>(uplo, n, a, lda);
+    }
+}
+
+template <typename float_type>
+amplapack_status do_potrf(char uplo, int n, float_type* a, int lda, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_potrf(uplo, n, a, lda);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename float_type>
+amplapack_status do_potrf(amplapack_handle handle, char uplo, int n, float_type* a, int lda, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_potrf(uplo, n, a, lda);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename float_type>
+std::function<void(amplapack::context&)> make_potrs(char uplo, int n, int nrhs, const float_type* a, int lda, float_type* b, int ldb)
+{
+    using amplapack::execution_target;
+
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::potrs_params<float_type> params(uplo, n, nrhs, a, lda, b, ldb);
+
+    if (amplapack::select_target(amplapack_potrf_routine, amplapack::precision_of<float_type>(), n) == execution_target::host)
+        return std::bind(amplapack::_detail::potrs_unpack<execution_target::host, float_type>, std::placeholders::_1, params);
+    else
+        return std::bind(amplapack::_detail::potrs_unpack<execution_target::hybrid, float_type>, std::placeholders::_1, params);
+}
+
+template <typename float_type>
+std::function<void(amplapack::context&)> make_posv(char uplo, int n, int nrhs, float_type* a, int lda, float_type* b, int ldb)
+{
+    using amplapack::execution_target;
+
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::posv_params<float_type> params(uplo, n, nrhs, a, lda, b, ldb);
+
+    switch (amplapack::select_target(amplapack_potrf_routine, amplapack::precision_of<float_type>(), n))
+    {
+    case execution_target::host:
+        return std::bind(amplapack::_detail::posv_unpack<execution_target::host, float_type>, std::placeholders::_1, params);
+    case execution_target::accelerator:
+        return std::bind(amplapack::_detail::posv_unpack<execution_target::accelerator, float_type>, std::placeholders::_1, params);
+    case execution_target::hybrid:
+    default:
+        return std::bind(amplapack::_detail::posv_unpack<execution_target::hybrid, float_type>, std::placeholders::_1, params);
+    }
+}
+
+template <typename float_type>
+amplapack_status do_potrs(char uplo, int n, int nrhs, const float_type* a, int lda, float_type* b, int ldb, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_potrs(uplo, n, nrhs, a, lda, b, ldb);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename float_type>
+amplapack_status do_potrs(amplapack_handle handle, char uplo, int n, int nrhs, const float_type* a, int lda, float_type* b, int ldb, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_potrs(uplo, n, nrhs, a, lda, b, ldb);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename float_type>
+amplapack_status do_posv(char uplo, int n, int nrhs, float_type* a, int lda, float_type* b, int ldb, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_posv(uplo, n, nrhs, a, lda, b, ldb);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename float_type>
+amplapack_status do_posv(amplapack_handle handle, char uplo, int n, int nrhs, float_type* a, int lda, float_type* b, int ldb, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_posv(uplo, n, nrhs, a, lda, b, ldb);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename float_type>
+amplapack_status do_potrf_workspace(int n, size_t* size)
+{
+    if (n < 0 || size == nullptr)
+        return amplapack_argument_error;
+
+    *size = amplapack::potrf_workspace<float_type>(n);
+    return amplapack_success;
+}
+
+// the asynchronous variant never returns to the host between panels, so it runs on the 
+// accelerator unless the problem is small enough for the host
+template <typename float_type>
+std::function<void(amplapack::context&, amplapack::async_call&)> make_potrf_async(char uplo, int n, float_type* a, int lda)
+{
+    using amplapack::execution_target;
+
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::potrf_async_params<float_type> params(uplo, n, a, lda);
+
+    if (amplapack::select_target(amplapack_potrf_routine, amplapack::precision_of<float_type>(), n) == execution_target::host)
+        return std::bind(amplapack::_detail::potrf_async_unpack<execution_target::host, float_type>, std::placeholders::_1, std::placeholders::_2, params);
+    else
+        return std::bind(amplapack::_detail::potrf_async_unpack<execution_target::accelerator, float_type>, std::placeholders::_1, std::placeholders::_2, params);
+}
+
+template <typename float_type>
+amplapack_status do_potrf_async(char uplo, int n, float_type* a, int lda, amplapack_async* token, int& info)
+{
+    std::function<void(amplapack::context&, amplapack::async_call&)> f = make_potrf_async(uplo, n, a, lda);
+
+    // the token owns the context of the call
+    return amplapack::safe_call_interface(f, token, info);
+}
+
+template <typename float_type>
+amplapack_status do_potrf_async(amplapack_handle handle, char uplo, int n, float_type* a, int lda, amplapack_async* token, int& info)
+{
+    std::function<void(amplapack::context&, amplapack::async_call&)> f = make_potrf_async(uplo, n, a, lda);
+
+    // queue on the handle's context
+    return amplapack::safe_call_interface(f, handle, token, info);
+}
+
+// the factor stays on the accelerator
+template <typename value_type>
+void potrf_matrix(amplapack::context& ctx, char uplo, amplapack_matrix a)
+{
+    using amplapack::block_factor_location;
+    using amplapack::execution_target;
+    using amplapack::ordering;
+
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        amplapack::argument_error(1);
+
+    concurrency::array_view<value_type,2> view_a = amplapack::get_matrix_view<value_type>(ctx, a, 2);
+
+    if (a->m != a->n)
+        amplapack::argument_error(2);
+
+    // the matrix is already on the accelerator, so the crossovers only place the block factorization
+    if (amplapack::select_target(amplapack_potrf_routine, amplapack::precision_of<value_type>(), a->n) == execution_target::accelerator)
+        amplapack::potrf<ordering::column_major, block_factor_location::accelerator>(ctx, amplapack::to_option(uplo), view_a);
+    else
+        amplapack::potrf<ordering::column_major, block_factor_location::host>(ctx, amplapack::to_option(uplo), view_a);
+}
+
+template <typename value_type>
+void potrs_matrix(amplapack::context& ctx, char uplo, amplapack_matrix a, amplapack_matrix b)
+{
+    // error checking
+    uplo = static_cast<char>(toupper(uplo));
+
+    if (uplo != 'L' && uplo != 'U')
+        amplapack::argument_error(1);
+
+    concurrency::array_view<value_type,2> view_a = amplapack::get_matrix_view<value_type>(ctx, a, 2);
+
+    if (a->m != a->n)
+        amplapack::argument_error(2);
+
+    concurrency::array_view<value_type,2> view_b = amplapack::get_matrix_view<value_type>(ctx, b, 3);
+
+    if (b->m != a->n)
+        amplapack::argument_error(3);
+
+    amplapack::potrs<amplapack::ordering::column_major, value_type>(ctx, amplapack::to_option(uplo), view_a, view_b);
+}
+
+template <typename value_type>
+amplapack_status do_potrf_matrix(char uplo, amplapack_matrix a, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(potrf_matrix<value_type>, std::placeholders::_1, uplo, a);
+
+    // execute using the context of the matrix's handle
+    return amplapack::safe_call_interface(f, a, 2, info);
+}
+
+template <typename value_type>
+amplapack_status do_potrs_matrix(char uplo, amplapack_matrix a, amplapack_matrix b, int& info)
+{
+    std::function<void(amplapack::context&)> f = std::bind(potrs_matrix<value_type>, std::placeholders::_1, uplo, a, b);
+
+    // execute using the context of the matrix's handle
+    return amplapack::safe_call_interface(f, a, 2, info);
+}
+
+// a never leaves the host as a whole; the slabs are sized by workspace rather than by the 
+// crossovers
+template <typename value_type>
+std::function<void(amplapack::context&)> make_potrf_ooc(char uplo, int n, value_type* a, int lda, size_t workspace)
+{
+    // create interface functor
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::potrf_ooc_params<value_type> params(uplo, n, a, lda, workspace);
+    return std::bind(amplapack::_detail::potrf_ooc_unpack<value_type>, std::placeholders::_1, params);
+}
+
+template <typename value_type>
+amplapack_status do_potrf_ooc(char uplo, int n, value_type* a, int lda, size_t workspace, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_potrf_ooc(uplo, n, a, lda, workspace);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_potrf_ooc(amplapack_handle handle, char uplo, int n, value_type* a, int lda, size_t workspace, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_potrf_ooc(uplo, n, a, lda, workspace);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+} // namespace _detail
+
+extern "C" {
+
+amplapack_status amplapack_spotrf(char uplo, int n, float* a, int lda, int* info)
+{
+    return _detail::do_potrf(uplo, n, a, lda, *info); 
+}
+
+amplapack_status amplapack_dpotrf(char uplo, int n, double* a, int lda, int* info)
+{
+    return _detail::do_potrf(uplo, n, a, lda, *info); 
+}
+
+amplapack_status amplapack_cpotrf(char uplo, int n, amplapack_fcomplex* a, int lda, int* info)
+{
+    return _detail::do_potrf(uplo, n, amplapack::amplapack_cast(a), lda, *info); 
+}
+
+amplapack_status amplapack_zpotrf(char uplo, int n, amplapack_dcomplex* a, int lda, int* info)
+{
+    return _detail::do_potrf(uplo, n, amplapack::amplapack_cast(a), lda, *info); 
+}
+
+amplapack_status amplapack_spotrf_h(amplapack_handle handle, char uplo, int n, float* a, int lda, int* info)
+{
+    return _detail::do_potrf(handle, uplo, n, a, lda, *info); 
+}
+
+amplapack_status amplapack_dpotrf_h(amplapack_handle handle, char uplo, int n, double* a, int lda, int* info)
+{
+    return _detail::do_potrf(handle, uplo, n, a, lda, *info); 
+}
+
+amplapack_status amplapack_cpotrf_h(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, int* info)
+{
+    return _detail::do_potrf(handle, uplo, n, amplapack::amplapack_cast(a), lda, *info); 
+}
+
+amplapack_status amplapack_zpotrf_h(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, int* info)
+{
+    return _detail::do_potrf(handle, uplo, n, amplapack::amplapack_cast(a), lda, *info); 
+}
+
+amplapack_status amplapack_spotrs(char uplo, int n, int nrhs, const float* a, int lda, float* b, int ldb, int* info)
+{
+    return _detail::do_potrs(uplo, n, nrhs, a, lda, b, ldb, *info); 
+}
+
+amplapack_status amplapack_dpotrs(char uplo, int n, int nrhs, const double* a, int lda, double* b, int ldb, int* info)
+{
+    return _detail::do_potrs(uplo, n, nrhs, a, lda, b, ldb, *info); 
+}
+
+amplapack_status amplapack_cpotrs(char uplo, int n, int nrhs, const amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return _detail::do_potrs(uplo, n, nrhs, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_zpotrs(char uplo, int n, int nrhs, const amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return _detail::do_potrs(uplo, n, nrhs, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_spotrs_h(amplapack_handle handle, char uplo, int n, int nrhs, const float* a, int lda, float* b, int ldb, int* info)
+{
+    return _detail::do_potrs(handle, uplo, n, nrhs, a, lda, b, ldb, *info); 
+}
+
+amplapack_status amplapack_dpotrs_h(amplapack_handle handle, char uplo, int n, int nrhs, const double* a, int lda, double* b, int ldb, int* info)
+{
+    return _detail::do_potrs(handle, uplo, n, nrhs, a, lda, b, ldb, *info); 
+}
+
+amplapack_status amplapack_cpotrs_h(amplapack_handle handle, char uplo, int n, int nrhs, const amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return _detail::do_potrs(handle, uplo, n, nrhs, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_zpotrs_h(amplapack_handle handle, char uplo, int n, int nrhs, const amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return _detail::do_potrs(handle, uplo, n, nrhs, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_sposv(char uplo, int n, int nrhs, float* a, int lda, float* b, int ldb, int* info)
+{
+    return _detail::do_posv(uplo, n, nrhs, a, lda, b, ldb, *info); 
+}
+
+amplapack_status amplapack_dposv(char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, int* info)
+{
+    return _detail::do_posv(uplo, n, nrhs, a, lda, b, ldb, *info); 
+}
+
+amplapack_status amplapack_cposv(char uplo, int n, int nrhs, amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return _detail::do_posv(uplo, n, nrhs, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_zposv(char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return _detail::do_posv(uplo, n, nrhs, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_sposv_h(amplapack_handle handle, char uplo, int n, int nrhs, float* a, int lda, float* b, int ldb, int* info)
+{
+    return _detail::do_posv(handle, uplo, n, nrhs, a, lda, b, ldb, *info); 
+}
+
+amplapack_status amplapack_dposv_h(amplapack_handle handle, char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, int* info)
+{
+    return _detail::do_posv(handle, uplo, n, nrhs, a, lda, b, ldb, *info); 
+}
+
+amplapack_status amplapack_cposv_h(amplapack_handle handle, char uplo, int n, int nrhs, amplapack_fcomplex* a, int lda, amplapack_fcomplex* b, int ldb, int* info)
+{
+    return _detail::do_posv(handle, uplo, n, nrhs, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_zposv_h(amplapack_handle handle, char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, int* info)
+{
+    return _detail::do_posv(handle, uplo, n, nrhs, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(b), ldb, *info); 
+}
+
+amplapack_status amplapack_spotrf_workspace(int n, size_t* size)
+{
+    return _detail::do_potrf_workspace<float>(n, size);
+}
+
+amplapack_status amplapack_dpotrf_workspace(int n, size_t* size)
+{
+    return _detail::do_potrf_workspace<double>(n, size);
+}
+
+amplapack_status amplapack_cpotrf_workspace(int n, size_t* size)
+{
+    return _detail::do_potrf_workspace<ampblas::complex<float>>(n, size);
+}
+
+amplapack_status amplapack_zpotrf_workspace(int n, size_t* size)
+{
+    return _detail::do_potrf_workspace<ampblas::complex<double>>(n, size);
+}
+
+amplapack_status amplapack_spotrf_async(char uplo, int n, float* a, int lda, amplapack_async* token, int* info)
+{
+    return _detail::do_potrf_async(uplo, n, a, lda, token, *info); 
+}
+
+amplapack_status amplapack_dpotrf_async(char uplo, int n, double* a, int lda, amplapack_async* token, int* info)
+{
+    return _detail::do_potrf_async(uplo, n, a, lda, token, *info); 
+}
+
+amplapack_status amplapack_cpotrf_async(char uplo, int n, amplapack_fcomplex* a, int lda, amplapack_async* token, int* info)
+{
+    return _detail::do_potrf_async(uplo, n, amplapack::amplapack_cast(a), lda, token, *info); 
+}
+
+amplapack_status amplapack_zpotrf_async(char uplo, int n, amplapack_dcomplex* a, int lda, amplapack_async* token, int* info)
+{
+    return _detail::do_potrf_async(uplo, n, amplapack::amplapack_cast(a), lda, token, *info); 
+}
+
+amplapack_status amplapack_spotrf_async_h(amplapack_handle handle, char uplo, int n, float* a, int lda, amplapack_async* token, int* info)
+{
+    return _detail::do_potrf_async(handle, uplo, n, a, lda, token, *info); 
+}
+
+amplapack_status amplapack_dpotrf_async_h(amplapack_handle handle, char uplo, int n, double* a, int lda, amplapack_async* token, int* info)
+{
+    return _detail::do_potrf_async(handle, uplo, n, a, lda, token, *info); 
+}
+
+amplapack_status amplapack_cpotrf_async_h(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, amplapack_async* token, int* info)
+{
+    return _detail::do_potrf_async(handle, uplo, n, amplapack::amplapack_cast(a), lda, token, *info); 
+}
+
+amplapack_status amplapack_zpotrf_async_h(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, amplapack_async* token, int* info)
+{
+    return _detail::do_potrf_async(handle, uplo, n, amplapack::amplapack_cast(a), lda, token, *info); 
+}
+
+amplapack_status amplapack_spotrf_m(char uplo, amplapack_matrix a, int* info)
+{
+    return _detail::do_potrf_matrix<float>(uplo, a, *info); 
+}
+
+amplapack_status amplapack_dpotrf_m(char uplo, amplapack_matrix a, int* info)
+{
+    return _detail::do_potrf_matrix<double>(uplo, a, *info); 
+}
+
+amplapack_status amplapack_cpotrf_m(char uplo, amplapack_matrix a, int* info)
+{
+    return _detail::do_potrf_matrix<ampblas::complex<float>>(uplo, a, *info); 
+}
+
+amplapack_status amplapack_zpotrf_m(char uplo, amplapack_matrix a, int* info)
+{
+    return _detail::do_potrf_matrix<ampblas::complex<double>>(uplo, a, *info); 
+}
+
+amplapack_status amplapack_spotrs_m(char uplo, amplapack_matrix a, amplapack_matrix b, int* info)
+{
+    return _detail::do_potrs_matrix<float>(uplo, a, b, *info); 
+}
+
+amplapack_status amplapack_dpotrs_m(char uplo, amplapack_matrix a, amplapack_matrix b, int* info)
+{
+    return _detail::do_potrs_matrix<double>(uplo, a, b, *info); 
+}
+
+amplapack_status amplapack_cpotrs_m(char uplo, amplapack_matrix a, amplapack_matrix b, int* info)
+{
+    return _detail::do_potrs_matrix<ampblas::complex<float>>(uplo, a, b, *info); 
+}
+
+amplapack_status amplapack_zpotrs_m(char uplo, amplapack_matrix a, amplapack_matrix b, int* info)
+{
+    return _detail::do_potrs_matrix<ampblas::complex<double>>(uplo, a, b, *info); 
+}
+
+amplapack_status amplapack_spotrf_ooc(char uplo, int n, float* a, int lda, size_t workspace, int* info)
+{
+    return _detail::do_potrf_ooc(uplo, n, a, lda, workspace, *info); 
+}
+
+amplapack_status amplapack_dpotrf_ooc(char uplo, int n, double* a, int lda, size_t workspace, int* info)
+{
+    return _detail::do_potrf_ooc(uplo, n, a, lda, workspace, *info); 
+}
+
+amplapack_status amplapack_cpotrf_ooc(char uplo, int n, amplapack_fcomplex* a, int lda, size_t workspace, int* info)
+{
+    return _detail::do_potrf_ooc(uplo, n, amplapack::amplapack_cast(a), lda, workspace, *info); 
+}
+
+amplapack_status amplapack_zpotrf_ooc(char uplo, int n, amplapack_dcomplex* a, int lda, size_t workspace, int* info)
+{
+    return _detail::do_potrf_ooc(uplo, n, amplapack::amplapack_cast(a), lda, workspace, *info); 
+}
+
+amplapack_status amplapack_spotrf_ooc_h(amplapack_handle handle, char uplo, int n, float* a, int lda, size_t workspace, int* info)
+{
+    return _detail::do_potrf_ooc(handle, uplo, n, a, lda, workspace, *info); 
+}
+
+amplapack_status amplapack_dpotrf_ooc_h(amplapack_handle handle, char uplo, int n, double* a, int lda, size_t workspace, int* info)
+{
+    return _detail::do_potrf_ooc(handle, uplo, n, a, lda, workspace, *info); 
+}
+
+amplapack_status amplapack_cpotrf_ooc_h(amplapack_handle handle, char uplo, int n, amplapack_fcomplex* a, int lda, size_t workspace, int* info)
+{
+    return _detail::do_potrf_ooc(handle, uplo, n, amplapack::amplapack_cast(a), lda, workspace, *info); 
+}
+
+amplapack_status amplapack_zpotrf_ooc_h(amplapack_handle handle, char uplo, int n, amplapack_dcomplex* a, int lda, size_t workspace, int* info)
+{
+    return _detail::do_potrf_ooc(handle, uplo, n, amplapack::amplapack_cast(a), lda, workspace, *info); 
+}
+
+} // extern "C"
@@ -0,0 +1,128 @@
+/*----------------------------------------------------------------------------
+ * Copyright  Microsoft Corp.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not 
+ * use this file except in compliance with the License.  You may obtain a copy 
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0  
+ * 
+ * THIS CODE IS PROVIDED *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED 
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, 
+ * MERCHANTABLITY OR NON-INFRINGEMENT. 
+ *
+ * See the Apache Version 2.0 License for specific language governing 
+ * permissions and limitations under the License.
+ *---------------------------------------------------------------------------
+ * 
+ * refine.cpp
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <functional>
+
+#include <amp.h>
+
+#include "ampclapack.h"      
+#include "amplapack_runtime.h"
+
+#include "detail\refine.h"    
+
+namespace _detail {
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_gesv_mixed(int n, int nrhs, value_type* a, int lda, int* ipiv, value_type* b, int ldb, value_type* x, int ldx, int* iter)
+{
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::gesv_mixed_params<value_type> params(n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter);
+    return std::bind(amplapack::_detail::gesv_mixed_unpack<value_type>, std::placeholders::_1, params);
+}
+
+template <typename value_type>
+std::function<void(amplapack::context&)> make_posv_mixed(char uplo, int n, int nrhs, value_type* a, int lda, value_type* b, int ldb, value_type* x, int ldx, int* iter)
+{
+    // NOTE: VS11 std::bind doesn't support over 5 arguments; using a transport struct as a workaround
+    amplapack::_detail::posv_mixed_params<value_type> params(uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter);
+    return std::bind(amplapack::_detail::posv_mixed_unpack<value_type>, std::placeholders::_1, params);
+}
+
+template <typename value_type>
+amplapack_status do_gesv_mixed(int n, int nrhs, value_type* a, int lda, int* ipiv, value_type* b, int ldb, value_type* x, int ldx, int* iter, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_gesv_mixed(n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_gesv_mixed(amplapack_handle handle, int n, int nrhs, value_type* a, int lda, int* ipiv, value_type* b, int ldb, value_type* x, int ldx, int* iter, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_gesv_mixed(n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+template <typename value_type>
+amplapack_status do_posv_mixed(char uplo, int n, int nrhs, value_type* a, int lda, value_type* b, int ldb, value_type* x, int ldx, int* iter, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_posv_mixed(uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter);
+
+    // execute using interface
+    return amplapack::safe_call_interface(f, info);
+}
+
+template <typename value_type>
+amplapack_status do_posv_mixed(amplapack_handle handle, char uplo, int n, int nrhs, value_type* a, int lda, value_type* b, int ldb, value_type* x, int ldx, int* iter, int& info)
+{
+    std::function<void(amplapack::context&)> f = make_posv_mixed(uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter);
+
+    // execute using the handle's context
+    return amplapack::safe_call_interface(f, handle, info);
+}
+
+} // namespace _detail
+
+extern "C" {
+
+amplapack_status amplapack_dsgesv(int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, double* x, int ldx, int* iter, int* info)
+{
+    return _detail::do_gesv_mixed(n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter, *info);
+}
+
+amplapack_status amplapack_zcgesv(int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info)
+{
+    return _detail::do_gesv_mixed(n, nrhs, amplapack::amplapack_cast(a), lda, ipiv, amplapack::amplapack_cast(b), ldb, amplapack::amplapack_cast(x), ldx, iter, *info);
+}
+
+amplapack_status amplapack_dsposv(char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, double* x, int ldx, int* iter, int* info)
+{
+    return _detail::do_posv_mixed(uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter, *info);
+}
+
+amplapack_status amplapack_zcposv(char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info)
+{
+    return _detail::do_posv_mixed(uplo, n, nrhs, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(b), ldb, amplapack::amplapack_cast(x), ldx, iter, *info);
+}
+
+amplapack_status amplapack_dsgesv_h(amplapack_handle handle, int n, int nrhs, double* a, int lda, int* ipiv, double* b, int ldb, double* x, int ldx, int* iter, int* info)
+{
+    return _detail::do_gesv_mixed(handle, n, nrhs, a, lda, ipiv, b, ldb, x, ldx, iter, *info);
+}
+
+amplapack_status amplapack_zcgesv_h(amplapack_handle handle, int n, int nrhs, amplapack_dcomplex* a, int lda, int* ipiv, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info)
+{
+    return _detail::do_gesv_mixed(handle, n, nrhs, amplapack::amplapack_cast(a), lda, ipiv, amplapack::amplapack_cast(b), ldb, amplapack::amplapack_cast(x), ldx, iter, *info);
+}
+
+amplapack_status amplapack_dsposv_h(amplapack_handle handle, char uplo, int n, int nrhs, double* a, int lda, double* b, int ldb, double* x, int ldx, int* iter, int* info)
+{
+    return _detail::do_posv_mixed(handle, uplo, n, nrhs, a, lda, b, ldb, x, ldx, iter, *info);
+}
+
+amplapack_status amplapack_zcposv_h(amplapack_handle handle, char uplo, int n, int nrhs, amplapack_dcomplex* a, int lda, amplapack_dcomplex* b, int ldb, amplapack_dcomplex* x, int ldx, int* iter, int* info)
+{
+    return _detail::do_posv_mixed(handle, uplo, n, nrhs, amplapack::amplapack_cast(a), lda, amplapack::amplapack_cast(b), ldb, amplapack::amplapack_cast(x), ldx, iter, *info);
+}
+
+} // extern "C"
@@ -1,111 +1,212 @@
-#pragma once
-#ifndef AMPLAPACK_TEST_H
-#define AMPLAPACK_TEST_H
-
-#include <limits>
-#include <memory>
-
-#include "ampblas_complex.h"
-#include "ampclapack.h"
-
-#ifdef max
-#undef max
-#endif
-
-#ifdef min
-#undef min
-#endif
-
-// using ampblas's types for testing
-typedef ampblas::complex<float> fcomplex;
-typedef ampblas::complex<double> dcomplex;
-
-// cast from testing types to interface types (real pass through)
-template <typename value_type> inline value_type* cast(value_type* ptr) { return ptr; }
-template <typename value_type> inline const value_type* cast(const value_type* ptr) { return ptr; }
-
-// cast from testing types to interface types (complex cast)
-inline amplapack_fcomplex* cast(fcomplex* ptr) {  return reinterpret_cast<amplapack_fcomplex*>(ptr); }
-inline const amplapack_fcomplex* cast(const fcomplex* ptr) { return reinterpret_cast<const amplapack_fcomplex*>(ptr); }
-inline amplapack_dcomplex* cast(dcomplex* ptr) { return reinterpret_cast<amplapack_dcomplex*>(ptr); }
-inline const amplapack_dcomplex* cast(const dcomplex* ptr) { return reinterpret_cast<const amplapack_dcomplex*>(ptr); }
-
-// test listing
-void potrf_test();
-void getrf_test();
-void geqrf_test();
-
-// LAPACK data type prefix (SDCZ)
-template <typename value_type>
-char type_prefix();
-
-template <typename value_type>
-struct is_complex { static const bool value = false; };
-
-template <typename value_type>
-struct is_complex<ampblas::complex<value_type>> { static const bool value = true; };
-
-// matrix-matrix multiply is used in a number of reconstruction algorithms
-template <typename value_type>
-void gemm(char transa, char transb, int m, int n, int k, value_type alpha, const value_type* a, int lda, const value_type* b, int ldb, value_type beta, value_type* c, int ldc);
-
-// row swap is used in the GETRF reconstruction
-template <typename value_type>
-void laswp(int n, value_type* a, int lda, int k1, int k2, int* ipiv, int incx);
-
-// q generation from geqrf results
-template <typename value_type>
-void orgqr(int m, int n, int k, value_type* a, int lda, value_type* tau);
-
-// returns the one-norm of an m by n matrix
-template <typename value_type>
-typename ampblas::real_type<value_type>::type one_norm(int m, int n, value_type* a, int lda)
-{
-    typedef ampblas::real_type<value_type>::type real_type;
-
-    real_type norm = real_type();
-
-    for (int j = 0; j < n; j++)
-    {
-        real_type sum = real_type();
-        for (int i = 0; i < m; i++)
-            sum += abs( a[j*lda+i] );
-
-        norm = std::max(norm, sum);
-    }
-
-    return norm / n;
-}
-
-// 
-template <typename value_type>
-value_type random_value(value_type min, value_type max)
-{
-    value_type val = value_type(rand()) / value_type(RAND_MAX);
-    val *= (max-min);
-    val += min;
-    return val;
-}
-
-template <typename value_type>
-typename ampblas::complex<value_type> random_value( ampblas::complex<value_type> min,  ampblas::complex<value_type> max)
-{
-    return ampblas::complex<value_type>(random_value(min.real(),max.real()), random_value(min.real(),max.real()));
-}
-
-// high resolution timer for use on Windows platforms
-class high_resolution_timer
-{
-public:
-    high_resolution_timer();
-    ~high_resolution_timer();
-
-    void restart();
-    double elapsed();
-
-private:
-    struct impl;
-    std::unique_ptr<impl> pimpl;
-};
-
-#endif // AMPLAPACK_TEST_H
+#pragma once
+#ifndef AMPLAPACK_TEST_H
+#define AMPLAPACK_TEST_H
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "ampblas_complex.h"
+#include "ampclapack.h"
+
+#ifdef max
+#undef max
+#endif
+
+#ifdef min
+#undef min
+#endif
+
+// using ampblas's types for testing
+typedef ampblas::complex<float> fcomplex;
+typedef ampblas::complex<double> dcomplex;
+
+// cast from testing types to interface types (real pass through)
+template <typename value_type> inline value_type* cast(value_type* ptr) { return ptr; }
+template <typename value_type> inline const value_type* cast(const value_type* ptr) { return ptr; }
+
+// cast from testing types to interface types (complex cast)
+inline amplapack_fcomplex* cast(fcomplex* ptr) {  return reinterpret_cast<amplapack_fcomplex*>(ptr); }
+inline const amplapack_fcomplex* cast(const fcomplex* ptr) { return reinterpret_cast<const amplapack_fcomplex*>(ptr); }
+inline amplapack_dcomplex* cast(dcomplex* ptr) { return reinterpret_cast<amplapack_dcomplex*>(ptr); }
+inline const amplapack_dcomplex* cast(const dcomplex* ptr) { return reinterpret_cast<const amplapack_dcomplex*>(ptr); }
+
+// cast of pointer arrays (batched routines)
+inline amplapack_fcomplex** cast(fcomplex** ptr) {  return reinterpret_cast<amplapack_fcomplex**>(ptr); }
+inline amplapack_dcomplex** cast(dcomplex** ptr) {  return reinterpret_cast<amplapack_dcomplex**>(ptr); }
+
+// complex conjugate (real pass through)
+template <typename value_type>
+inline value_type conjugate(const value_type& value)
+{
+    return value;
+}
+
+template <typename value_type>
+inline ampblas::complex<value_type> conjugate(const ampblas::complex<value_type>& value)
+{
+    return ampblas::complex<value_type>(value.real(), -value.imag());
+}
+
+// largest elementwise difference between two m by n matrices
+template <typename value_type>
+double max_difference(int m, int n, const std::vector<value_type>& a, const std::vector<value_type>& b, int lda)
+{
+    double error = 0;
+
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            error = std::max(error, double(abs(a[j*lda+i] - b[j*lda+i])));
+
+    return error;
+}
+
+// test listing
+void potrf_test();
+void getrf_test();
+void geqrf_test();
+void handle_test();
+void batched_test();
+void dispatch_test();
+void ordering_test();
+void location_test();
+void refine_test();
+void gesv_test();
+void posv_test();
+void ormqr_test();
+void async_test();
+void multi_device_test();
+void matrix_test();
+void ooc_test();
+void stream_test();
+void tile_test();
+void tiled_potrf_test();
+void tsqr_test();
+void calu_test();
+
+// LAPACK data type prefix (SDCZ)
+template <typename value_type>
+char type_prefix();
+
+template <typename value_type>
+struct is_complex { static const bool value = false; };
+
+template <typename value_type>
+struct is_complex<ampblas::complex<value_type>> { static const bool value = true; };
+
+// matrix-matrix multiply is used in a number of reconstruction algorithms
+template <typename value_type>
+void gemm(char transa, char transb, int m, int n, int k, value_type alpha, const value_type* a, int lda, const value_type* b, int ldb, value_type beta, value_type* c, int ldc);
+
+// row swap is used in the GETRF reconstruction
+template <typename value_type>
+void laswp(int n, value_type* a, int lda, int k1, int k2, int* ipiv, int incx);
+
+// q generation from geqrf results
+template <typename value_type>
+void orgqr(int m, int n, int k, value_type* a, int lda, value_type* tau);
+
+// returns the one-norm of an m by n matrix
+template <typename value_type>
+typename ampblas::real_type<value_type>::type one_norm(int m, int n, value_type* a, int lda)
+{
+    typedef ampblas::real_type<value_type>::type real_type;
+
+    real_type norm = real_type();
+
+    for (int j = 0; j < n; j++)
+    {
+        real_type sum = real_type();
+        for (int i = 0; i < m; i++)
+            sum += abs( a[j*lda+i] );
+
+        norm = std::max(norm, sum);
+    }
+
+    return norm / n;
+}
+
+// backward error of the solution x of op(a)*x = b (n by n and n by nrhs, column major): the
+// largest |b - op(a)*x| of a column relative to |op(a)| * |x| (infinity norms), in units of
+// n * eps; b is overwritten with the residual
+template <typename value_type>
+double backward_error(int n, int nrhs, const std::vector<value_type>& a, std::vector<value_type>& b, const std::vector<value_type>& x, char trans = 'n')
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    const bool no_trans = (trans == 'n' || trans == 'N');
+
+    // b = b - op(a)*x
+    gemm(trans, 'n', n, nrhs, n, value_type(-1), a.data(), n, x.data(), n, value_type(1), b.data(), n);
+
+    double a_norm = 0;
+    for (int i = 0; i < n; i++)
+    {
+        double row = 0;
+        for (int j = 0; j < n; j++)
+            row += abs(no_trans ? a[j*n+i] : a[i*n+j]);
+
+        a_norm = std::max(a_norm, row);
+    }
+
+    double error = 0;
+    for (int j = 0; j < nrhs; j++)
+    {
+        double r_norm = 0, x_norm = 0;
+        for (int i = 0; i < n; i++)
+        {
+            r_norm = std::max(r_norm, double(abs(b[j*n+i])));
+            x_norm = std::max(x_norm, double(abs(x[j*n+i])));
+        }
+
+        error = std::max(error, r_norm / (a_norm * x_norm * n * std::numeric_limits<real_type>::epsilon()));
+    }
+
+    return error;
+}
+
+// reports a direct solve, which must succeed with a backward stable solution (within 100 n * eps)
+inline void report_solve(amplapack_status status, int info, double error)
+{
+    if (status != amplapack_success || info != 0)
+        std::cout << "Failed with status " << status << " info " << info << std::endl;
+    else if (error > 100)
+        std::cout << "Failed! Backward Error = " << error << std::endl;
+    else
+        std::cout << "Success! Backward Error = " << error << std::endl;
+}
+
+// 
+template <typename value_type>
+value_type random_value(value_type min, value_type max)
+{
+    value_type val = value_type(rand()) / value_type(RAND_MAX);
+    val *= (max-min);
+    val += min;
+    return val;
+}
+
+template <typename value_type>
+typename ampblas::complex<value_type> random_value( ampblas::complex<value_type> min,  ampblas::complex<value_type> max)
+{
+    return ampblas::complex<value_type>(random_value(min.real(),max.real()), random_value(min.real(),max.real()));
+}
+
+// high resolution timer for use on Windows platforms
+class high_resolution_timer
+{
+public:
+    high_resolution_timer();
+    ~high_resolution_timer();
+
+    void restart();
+    double elapsed();
+
+private:
+    struct impl;
+    std::unique_ptr<impl> pimpl;
+};
+
+#endif // AMPLAPACK_TEST_H
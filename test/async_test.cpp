@@ -0,0 +1,256 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <climits>
+#include <limits>
+
+#include "amplapack_test.h"
+#include "ampxlapack.h"
+
+// the array view interface (geqrf_async)
+#include "amplapack.h"
+
+// host GEMM used for reconstruction
+#include "lapack_host.h"
+
+// a factorization is backward stable when its residual is within a small multiple of
+// n * eps * |a|
+template <typename value_type>
+bool within_tolerance(double error, double norm, int n)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+    return error <= 100.0 * n * std::numeric_limits<real_type>::epsilon() * norm;
+}
+
+// one-norm of a - q*r for the factors of geqrf in a and tau; a_in is overwritten
+template <typename value_type>
+double geqrf_residual(int m, int n, const std::vector<value_type>& a, int lda, std::vector<value_type>& tau, std::vector<value_type>& a_in)
+{
+    const int k = std::min(m,n);
+
+    // extract v/q and r
+    std::vector<value_type> r(a);
+    std::vector<value_type> q(m*m, value_type());
+
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = j+1; i < m; i++)
+        {
+            q[m*j+i] = a[lda*j+i];
+            r[lda*j+i] = value_type();
+        }
+    }
+
+    // generate q
+    orgqr(m, m, k, q.data(), m, tau.data());
+
+    // a = a - qr
+    gemm('n', 'n', m, n, k, value_type(1), q.data(), m, r.data(), lda, value_type(-1), a_in.data(), lda);
+
+    return one_norm(m, n, a_in.data(), lda);
+}
+
+template <typename value_type>
+void do_getrf_async_test(int m, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GETRF ASYNC for M=" << m << " N=" << n << "... ";
+
+    // create data
+    int k = std::min(m,n);
+    int lda = m;
+    std::vector<value_type> a(lda*n);
+    std::vector<int> ipiv(k);
+
+    // fill with random values
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    // adjust diagonal for stability
+    for (int i = 0; i < (lda*n); i += (lda+1))
+        a[i] = random_value(value_type(1), value_type(2));
+
+    // backup a for reconstruction purposes
+    std::vector<value_type> a_in(a);
+
+    int info;
+    amplapack_async token;
+
+    amplapack_status status = amplapack_getrf_async(m, n, cast(a.data()), lda, ipiv.data(), &token, &info);
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed to queue (status " << status << ", info " << info << ")" << std::endl;
+        return;
+    }
+
+    // the host is free while the factorization runs
+    int polls = 0;
+    int done = 0;
+    while (amplapack_async_test(token, &done) == amplapack_success && !done)
+        polls++;
+
+    status = amplapack_async_wait(token, &info);
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+        return;
+    }
+
+    // swap on a
+    laswp(k, a_in.data(), lda, 1, k, ipiv.data(), 1);
+
+    // extract l and u
+    std::vector<value_type> l(a);
+    std::vector<value_type>& u = a;
+
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < m; i++)
+        {
+            if (j > i)
+                l[j*lda+i] = value_type();
+
+            if (j == i)
+                l[j*lda+i] = value_type(1);
+
+            if (j < i)
+                u[j*lda+i] = value_type();
+        }
+    }
+
+    // a = a - l*u
+    const double norm = one_norm(m, n, a_in.data(), lda);
+    gemm('n', 'n', m, n, k, value_type(1), l.data(), lda, u.data(), lda, value_type(-1), a_in.data(), lda);
+    const double error = one_norm(m, n, a_in.data(), lda);
+
+    if (within_tolerance<value_type>(error, norm, std::max(m,n)))
+        std::cout << "Success! Error = " << error << " Polls = " << polls << std::endl;
+    else
+        std::cout << "Failed! Error = " << error << std::endl;
+}
+
+// the c interface (token) and the array view interface (completion future) in turn
+template <typename value_type>
+void do_geqrf_async_test(int m, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GEQRF ASYNC for M=" << m << " N=" << n << "... ";
+
+    // create data
+    int k = std::min(m,n);
+    int lda = m;
+    std::vector<value_type> a(lda*n);
+
+    // fill with random values
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> a_in(a);
+    std::vector<value_type> a_view(a);
+    std::vector<value_type> tau(k), tau_view(k);
+
+    int info;
+    amplapack_async token;
+
+    amplapack_status status = amplapack_geqrf_async(m, n, cast(a.data()), lda, cast(tau.data()), &token, &info);
+
+    if (status == amplapack_success)
+        status = amplapack_async_wait(token, &info);
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+        return;
+    }
+
+    {
+        amplapack::context ctx(concurrency::accelerator().default_view);
+        concurrency::array_view<value_type,2> view_a(n, lda, a_view);
+        concurrency::array_view<value_type,1> view_tau(k, tau_view);
+
+        concurrency::completion_future done = amplapack::geqrf_async<amplapack::ordering::column_major>(ctx, view_a, view_tau);
+        done.wait();
+
+        view_a.synchronize();
+        view_tau.synchronize();
+    }
+
+    // a = a - qr for both
+    std::vector<value_type> a_check(a_in);
+    const double norm = one_norm(m, n, a_in.data(), lda);
+    const double error = std::max(geqrf_residual(m, n, a, lda, tau, a_check), geqrf_residual(m, n, a_view, lda, tau_view, a_in));
+
+    if (within_tolerance<value_type>(error, norm, m))
+        std::cout << "Success! Error = " << error << std::endl;
+    else
+        std::cout << "Failed! Error = " << error << std::endl;
+}
+
+// a matrix that is not positive definite must be reported when the call is waited on
+template <typename value_type>
+void do_potrf_async_error_test(int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "POTRF ASYNC data error for N=" << n << "... ";
+
+    amplapack_handle handle;
+    if (amplapack_create_handle(&handle) != amplapack_success)
+    {
+        std::cout << "Failed to create handle" << std::endl;
+        return;
+    }
+
+    // identity with a negative entry on the diagonal
+    const int bad = n/2;
+    std::vector<value_type> a(n*n, value_type());
+    for (int i = 0; i < n; i++)
+        a[i*n+i] = value_type(i == bad ? -1 : 1);
+
+    int info;
+    amplapack_async token;
+
+    amplapack_status status = amplapack_potrf_async(handle, 'L', n, cast(a.data()), n, &token, &info);
+
+    if (status == amplapack_success)
+        status = amplapack_async_wait(token, &info);
+
+    if (status == amplapack_data_error && info == bad+1)
+        std::cout << "Success!" << std::endl;
+    else
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+
+    amplapack_destroy_handle(handle);
+}
+
+void async_test()
+{
+    // only problems below the host crossover are factored on the host
+    int host_crossover[3], accelerator_crossover[3];
+    amplapack_get_crossover(amplapack_getrf_routine, 'S', &host_crossover[0], &accelerator_crossover[0]);
+    amplapack_get_crossover(amplapack_getrf_routine, 'C', &host_crossover[1], &accelerator_crossover[1]);
+    amplapack_get_crossover(amplapack_potrf_routine, 'S', &host_crossover[2], &accelerator_crossover[2]);
+    amplapack_set_crossover(amplapack_getrf_routine, 'S', 0, INT_MAX);
+    amplapack_set_crossover(amplapack_getrf_routine, 'C', 0, INT_MAX);
+    amplapack_set_crossover(amplapack_potrf_routine, 'S', 0, INT_MAX);
+
+    do_getrf_async_test<float>(1024, 1024);
+    do_getrf_async_test<fcomplex>(1024, 1024);
+
+    // partial last panel
+    do_getrf_async_test<float>(1000, 700);
+
+    do_potrf_async_error_test<float>(600);
+
+    do_geqrf_async_test<float>(1024, 1024);
+
+    // tall with a partial last panel
+    do_geqrf_async_test<dcomplex>(1000, 700);
+
+    amplapack_set_crossover(amplapack_getrf_routine, 'S', host_crossover[0], accelerator_crossover[0]);
+    amplapack_set_crossover(amplapack_getrf_routine, 'C', host_crossover[1], accelerator_crossover[1]);
+    amplapack_set_crossover(amplapack_potrf_routine, 'S', host_crossover[2], accelerator_crossover[2]);
+}
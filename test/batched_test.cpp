@@ -0,0 +1,225 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+#include "amplapack_test.h"
+#include "ampxlapack.h"
+
+// largest one-norm difference between the matrices first:first+batch_count of two strided batches
+template <typename value_type>
+typename ampblas::real_type<value_type>::type batch_difference(int m, int n, const std::vector<value_type>& a, const std::vector<value_type>& b, int lda, int stride, int batch_count, int first = 0)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    real_type error = real_type();
+    std::vector<value_type> diff(lda*n);
+
+    for (int k = first; k < first + batch_count; k++)
+    {
+        for (int i = 0; i < lda*n; i++)
+            diff[i] = a[k*stride+i] - b[k*stride+i];
+
+        error = std::max(error, one_norm(m, n, diff.data(), lda));
+    }
+
+    return error;
+}
+
+// reports the status of a batched call
+inline bool batch_status(amplapack_status status, int info)
+{
+    if (status == amplapack_success)
+        return true;
+
+    if (status == amplapack_argument_error)
+        std::cout << "Argument Error @ " << -info << std::endl;
+    else
+        std::cout << "Failed with status " << status << std::endl;
+
+    return false;
+}
+
+template <typename value_type>
+void do_getrf_batched_test(int m, int n, int batch_count)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GETRF_BATCHED for M=" << m << " N=" << n << " BATCH=" << batch_count << "... ";
+
+    // performance timer
+    high_resolution_timer timer;
+
+    // create data
+    int k = std::min(m,n);
+    int lda = m;
+    int stride_a = lda*n;
+    std::vector<value_type> a(stride_a*batch_count);
+    std::vector<int> ipiv(k*batch_count);
+    std::vector<int> info_array(batch_count, -1);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    // the first matrix is singular
+    for (int i = 0; i < m; i++)
+        a[i] = value_type();
+
+    std::vector<value_type> a_ref(a);
+    std::vector<int> ipiv_ref(ipiv);
+
+    int info;
+
+    timer.restart();
+    amplapack_status status = amplapack_getrf_strided_batched(m, n, cast(a.data()), lda, stride_a, ipiv.data(), k, info_array.data(), batch_count, &info);
+    double sec = timer.elapsed();
+
+    if (!batch_status(status, info))
+        return;
+
+    // each matrix on its own (singular matrices only compare their info)
+    typename ampblas::real_type<value_type>::type error = 0;
+    bool match = true;
+
+    for (int b = 0; b < batch_count; b++)
+    {
+        amplapack_getrf(m, n, cast(a_ref.data() + b*stride_a), lda, ipiv_ref.data() + b*k, &info);
+        match = match && (info_array[b] == info);
+
+        if (info == 0)
+        {
+            match = match && std::equal(ipiv.begin() + b*k, ipiv.begin() + (b+1)*k, ipiv_ref.begin() + b*k);
+            error = std::max(error, batch_difference(m, n, a, a_ref, lda, stride_a, 1, b));
+        }
+    }
+
+    std::cout << (match ? "Success!" : "Mismatch!") << " Error = " << error << " Time = " << sec << "s" << std::endl;
+}
+
+template <typename value_type>
+void do_potrf_batched_test(char uplo, int n, int batch_count)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "POTRF_BATCHED for UPLO=" << uplo << " N=" << n << " BATCH=" << batch_count << "... ";
+
+    // performance timer
+    high_resolution_timer timer;
+
+    // create data (one allocation per matrix)
+    int lda = n;
+    std::vector<std::vector<value_type>> a(batch_count, std::vector<value_type>(lda*n));
+    std::vector<value_type*> a_array(batch_count);
+    std::vector<int> info_array(batch_count, -1);
+
+    for (int b = 0; b < batch_count; b++)
+    {
+        // diagonally dominant hermitian matrices
+        for (int j = 0; j < n; j++)
+        {
+            for (int i = 0; i < j; i++)
+            {
+                value_type val = random_value(value_type(0), value_type(1));
+                a[b][j*lda+i] = val;
+                a[b][i*lda+j] = conjugate(val);
+            }
+
+            a[b][j*lda+j] = value_type(typename ampblas::real_type<value_type>::type(n));
+        }
+
+        a_array[b] = a[b].data();
+    }
+
+    // the last matrix is not positive definite
+    a[batch_count-1][(n/2)*lda+(n/2)] = value_type(-1);
+
+    std::vector<std::vector<value_type>> a_ref(a);
+
+    int info;
+
+    timer.restart();
+    amplapack_status status = amplapack_potrf_batched(uplo, n, cast(a_array.data()), lda, info_array.data(), batch_count, &info);
+    double sec = timer.elapsed();
+
+    if (!batch_status(status, info))
+        return;
+
+    // each matrix on its own
+    typename ampblas::real_type<value_type>::type error = 0;
+    bool match = true;
+
+    for (int b = 0; b < batch_count; b++)
+    {
+        amplapack_potrf(uplo, n, cast(a_ref[b].data()), lda, &info);
+        match = match && (info_array[b] == info);
+
+        if (info == 0)
+            error = std::max(error, batch_difference(n, n, a[b], a_ref[b], lda, lda*n, 1));
+    }
+
+    std::cout << (match ? "Success!" : "Mismatch!") << " Error = " << error << " Time = " << sec << "s" << std::endl;
+}
+
+template <typename value_type>
+void do_geqrf_batched_test(int m, int n, int batch_count)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GEQRF_BATCHED for M=" << m << " N=" << n << " BATCH=" << batch_count << "... ";
+
+    // performance timer
+    high_resolution_timer timer;
+
+    // create data
+    int k = std::min(m,n);
+    int lda = m;
+    int stride_a = lda*n;
+    std::vector<value_type> a(stride_a*batch_count);
+    std::vector<value_type> tau(k*batch_count);
+    std::vector<int> info_array(batch_count, -1);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> a_ref(a);
+    std::vector<value_type> tau_ref(tau);
+
+    int info;
+
+    timer.restart();
+    amplapack_status status = amplapack_geqrf_strided_batched(m, n, cast(a.data()), lda, stride_a, cast(tau.data()), k, info_array.data(), batch_count, &info);
+    double sec = timer.elapsed();
+
+    if (!batch_status(status, info))
+        return;
+
+    // each matrix on its own
+    bool match = true;
+
+    for (int b = 0; b < batch_count; b++)
+    {
+        amplapack_geqrf(m, n, cast(a_ref.data() + b*stride_a), lda, cast(tau_ref.data() + b*k), &info);
+        match = match && (info_array[b] == info);
+    }
+
+    typedef typename ampblas::real_type<value_type>::type real_type;
+    real_type error = batch_difference(m, n, a, a_ref, lda, stride_a, batch_count);
+    real_type tau_error = batch_difference(k, 1, tau, tau_ref, k, k, batch_count);
+
+    // the batched kernel and the blocked routine round differently; the one-norm of the
+    // difference grows with both dimensions
+    const real_type tolerance = real_type(100) * m * n * std::numeric_limits<real_type>::epsilon();
+    match = match && error <= tolerance && tau_error <= tolerance;
+
+    std::cout << (match ? "Success!" : "Mismatch!") << " Error = " << error << " Tau Error = " << tau_error << " Time = " << sec << "s" << std::endl;
+}
+
+void batched_test()
+{
+    do_getrf_batched_test<float>(16, 16, 1000);
+    do_getrf_batched_test<fcomplex>(24, 16, 100);
+
+    do_potrf_batched_test<float>('L', 16, 1000);
+    do_potrf_batched_test<float>('U', 32, 100);
+
+    do_geqrf_batched_test<float>(24, 12, 1000);
+}
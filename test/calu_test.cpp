@@ -0,0 +1,123 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "amplapack_test.h"
+
+// the context options
+#include "amplapack.h"
+
+using amplapack::context;
+
+// p * a = l * u must hold for the factors of the tournament, whose pivots differ from those
+// of partial pivoting
+template <typename value_type>
+void do_calu_test(context& ctx, int m, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GETRF with tournament pivoting for M=" << m << " N=" << n << "... ";
+
+    // create data
+    int k = std::min(m,n);
+    std::vector<value_type> a(m*n);
+    std::vector<int> ipiv(k);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> a_in(a);
+
+    ctx.set_panel_pivoting(amplapack::panel_pivoting::tournament);
+
+    try
+    {
+        amplapack::getrf(ctx, m, n, a.data(), m, ipiv.data());
+        ctx.set_panel_pivoting(amplapack::panel_pivoting::partial);
+    }
+    catch(const amplapack::data_error_exception& e)
+    {
+        ctx.set_panel_pivoting(amplapack::panel_pivoting::partial);
+        std::cout << "Failed (data error " << e.get() << ")" << std::endl;
+        return;
+    }
+
+    // p * a
+    for (int i = 0; i < k; i++)
+        for (int j = 0; j < n; j++)
+            std::swap(a_in[j*m+i], a_in[j*m+ipiv[i]-1]);
+
+    // l * u against p * a, and the largest multiplier
+    double error = 0;
+    double multiplier = 0;
+
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < m; i++)
+        {
+            value_type lu = value_type(0);
+
+            for (int l = 0; l <= std::min(i,j); l++)
+                lu += (l == i ? value_type(1) : a[l*m+i]) * a[j*m+l];
+
+            error = std::max(error, double(abs(lu - a_in[j*m+i])));
+
+            if (i > j)
+                multiplier = std::max(multiplier, double(abs(a[j*m+i])));
+        }
+    }
+
+    std::cout << "Success! Difference = " << error << ", largest multiplier = " << multiplier << std::endl;
+}
+
+// a zero column makes the top block singular; the panel falls back to partial pivoting and
+// reports the same data error
+void do_calu_singular_test(context& ctx, int m, int n, int zero_column)
+{
+    // header
+    std::cout << "Testing SGETRF with tournament pivoting and column " << zero_column << " zero... ";
+
+    std::vector<float> a(m*n);
+    std::vector<int> ipiv(n);
+
+    std::for_each(a.begin(), a.end(), [&](float& val) {
+        val = random_value(-1.0f, 1.0f);
+    });
+
+    std::fill(a.begin() + (zero_column-1)*m, a.begin() + zero_column*m, 0.0f);
+
+    ctx.set_panel_pivoting(amplapack::panel_pivoting::tournament);
+
+    try
+    {
+        amplapack::getrf(ctx, m, n, a.data(), m, ipiv.data());
+    }
+    catch(const amplapack::data_error_exception& e)
+    {
+        ctx.set_panel_pivoting(amplapack::panel_pivoting::partial);
+
+        if (static_cast<int>(e.get()) == zero_column)
+            std::cout << "Success!" << std::endl;
+        else
+            std::cout << "Failed (data error " << e.get() << ")" << std::endl;
+
+        return;
+    }
+
+    ctx.set_panel_pivoting(amplapack::panel_pivoting::partial);
+    std::cout << "Failed (no data error)" << std::endl;
+}
+
+void calu_test()
+{
+    context ctx(concurrency::accelerator().default_view);
+
+    // a single tall panel, two panels (the second too short for a tournament) and more
+    // blocks than one level of the tournament takes
+    do_calu_test<float>(ctx, 20000, 256);
+    do_calu_test<double>(ctx, 8300, 400);
+    do_calu_test<float>(ctx, 300000, 64);
+    do_calu_test<dcomplex>(ctx, 10000, 128);
+
+    do_calu_singular_test(ctx, 20000, 64, 5);
+}
@@ -0,0 +1,154 @@
+#include <vector>
+#include <algorithm>
+#include <climits>
+#include <iostream>
+#include <limits>
+
+#include "amplapack_test.h"
+#include "ampxlapack.h"
+
+// backward error of the factors of getrf, relative to the infinity norm of a: |p*a*x - l*u*x|
+// for a random x, which must stay within a small multiple of n*eps
+template <typename value_type>
+double getrf_backward_error(int n, const std::vector<value_type>& a, const std::vector<value_type>& lu, const std::vector<int>& ipiv)
+{
+    std::vector<value_type> x(n), ux(n), lux(n), ax(n, value_type());
+
+    std::for_each(x.begin(), x.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    // u * x, then l * (u * x) with the unit diagonal of l
+    for (int i = 0; i < n; i++)
+    {
+        ux[i] = value_type();
+        for (int j = i; j < n; j++)
+            ux[i] += lu[j*n+i] * x[j];
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        lux[i] = ux[i];
+        for (int j = 0; j < i; j++)
+            lux[i] += lu[j*n+i] * ux[j];
+    }
+
+    // p * a * x, and the infinity norms of a and x
+    double norm_a = 0;
+    double norm_x = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        double row = 0;
+
+        for (int j = 0; j < n; j++)
+        {
+            ax[i] += a[j*n+i] * x[j];
+            row += abs(a[j*n+i]);
+        }
+
+        norm_a = std::max(norm_a, row);
+        norm_x = std::max(norm_x, double(abs(x[i])));
+    }
+
+    for (int i = 0; i < n; i++)
+        std::swap(ax[i], ax[ipiv[i]-1]);
+
+    double residual = 0;
+    for (int i = 0; i < n; i++)
+        residual = std::max(residual, double(abs(ax[i] - lux[i])));
+
+    return residual / (n * norm_a * norm_x);
+}
+
+// times GETRF on each execution target; the fastest target per size guides the crossovers
+template <typename value_type>
+void do_dispatch_test(int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GETRF dispatch for N=" << n << "... ";
+
+    // performance timer
+    high_resolution_timer timer;
+
+    // create data
+    std::vector<value_type> a_in(n*n);
+    std::vector<int> ipiv(n);
+
+    std::for_each(a_in.begin(), a_in.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    for (int i = 0; i < (n*n); i += (n+1))
+        a_in[i] = random_value(value_type(1), value_type(2));
+
+    // keep the configured crossovers
+    const char precision = type_prefix<value_type>();
+    int host_crossover, accelerator_crossover;
+    amplapack_get_crossover(amplapack_getrf_routine, precision, &host_crossover, &accelerator_crossover);
+
+    // host, hybrid and accelerator in turn
+    const int host_limits[] = { INT_MAX, 0, 0 };
+    const int accelerator_limits[] = { INT_MAX, INT_MAX, 0 };
+    const char* names[] = { "Host", "Hybrid", "Accelerator" };
+
+    typedef typename ampblas::real_type<value_type>::type real_type;
+    const double tolerance = 100 * std::numeric_limits<real_type>::epsilon();
+
+    double sec[3];
+    double error = 0;
+    int info = 0;
+    bool match = true;
+
+    for (int t = 0; t < 3; t++)
+    {
+        amplapack_set_crossover(amplapack_getrf_routine, precision, host_limits[t], accelerator_limits[t]);
+
+        std::vector<value_type> a(a_in);
+
+        timer.restart();
+        amplapack_status status = amplapack_getrf(n, n, cast(a.data()), n, ipiv.data(), &info);
+        sec[t] = timer.elapsed();
+
+        if (status != amplapack_success)
+        {
+            std::cout << names[t] << " failed with status " << status << " info " << info << std::endl;
+            match = false;
+            break;
+        }
+
+        // every target must factor a backward stably
+        error = std::max(error, getrf_backward_error(n, a_in, a, ipiv));
+        match = match && (error <= tolerance);
+    }
+
+    amplapack_set_crossover(amplapack_getrf_routine, precision, host_crossover, accelerator_crossover);
+
+    if (match)
+    {
+        std::cout << "Success! Backward Error = " << error;
+        for (int t = 0; t < 3; t++)
+            std::cout << " " << names[t] << " = " << sec[t] << "s";
+        std::cout << std::endl;
+    }
+    else
+    {
+        std::cout << "Mismatch! Backward Error = " << error << std::endl;
+    }
+}
+
+void dispatch_test()
+{
+    // argument checking
+    int host_crossover, accelerator_crossover;
+    bool rejected = (amplapack_set_crossover(amplapack_getrf_routine, 'Q', 0, 0) == amplapack_argument_error) &&
+                    (amplapack_set_crossover(amplapack_potrf_routine, 'S', -1, 0) == amplapack_argument_error) &&
+                    (amplapack_get_crossover(amplapack_geqrf_routine, 'd', &host_crossover, nullptr) == amplapack_argument_error);
+    std::cout << "Testing crossover arguments... " << (rejected ? "Success!" : "Failed!") << std::endl;
+
+    // timings around the default crossovers
+    do_dispatch_test<float>(128);
+    do_dispatch_test<float>(512);
+    do_dispatch_test<float>(1024);
+    do_dispatch_test<fcomplex>(256);
+}
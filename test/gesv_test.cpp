@@ -0,0 +1,161 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <climits>
+#include <limits>
+
+#include "amplapack_test.h"
+#include "ampxlapack.h"
+
+// random n by n matrix with a dominant diagonal and an n by nrhs right hand side
+template <typename value_type>
+void make_system(int n, int nrhs, std::vector<value_type>& a, std::vector<value_type>& b)
+{
+    a.resize(n*n);
+    b.resize(n*nrhs);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    for (int i = 0; i < (n*n); i += (n+1))
+        a[i] = random_value(value_type(1), value_type(2));
+
+    std::for_each(b.begin(), b.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+}
+
+template <typename value_type>
+void do_gesv_test(int n, int nrhs)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GESV for N=" << n << " NRHS=" << nrhs << "... ";
+
+    // create data
+    std::vector<value_type> a, b;
+    std::vector<int> ipiv(n);
+    make_system(n, nrhs, a, b);
+
+    std::vector<value_type> a_in(a), b_in(b);
+
+    int info = -1;
+    amplapack_status status = amplapack_gesv(n, nrhs, cast(a.data()), n, ipiv.data(), cast(b.data()), n, &info);
+
+    report_solve(status, info, backward_error(n, nrhs, a_in, b_in, b));
+}
+
+// an exactly singular matrix (column bad is zero) must report info = bad+1 and, as LAPACK, still 
+// return its LU factors and pivots, with b left as it was; the crossovers are lifted so the 
+// matrix is factored on the accelerator
+template <typename value_type>
+void do_gesv_singular_test(int n, int nrhs, int bad)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GESV singular for N=" << n << " NRHS=" << nrhs << " COLUMN=" << bad << "... ";
+
+    // create data
+    std::vector<value_type> a, b;
+    std::vector<int> ipiv(n, 0);
+    make_system(n, nrhs, a, b);
+
+    for (int i = 0; i < n; i++)
+        a[bad*n+i] = value_type();
+
+    std::vector<value_type> a_in(a), b_in(b);
+
+    const char precision = type_prefix<value_type>();
+    int host_crossover, accelerator_crossover;
+    amplapack_get_crossover(amplapack_getrf_routine, precision, &host_crossover, &accelerator_crossover);
+    amplapack_set_crossover(amplapack_getrf_routine, precision, 0, INT_MAX);
+
+    int info = -1;
+    amplapack_status status = amplapack_gesv(n, nrhs, cast(a.data()), n, ipiv.data(), cast(b.data()), n, &info);
+
+    amplapack_set_crossover(amplapack_getrf_routine, precision, host_crossover, accelerator_crossover);
+
+    if (status != amplapack_data_error || info != bad+1)
+    {
+        std::cout << "Failed with status " << status << " info " << info << std::endl;
+        return;
+    }
+
+    // every pivot is a row of a
+    bool pivots = std::all_of(ipiv.begin(), ipiv.end(), [=](int p) { return p >= 1 && p <= n; });
+
+    // p*a = l*u
+    laswp(n, a_in.data(), n, 1, n, ipiv.data(), 1);
+
+    std::vector<value_type> l(a);
+    std::vector<value_type>& u = a;
+
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if (j > i)
+                l[j*n+i] = value_type();
+
+            if (j == i)
+                l[j*n+i] = value_type(1);
+
+            if (j < i)
+                u[j*n+i] = value_type();
+        }
+    }
+
+    const double a_norm = one_norm(n, n, a_in.data(), n);
+
+    gemm('n', 'n', n, n, n, value_type(1), l.data(), n, u.data(), n, value_type(-1), a_in.data(), n);
+
+    const double error = one_norm(n, n, a_in.data(), n) / (a_norm * n * std::numeric_limits<real_type>::epsilon());
+
+    if (!pivots)
+        std::cout << "Failed! Pivots out of range" << std::endl;
+    else if (error > 100)
+        std::cout << "Failed! Factor Error = " << error << std::endl;
+    else if (max_difference(n, nrhs, b, b_in, n) != 0)
+        std::cout << "Failed! B was modified" << std::endl;
+    else
+        std::cout << "Success! Factor Error = " << error << std::endl;
+}
+
+template <typename value_type>
+void do_getrs_test(char trans, int n, int nrhs)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GETRS for TRANS=" << trans << " N=" << n << " NRHS=" << nrhs << "... ";
+
+    // create data
+    std::vector<value_type> a, b;
+    std::vector<int> ipiv(n);
+    make_system(n, nrhs, a, b);
+
+    std::vector<value_type> a_in(a), b_in(b);
+
+    int info = -1;
+    amplapack_status status = amplapack_getrf(n, n, cast(a.data()), n, ipiv.data(), &info);
+
+    if (status == amplapack_success)
+        status = amplapack_getrs(trans, n, nrhs, cast(a.data()), n, ipiv.data(), cast(b.data()), n, &info);
+
+    report_solve(status, info, backward_error(n, nrhs, a_in, b_in, b, trans));
+}
+
+void gesv_test()
+{
+    do_gesv_test<float>(1024, 1);
+    do_gesv_test<float>(1000, 33);
+    do_gesv_test<fcomplex>(1000, 8);
+
+    // singular matrices still return their factors
+    do_gesv_singular_test<float>(1000, 4, 600);
+    do_gesv_singular_test<fcomplex>(1000, 4, 100);
+
+    // the transposed solves apply the interchanges in reverse
+    do_getrs_test<float>('N', 1000, 8);
+    do_getrs_test<float>('T', 1000, 8);
+    do_getrs_test<fcomplex>('C', 1000, 8);
+}
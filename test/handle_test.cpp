@@ -0,0 +1,129 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "amplapack_test.h"
+#include "ampxlapack.h"
+
+template <typename value_type>
+void do_handle_test(amplapack_handle handle, int n, int iterations)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GETRF with a handle for N=" << n << " x" << iterations << "... ";
+
+    // performance timer
+    high_resolution_timer timer;
+
+    // create data
+    std::vector<value_type> a_in(n*n);
+    std::vector<int> ipiv(n);
+
+    // fill with random values
+    std::for_each(a_in.begin(), a_in.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    // adjust diagonal for stability
+    for (int i = 0; i < (n*n); i += (n+1))
+        a_in[i] = random_value(value_type(1), value_type(2));
+
+    int info;
+    amplapack_status status = amplapack_success;
+
+    // without a handle
+    std::vector<value_type> a_default(a_in);
+
+    timer.restart();
+    for (int i = 0; i < iterations && status == amplapack_success; i++)
+    {
+        std::copy(a_in.begin(), a_in.end(), a_default.begin());
+        status = amplapack_getrf(n, n, cast(a_default.data()), n, ipiv.data(), &info);
+    }
+    double sec_default = timer.elapsed();
+
+    // with a handle
+    std::vector<value_type> a_handle(a_in);
+
+    timer.restart();
+    for (int i = 0; i < iterations && status == amplapack_success; i++)
+    {
+        std::copy(a_in.begin(), a_in.end(), a_handle.begin());
+        status = amplapack_getrf(handle, n, n, cast(a_handle.data()), n, ipiv.data(), &info);
+    }
+    double sec_handle = timer.elapsed();
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed with status " << status << " info " << info << std::endl;
+        return;
+    }
+
+    // both paths run the same algorithm and must agree exactly
+    bool match = std::equal(a_default.begin(), a_default.end(), a_handle.begin());
+    std::cout << (match ? "Success!" : "Mismatch!") << " Default = " << sec_default << "s Handle = " << sec_handle << "s" << std::endl;
+}
+
+template <typename value_type>
+void do_transfer_test(amplapack_handle handle, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GETRF transfer volume for N=" << n << "... ";
+
+    std::vector<value_type> a(n*n);
+    std::vector<int> ipiv(n);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    for (int i = 0; i < (n*n); i += (n+1))
+        a[i] = random_value(value_type(1), value_type(2));
+
+    int info;
+    size_t to_host = 0;
+    size_t to_accelerator = 0;
+
+    if (amplapack_getrf(handle, n, n, cast(a.data()), n, ipiv.data(), &info) != amplapack_success ||
+        amplapack_get_transfer_bytes(handle, &to_host, &to_accelerator) != amplapack_success)
+    {
+        std::cout << "Failed" << std::endl;
+        return;
+    }
+
+    // the matrix moves once each way and each panel makes one round trip, so both directions carry
+    // the same volume, between one and two times the size of the matrix
+    const double matrix_bytes = double(n) * double(n) * sizeof(value_type);
+    bool ok = (to_host == to_accelerator) && (to_host >= matrix_bytes) && (to_host <= 2*matrix_bytes);
+
+    std::cout << (ok ? "Success!" : "Unexpected!") << " To Host = " << to_host << " To Accelerator = " << to_accelerator << " (" << to_host / matrix_bytes << "x matrix)" << std::endl;
+}
+
+void handle_test()
+{
+    amplapack_handle handle;
+
+    if (amplapack_create_handle(&handle) != amplapack_success)
+    {
+        std::cout << "Testing handle creation... Failed" << std::endl;
+        return;
+    }
+
+    // preallocate device memory for the largest problem
+    size_t size = 0;
+    amplapack_cgetrf_workspace(64, 64, &size);
+
+    std::cout << "Testing workspace reservation of " << size << " bytes... ";
+    std::cout << (amplapack_reserve_workspace(handle, size) == amplapack_success ? "Success!" : "Failed") << std::endl;
+
+    // many small calls are dominated by per-call setup
+    do_handle_test<float>(handle, 64, 100);
+    do_handle_test<fcomplex>(handle, 64, 100);
+
+    // bytes moved by the last call
+    do_transfer_test<float>(handle, 1000);
+
+    std::cout << "Testing workspace trim... ";
+    std::cout << (amplapack_trim_workspace(handle) == amplapack_success ? "Success!" : "Failed") << std::endl;
+
+    amplapack_destroy_handle(handle);
+}
@@ -0,0 +1,177 @@
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include "amplapack_test.h"
+
+// the array view interface
+#include "amplapack.h"
+
+using amplapack::ordering;
+using amplapack::block_factor_location;
+
+// the factors of the accelerator panels must match those of the host (LAPACK) panels up to
+// rounding, which grows with the order
+template <typename value_type>
+double location_tolerance(int n)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+    return 100.0 * n * std::numeric_limits<real_type>::epsilon();
+}
+
+// factors a with panels on the given location
+template <typename value_type, block_factor_location location>
+void getrf_at(int m, int n, std::vector<value_type>& a, std::vector<int>& ipiv)
+{
+    amplapack::context ctx(concurrency::accelerator().default_view);
+    concurrency::array_view<value_type,2> view_a(n, m, a);
+    concurrency::array_view<int,1> view_ipiv(std::min(m,n), ipiv);
+    amplapack::getrf<ordering::column_major, location>(ctx, view_a, view_ipiv);
+    view_a.synchronize();
+    view_ipiv.synchronize();
+}
+
+template <typename value_type, block_factor_location location>
+void potrf_at(char uplo, int n, std::vector<value_type>& a)
+{
+    amplapack::context ctx(concurrency::accelerator().default_view);
+    concurrency::array_view<value_type,2> view_a(n, n, a);
+    amplapack::potrf<ordering::column_major, location>(ctx, amplapack::to_option(uplo), view_a);
+    view_a.synchronize();
+}
+
+template <typename value_type, block_factor_location location>
+void geqrf_at(int m, int n, std::vector<value_type>& a, std::vector<value_type>& tau)
+{
+    amplapack::context ctx(concurrency::accelerator().default_view);
+    concurrency::array_view<value_type,2> view_a(n, m, a);
+    concurrency::array_view<value_type,1> view_tau(std::min(m,n), tau);
+    amplapack::geqrf<ordering::column_major, location>(ctx, view_a, view_tau);
+    view_a.synchronize();
+    view_tau.synchronize();
+}
+
+template <typename value_type>
+void do_getrf_location_test(int m, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GETRF with accelerator panels for M=" << m << " N=" << n << "... ";
+
+    // create data
+    int k = std::min(m,n);
+    std::vector<value_type> a_host(m*n);
+    std::vector<int> ipiv_host(k), ipiv_accl(k);
+
+    std::for_each(a_host.begin(), a_host.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> a_accl(a_host);
+
+    getrf_at<value_type, block_factor_location::host>(m, n, a_host, ipiv_host);
+    getrf_at<value_type, block_factor_location::accelerator>(m, n, a_accl, ipiv_accl);
+
+    bool match = std::equal(ipiv_host.begin(), ipiv_host.end(), ipiv_accl.begin());
+    double error = max_difference(m, n, a_host, a_accl, m);
+
+    if (!match)
+        std::cout << "Pivot Mismatch!" << std::endl;
+    else if (error > location_tolerance<value_type>(n))
+        std::cout << "Failed! Difference = " << error << std::endl;
+    else
+        std::cout << "Success! Difference = " << error << std::endl;
+}
+
+template <typename value_type>
+void do_potrf_location_test(char uplo, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "POTRF with accelerator panels for UPLO=" << uplo << " N=" << n << "... ";
+
+    // create data (hermitian with a dominant diagonal)
+    std::vector<value_type> a_host(n*n);
+
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < j; i++)
+        {
+            value_type val = random_value(value_type(0), value_type(1));
+            a_host[j*n+i] = val;
+            a_host[i*n+j] = conjugate(val);
+        }
+
+        a_host[j*n+j] = value_type(typename ampblas::real_type<value_type>::type(n));
+    }
+
+    std::vector<value_type> a_accl(a_host);
+
+    potrf_at<value_type, block_factor_location::host>(uplo, n, a_host);
+    potrf_at<value_type, block_factor_location::accelerator>(uplo, n, a_accl);
+
+    // only the referenced triangle is compared
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if ((uplo == 'L' && i < j) || (uplo == 'U' && i > j))
+            {
+                a_host[j*n+i] = value_type();
+                a_accl[j*n+i] = value_type();
+            }
+        }
+    }
+
+    double error = max_difference(n, n, a_host, a_accl, n);
+
+    // the factor grows as the square root of the diagonal
+    if (error > location_tolerance<value_type>(n) * std::sqrt(double(n)))
+        std::cout << "Failed! Difference = " << error << std::endl;
+    else
+        std::cout << "Success! Difference = " << error << std::endl;
+}
+
+template <typename value_type>
+void do_geqrf_location_test(int m, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GEQRF with accelerator panels for M=" << m << " N=" << n << "... ";
+
+    // create data
+    int k = std::min(m,n);
+    std::vector<value_type> a_host(m*n);
+    std::vector<value_type> tau_host(k), tau_accl(k);
+
+    std::for_each(a_host.begin(), a_host.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> a_accl(a_host);
+
+    geqrf_at<value_type, block_factor_location::host>(m, n, a_host, tau_host);
+    geqrf_at<value_type, block_factor_location::accelerator>(m, n, a_accl, tau_accl);
+
+    double error = std::max(max_difference(m, n, a_host, a_accl, m), max_difference(k, 1, tau_host, tau_accl, k));
+
+    if (error > location_tolerance<value_type>(m))
+        std::cout << "Failed! Difference = " << error << std::endl;
+    else
+        std::cout << "Success! Difference = " << error << std::endl;
+}
+
+void location_test()
+{
+    // sizes span several panels with a partial last one
+    do_getrf_location_test<float>(600, 520);
+    do_getrf_location_test<double>(700, 700);
+    do_getrf_location_test<fcomplex>(520, 600);
+
+    do_potrf_location_test<float>('L', 600);
+    do_potrf_location_test<double>('U', 700);
+    do_potrf_location_test<dcomplex>('L', 520);
+
+    do_geqrf_location_test<float>(600, 520);
+    do_geqrf_location_test<double>(700, 700);
+    do_geqrf_location_test<fcomplex>(520, 600);
+}
@@ -0,0 +1,144 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "amplapack_test.h"
+#include "ampxlapack.h"
+
+// host GEMM used for reconstruction
+#include "lapack_host.h"
+
+// the device matrix routines that only take matrices, selected by the value type
+inline amplapack_status getrf_m(float, amplapack_matrix a, int* ipiv, int* info) { return amplapack_sgetrf_m(a, ipiv, info); }
+inline amplapack_status getrf_m(dcomplex, amplapack_matrix a, int* ipiv, int* info) { return amplapack_zgetrf_m(a, ipiv, info); }
+inline amplapack_status getrs_m(float, char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b, int* info) { return amplapack_sgetrs_m(trans, a, ipiv, b, info); }
+inline amplapack_status getrs_m(dcomplex, char trans, amplapack_matrix a, const int* ipiv, amplapack_matrix b, int* info) { return amplapack_zgetrs_m(trans, a, ipiv, b, info); }
+inline amplapack_status potrf_m(float, char uplo, amplapack_matrix a, int* info) { return amplapack_spotrf_m(uplo, a, info); }
+inline amplapack_status potrf_m(dcomplex, char uplo, amplapack_matrix a, int* info) { return amplapack_zpotrf_m(uplo, a, info); }
+inline amplapack_status potrs_m(float, char uplo, amplapack_matrix a, amplapack_matrix b, int* info) { return amplapack_spotrs_m(uplo, a, b, info); }
+inline amplapack_status potrs_m(dcomplex, char uplo, amplapack_matrix a, amplapack_matrix b, int* info) { return amplapack_zpotrs_m(uplo, a, b, info); }
+
+// the factors stay on the accelerator between the factorization and the solves; only x is 
+// downloaded once at the end
+template <typename value_type>
+void do_matrix_solve_test(amplapack_handle handle, char routine, int n, int nrhs)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << (routine == 'G' ? "GETRF/GETRS" : "POTRF/POTRS") << " on device matrices for N=" << n << " NRHS=" << nrhs << "... ";
+
+    // create data
+    std::vector<value_type> a(n*n);
+    std::vector<value_type> b(n*nrhs);
+    std::vector<int> ipiv(n);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::for_each(b.begin(), b.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    // diagonally dominant and Hermitian, so that either factorization applies
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < j; i++)
+            a[j*n+i] = conjugate(a[i*n+j]);
+
+    for (int i = 0; i < n; i++)
+        a[i*n+i] = value_type(typename ampblas::real_type<value_type>::type(n));
+
+    std::vector<value_type> x(b);
+
+    int info;
+    amplapack_matrix accl_a = nullptr;
+    amplapack_matrix accl_b = nullptr;
+
+    amplapack_status status = amplapack_create_matrix(handle, n, n, cast(a.data()), n, &accl_a, &info);
+
+    if (status == amplapack_success)
+        status = amplapack_create_matrix(handle, n, nrhs, cast(b.data()), n, &accl_b, &info);
+
+    if (status == amplapack_success)
+    {
+        if (routine == 'G')
+        {
+            status = getrf_m(value_type(), accl_a, ipiv.data(), &info);
+
+            if (status == amplapack_success)
+                status = getrs_m(value_type(), 'N', accl_a, ipiv.data(), accl_b, &info);
+        }
+        else
+        {
+            status = potrf_m(value_type(), 'L', accl_a, &info);
+
+            if (status == amplapack_success)
+                status = potrs_m(value_type(), 'L', accl_a, accl_b, &info);
+        }
+    }
+
+    // the transfers of the solve alone; the factors never leave the accelerator
+    size_t to_host = 0, to_accelerator = 0;
+    amplapack_get_transfer_bytes(handle, &to_host, &to_accelerator);
+
+    if (status == amplapack_success)
+        status = amplapack_get_matrix(accl_b, cast(x.data()), n, &info);
+
+    amplapack_destroy_matrix(accl_a);
+    amplapack_destroy_matrix(accl_b);
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+        return;
+    }
+
+    // b = b - a*x
+    gemm('n', 'n', n, nrhs, n, value_type(-1), a.data(), n, x.data(), n, value_type(1), b.data(), n);
+
+    std::cout << "Success! Error = " << one_norm(n, nrhs, b.data(), n) << " Solve bytes to host = " << to_host << std::endl;
+}
+
+// a matrix of one precision must be rejected by the routines of another
+void do_matrix_precision_test(amplapack_handle handle)
+{
+    // header
+    std::cout << "Testing device matrix precision mismatch... ";
+
+    const int n = 16;
+    std::vector<float> a(n*n, 1.0f);
+    std::vector<int> ipiv(n);
+
+    int info;
+    amplapack_matrix accl_a = nullptr;
+
+    amplapack_status status = amplapack_screate_matrix(handle, n, n, cast(a.data()), n, &accl_a, &info);
+
+    if (status == amplapack_success)
+        status = amplapack_dgetrf_m(accl_a, ipiv.data(), &info);
+
+    amplapack_destroy_matrix(accl_a);
+
+    if (status == amplapack_argument_error && info == -1)
+        std::cout << "Success!" << std::endl;
+    else
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+}
+
+void matrix_test()
+{
+    amplapack_handle handle;
+    if (amplapack_create_handle(&handle) != amplapack_success)
+    {
+        std::cout << "Failed to create handle" << std::endl;
+        return;
+    }
+
+    do_matrix_solve_test<float>(handle, 'G', 1000, 10);
+    do_matrix_solve_test<dcomplex>(handle, 'G', 600, 3);
+    do_matrix_solve_test<float>(handle, 'P', 1000, 10);
+    do_matrix_solve_test<dcomplex>(handle, 'P', 600, 3);
+
+    do_matrix_precision_test(handle);
+
+    amplapack_destroy_handle(handle);
+}
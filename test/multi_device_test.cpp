@@ -0,0 +1,174 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <functional>
+
+#include "amplapack_test.h"
+
+// the context group interface
+#include "amplapack.h"
+
+// host GEMM used for reconstruction
+#include "lapack_host.h"
+
+using amplapack::context;
+using amplapack::context_group;
+
+// several views on one accelerator stand in for several accelerators; WARP runs on the CPU
+std::vector<concurrency::accelerator_view> make_views(int count)
+{
+    concurrency::accelerator accl(concurrency::accelerator::direct3d_warp);
+
+    std::vector<concurrency::accelerator> all = concurrency::accelerator::get_all();
+    bool has_warp = std::any_of(all.begin(), all.end(), [&](const concurrency::accelerator& a) { return a == accl; });
+
+    if (!has_warp)
+        accl = concurrency::accelerator();
+
+    std::vector<concurrency::accelerator_view> views;
+    for (int i = 0; i < count; i++)
+        views.push_back(accl.create_view());
+
+    return views;
+}
+
+// runs f and reports any amplapack error; the C++ interface throws instead of returning a status
+bool succeeded(const std::function<void()>& f)
+{
+    try
+    {
+        f();
+        return true;
+    }
+    catch(const amplapack::argument_error_exception& e)
+    {
+        std::cout << "Failed (argument " << e.get() << ")" << std::endl;
+    }
+    catch(const amplapack::data_error_exception& e)
+    {
+        std::cout << "Failed (data error " << e.get() << ")" << std::endl;
+    }
+    catch(const amplapack::runtime_error_exception&)
+    {
+        std::cout << "Failed (runtime error)" << std::endl;
+    }
+
+    return false;
+}
+
+template <typename value_type>
+void do_getrf_multi_device_test(context_group& group, int m, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GETRF on " << group.size() << " devices for M=" << m << " N=" << n << "... ";
+
+    // create data
+    int k = std::min(m,n);
+    int lda = m;
+    std::vector<value_type> a(lda*n);
+    std::vector<int> ipiv(k);
+
+    // fill with random values
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    // backup a for reconstruction purposes
+    std::vector<value_type> a_in(a);
+
+    if (!succeeded([&] { amplapack::getrf(group, m, n, a.data(), lda, ipiv.data()); }))
+        return;
+
+    // swap on a
+    laswp(n, a_in.data(), lda, 1, k, ipiv.data(), 1);
+
+    // extract l (m by k) and u (k by n)
+    std::vector<value_type> l(m*k);
+    std::vector<value_type> u(k*n);
+
+    for (int j = 0; j < k; j++)
+        for (int i = 0; i < m; i++)
+            l[j*m+i] = (j < i ? a[j*lda+i] : value_type(j == i ? 1 : 0));
+
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < k; i++)
+            u[j*k+i] = (j >= i ? a[j*lda+i] : value_type());
+
+    // a = a - l*u
+    gemm('n', 'n', m, n, k, value_type(1), l.data(), m, u.data(), k, value_type(-1), a_in.data(), lda);
+
+    std::cout << "Success! Error = " << one_norm(m, n, a_in.data(), lda) << std::endl;
+}
+
+// the distributed factor must match the single device factor
+template <typename value_type>
+void do_potrf_multi_device_test(context_group& group, char uplo, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "POTRF on " << group.size() << " devices for UPLO=" << uplo << " N=" << n << "... ";
+
+    // create data
+    int lda = n;
+    std::vector<value_type> a(lda*n);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(0), value_type(1));
+    });
+
+    // diagonally dominant
+    for (int i = 0; i < (lda*n); i += (lda+1))
+        a[i] = value_type(ampblas::real_type<value_type>::type(n));
+
+    std::vector<value_type> a_single(a);
+
+    context ctx(group[0].get_view());
+
+    if (!succeeded([&] { amplapack::potrf(ctx, uplo, n, a_single.data(), lda); amplapack::potrf(group, uplo, n, a.data(), lda); }))
+        return;
+
+    std::cout << "Success! Difference = " << max_difference(n, n, a, a_single, lda) << std::endl;
+}
+
+// the distributed factor must match the single device factor
+template <typename value_type>
+void do_geqrf_multi_device_test(context_group& group, int m, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GEQRF on " << group.size() << " devices for M=" << m << " N=" << n << "... ";
+
+    // create data
+    int k = std::min(m,n);
+    int lda = m;
+    std::vector<value_type> a(lda*n);
+    std::vector<value_type> tau(k), tau_single(k);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> a_single(a);
+
+    context ctx(group[0].get_view());
+
+    if (!succeeded([&] { amplapack::geqrf(ctx, m, n, a_single.data(), lda, tau_single.data()); amplapack::geqrf(group, m, n, a.data(), lda, tau.data()); }))
+        return;
+
+    std::cout << "Success! Difference = " << max_difference(m, n, a, a_single, lda) << std::endl;
+}
+
+void multi_device_test()
+{
+    context_group group(make_views(3));
+
+    do_getrf_multi_device_test<float>(group, 1024, 1024);
+    do_getrf_multi_device_test<fcomplex>(group, 1024, 1024);
+
+    // partial last panel, more columns than rows
+    do_getrf_multi_device_test<float>(group, 700, 1000);
+
+    do_potrf_multi_device_test<float>(group, 'L', 1000);
+    do_potrf_multi_device_test<dcomplex>(group, 'U', 1000);
+
+    do_geqrf_multi_device_test<float>(group, 1000, 700);
+    do_geqrf_multi_device_test<double>(group, 1024, 1024);
+}
@@ -0,0 +1,173 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "amplapack_test.h"
+#include "ampxlapack.h"
+
+// host GEMM used for reconstruction
+#include "lapack_host.h"
+
+// workspace in bytes as a fraction of the size of an m by n matrix
+template <typename value_type>
+size_t get_workspace(int m, int n, double fraction)
+{
+    return static_cast<size_t>(fraction * m * n) * sizeof(value_type);
+}
+
+template <typename value_type>
+void do_getrf_ooc_test(int m, int n, double fraction)
+{
+    // header
+    std::cout << "Testing out of core " << type_prefix<value_type>() << "GETRF for M=" << m << " N=" << n << " with " << fraction << " of A... ";
+
+    // create data
+    int k = std::min(m,n);
+    int lda = m;
+    std::vector<value_type> a(lda*n);
+    std::vector<int> ipiv(k);
+
+    // fill with random values
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    // backup a for reconstruction purposes
+    std::vector<value_type> a_in(a);
+
+    int info;
+    amplapack_status status = amplapack_getrf_ooc(m, n, cast(a.data()), lda, ipiv.data(), get_workspace<value_type>(m, n, fraction), &info);
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+        return;
+    }
+
+    // swap on a
+    laswp(n, a_in.data(), lda, 1, k, ipiv.data(), 1);
+
+    // extract l (m by k) and u (k by n)
+    std::vector<value_type> l(m*k);
+    std::vector<value_type> u(k*n);
+
+    for (int j = 0; j < k; j++)
+        for (int i = 0; i < m; i++)
+            l[j*m+i] = (j < i ? a[j*lda+i] : value_type(j == i ? 1 : 0));
+
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < k; i++)
+            u[j*k+i] = (j >= i ? a[j*lda+i] : value_type());
+
+    // a = a - l*u
+    gemm('n', 'n', m, n, k, value_type(1), l.data(), m, u.data(), k, value_type(-1), a_in.data(), lda);
+
+    std::cout << "Success! Error = " << one_norm(m, n, a_in.data(), lda) << std::endl;
+}
+
+// the out of core factor must match the in core factor
+template <typename value_type>
+void do_potrf_ooc_test(char uplo, int n, double fraction)
+{
+    // header
+    std::cout << "Testing out of core " << type_prefix<value_type>() << "POTRF for UPLO=" << uplo << " N=" << n << " with " << fraction << " of A... ";
+
+    // create data
+    int lda = n;
+    std::vector<value_type> a(lda*n);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(0), value_type(1));
+    });
+
+    // diagonally dominant
+    for (int i = 0; i < (lda*n); i += (lda+1))
+        a[i] = value_type(ampblas::real_type<value_type>::type(n));
+
+    std::vector<value_type> a_in_core(a);
+
+    int info;
+    amplapack_status status = amplapack_potrf(uplo, n, cast(a_in_core.data()), lda, &info);
+
+    if (status == amplapack_success)
+        status = amplapack_potrf_ooc(uplo, n, cast(a.data()), lda, get_workspace<value_type>(n, n, fraction), &info);
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+        return;
+    }
+
+    std::cout << "Success! Difference = " << max_difference(n, n, a, a_in_core, lda) << std::endl;
+}
+
+// the out of core factor must match the in core factor
+template <typename value_type>
+void do_geqrf_ooc_test(int m, int n, double fraction)
+{
+    // header
+    std::cout << "Testing out of core " << type_prefix<value_type>() << "GEQRF for M=" << m << " N=" << n << " with " << fraction << " of A... ";
+
+    // create data
+    int lda = m;
+    std::vector<value_type> a(lda*n);
+    std::vector<value_type> tau(std::min(m,n));
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> a_in_core(a);
+    std::vector<value_type> tau_in_core(tau);
+
+    int info;
+    amplapack_status status = amplapack_geqrf(m, n, cast(a_in_core.data()), lda, cast(tau_in_core.data()), &info);
+
+    if (status == amplapack_success)
+        status = amplapack_geqrf_ooc(m, n, cast(a.data()), lda, cast(tau.data()), get_workspace<value_type>(m, n, fraction), &info);
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+        return;
+    }
+
+    std::cout << "Success! Difference = " << max_difference(m, n, a, a_in_core, lda) << std::endl;
+}
+
+// a workspace that cannot hold a slab of one block is rejected
+void do_ooc_workspace_test()
+{
+    // header
+    std::cout << "Testing out of core SGETRF with too small a workspace... ";
+
+    int n = 1024;
+    std::vector<float> a(n*n);
+    std::vector<int> ipiv(n);
+
+    int info = 0;
+    amplapack_status status = amplapack_sgetrf_ooc(n, n, a.data(), n, ipiv.data(), n*sizeof(float), &info);
+
+    if (status == amplapack_argument_error && info == -7)
+        std::cout << "Success!" << std::endl;
+    else
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+}
+
+void ooc_test()
+{
+    // half of a leaves room for slabs of a few blocks
+    do_getrf_ooc_test<float>(2048, 2048, 0.5);
+    do_getrf_ooc_test<float>(2048, 1500, 0.5);
+    do_getrf_ooc_test<dcomplex>(1200, 1200, 0.5);
+
+    do_potrf_ooc_test<float>('L', 2048, 0.5);
+    do_potrf_ooc_test<float>('U', 2048, 0.5);
+    do_potrf_ooc_test<dcomplex>('U', 1200, 0.5);
+
+    // the stored block reflectors need more room
+    do_geqrf_ooc_test<float>(2048, 2048, 0.5);
+    do_geqrf_ooc_test<float>(2048, 1536, 0.75);
+
+    do_ooc_workspace_test();
+}
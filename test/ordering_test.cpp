@@ -0,0 +1,179 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "amplapack_test.h"
+
+// the array view interface
+#include "amplapack.h"
+
+using amplapack::ordering;
+using amplapack::block_factor_location;
+
+// row major copy of a column major m by n matrix
+template <typename value_type>
+std::vector<value_type> to_row_major(int m, int n, const std::vector<value_type>& a)
+{
+    std::vector<value_type> a_row(m*n);
+
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            a_row[i*n+j] = a[j*m+i];
+
+    return a_row;
+}
+
+// largest elementwise difference between a column major and a row major m by n matrix
+template <typename value_type>
+double layout_difference(int m, int n, const std::vector<value_type>& a_col, const std::vector<value_type>& a_row)
+{
+    double error = 0;
+
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            error = std::max(error, double(abs(a_col[j*m+i] - a_row[i*n+j])));
+
+    return error;
+}
+
+inline const char* location_name(block_factor_location location)
+{
+    return (location == block_factor_location::host ? "HOST" : "ACCELERATOR");
+}
+
+template <typename value_type, block_factor_location location>
+void do_getrf_ordering_test(int m, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GETRF row major (" << location_name(location) << ") for M=" << m << " N=" << n << "... ";
+
+    // create data
+    int k = std::min(m,n);
+    std::vector<value_type> a_col(m*n);
+    std::vector<int> ipiv_col(k), ipiv_row(k);
+
+    std::for_each(a_col.begin(), a_col.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> a_row = to_row_major(m, n, a_col);
+
+    // factor both layouts
+    amplapack::context ctx(concurrency::accelerator().default_view);
+    {
+        concurrency::array_view<value_type,2> view_col(n, m, a_col);
+        concurrency::array_view<int,1> view_ipiv(k, ipiv_col);
+        amplapack::getrf<ordering::column_major, location>(ctx, view_col, view_ipiv);
+        view_col.synchronize();
+    }
+    {
+        concurrency::array_view<value_type,2> view_row(m, n, a_row);
+        concurrency::array_view<int,1> view_ipiv(k, ipiv_row);
+        amplapack::getrf<ordering::row_major, location>(ctx, view_row, view_ipiv);
+        view_row.synchronize();
+    }
+
+    bool match = std::equal(ipiv_col.begin(), ipiv_col.end(), ipiv_row.begin());
+    std::cout << (match ? "Success!" : "Pivot Mismatch!") << " Difference = " << layout_difference(m, n, a_col, a_row) << std::endl;
+}
+
+template <typename value_type, block_factor_location location>
+void do_potrf_ordering_test(char uplo, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "POTRF row major (" << location_name(location) << ") for UPLO=" << uplo << " N=" << n << "... ";
+
+    // create data (hermitian with a dominant diagonal)
+    std::vector<value_type> a_col(n*n);
+
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < j; i++)
+        {
+            value_type val = random_value(value_type(0), value_type(1));
+            a_col[j*n+i] = val;
+            a_col[i*n+j] = val;
+        }
+
+        a_col[j*n+j] = value_type(typename ampblas::real_type<value_type>::type(n));
+    }
+
+    std::vector<value_type> a_row = to_row_major(n, n, a_col);
+
+    // factor both layouts
+    amplapack::context ctx(concurrency::accelerator().default_view);
+    {
+        concurrency::array_view<value_type,2> view_col(n, n, a_col);
+        amplapack::potrf<ordering::column_major, location>(ctx, amplapack::to_option(uplo), view_col);
+        view_col.synchronize();
+    }
+    {
+        concurrency::array_view<value_type,2> view_row(n, n, a_row);
+        amplapack::potrf<ordering::row_major, location>(ctx, amplapack::to_option(uplo), view_row);
+        view_row.synchronize();
+    }
+
+    // only the referenced triangle is compared
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if ((uplo == 'L' && i < j) || (uplo == 'U' && i > j))
+            {
+                a_col[j*n+i] = value_type();
+                a_row[i*n+j] = value_type();
+            }
+        }
+    }
+
+    std::cout << "Success! Difference = " << layout_difference(n, n, a_col, a_row) << std::endl;
+}
+
+template <typename value_type, block_factor_location location>
+void do_geqrf_ordering_test(int m, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GEQRF row major (" << location_name(location) << ") for M=" << m << " N=" << n << "... ";
+
+    // create data
+    int k = std::min(m,n);
+    std::vector<value_type> a_col(m*n);
+    std::vector<value_type> tau_col(k), tau_row(k);
+
+    std::for_each(a_col.begin(), a_col.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> a_row = to_row_major(m, n, a_col);
+
+    // factor both layouts
+    amplapack::context ctx(concurrency::accelerator().default_view);
+    {
+        concurrency::array_view<value_type,2> view_col(n, m, a_col);
+        concurrency::array_view<value_type,1> view_tau(k, tau_col);
+        amplapack::geqrf<ordering::column_major, location>(ctx, view_col, view_tau);
+        view_col.synchronize();
+    }
+    {
+        concurrency::array_view<value_type,2> view_row(m, n, a_row);
+        concurrency::array_view<value_type,1> view_tau(k, tau_row);
+        amplapack::geqrf<ordering::row_major, location>(ctx, view_row, view_tau);
+        view_row.synchronize();
+    }
+
+    std::cout << "Success! Difference = " << layout_difference(m, n, a_col, a_row) << " Tau Difference = " << layout_difference(k, 1, tau_col, tau_row) << std::endl;
+}
+
+void ordering_test()
+{
+    // sizes span several panels with a partial last one
+    do_getrf_ordering_test<float, block_factor_location::host>(600, 520);
+    do_getrf_ordering_test<float, block_factor_location::accelerator>(600, 520);
+
+    do_potrf_ordering_test<float, block_factor_location::host>('L', 600);
+    do_potrf_ordering_test<float, block_factor_location::host>('U', 600);
+    do_potrf_ordering_test<float, block_factor_location::accelerator>('L', 600);
+
+    do_geqrf_ordering_test<float, block_factor_location::host>(600, 520);
+    do_geqrf_ordering_test<float, block_factor_location::accelerator>(600, 520);
+}
@@ -0,0 +1,134 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <climits>
+
+#include "amplapack_test.h"
+#include "ampxlapack.h"
+
+// random m by n matrix
+template <typename value_type>
+std::vector<value_type> random_matrix(int m, int n)
+{
+    std::vector<value_type> a(m*n);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    return a;
+}
+
+template <typename value_type>
+void do_orgqr_test(int m, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "ORGQR for M=" << m << " N=" << n << "... ";
+
+    // create data
+    std::vector<value_type> a_in = random_matrix<value_type>(m, n);
+    std::vector<value_type> a(a_in), tau(n);
+
+    int info;
+    amplapack_status status = amplapack_geqrf(m, n, cast(a.data()), m, cast(tau.data()), &info);
+
+    // r (upper triangle) and q
+    std::vector<value_type> r(n*n, value_type());
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i <= j; i++)
+            r[j*n+i] = a[j*m+i];
+
+    if (status == amplapack_success)
+        status = amplapack_orgqr(m, n, n, cast(a.data()), m, cast(tau.data()), &info);
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed with status " << status << " info " << info << std::endl;
+        return;
+    }
+
+    // a = a - q*r
+    gemm('n', 'n', m, n, n, value_type(-1), a.data(), m, r.data(), n, value_type(1), a_in.data(), m);
+
+    // i = i - q'*q
+    std::vector<value_type> eye(n*n, value_type());
+    for (int i = 0; i < n; i++)
+        eye[i*n+i] = value_type(1);
+
+    gemm('c', 'n', n, n, m, value_type(-1), a.data(), m, a.data(), m, value_type(1), eye.data(), n);
+
+    std::cout << "Success! Error = " << one_norm(m, n, a_in.data(), m) << " Orthogonality = " << one_norm(n, n, eye.data(), n) << std::endl;
+}
+
+template <typename value_type>
+void do_ormqr_test(char side, char trans, int m, int k, int nc)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "ORMQR for SIDE=" << side << " TRANS=" << trans << " M=" << m << " K=" << k << " NC=" << nc << "... ";
+
+    // k reflectors of length m
+    std::vector<value_type> a = random_matrix<value_type>(m, k);
+    std::vector<value_type> tau(k);
+
+    int info;
+    amplapack_status status = amplapack_geqrf(m, k, cast(a.data()), m, cast(tau.data()), &info);
+
+    // the full m by m q as reference
+    std::vector<value_type> q(m*m, value_type());
+    std::copy(a.begin(), a.end(), q.begin());
+
+    if (status == amplapack_success)
+        status = amplapack_orgqr(m, m, k, cast(q.data()), m, cast(tau.data()), &info);
+
+    // c is m by nc from the left and nc by m from the right
+    const bool left = (side == 'L');
+    const int rows = (left ? m : nc);
+    const int cols = (left ? nc : m);
+
+    std::vector<value_type> c_in = random_matrix<value_type>(rows, cols);
+    std::vector<value_type> c(c_in);
+
+    if (status == amplapack_success)
+        status = amplapack_ormqr(side, trans, rows, cols, k, cast(a.data()), m, cast(tau.data()), cast(c.data()), rows, &info);
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed with status " << status << " info " << info << std::endl;
+        return;
+    }
+
+    // c = c - op(q)*c_in or c - c_in*op(q)
+    const char trans_q = (trans == 'N' ? 'n' : 'c');
+
+    if (left)
+        gemm(trans_q, 'n', rows, cols, m, value_type(-1), q.data(), m, c_in.data(), rows, value_type(1), c.data(), rows);
+    else
+        gemm('n', trans_q, rows, cols, m, value_type(-1), c_in.data(), rows, q.data(), m, value_type(1), c.data(), rows);
+
+    std::cout << "Success! Error = " << one_norm(rows, cols, c.data(), rows) << std::endl;
+}
+
+void ormqr_test()
+{
+    // run on the accelerator whatever the configured crossovers
+    int host_crossover[2], accelerator_crossover[2];
+    amplapack_get_crossover(amplapack_geqrf_routine, 'S', &host_crossover[0], &accelerator_crossover[0]);
+    amplapack_get_crossover(amplapack_geqrf_routine, 'C', &host_crossover[1], &accelerator_crossover[1]);
+    amplapack_set_crossover(amplapack_geqrf_routine, 'S', 0, INT_MAX);
+    amplapack_set_crossover(amplapack_geqrf_routine, 'C', 0, INT_MAX);
+
+    // several blocks, the last one partial
+    do_orgqr_test<float>(1000, 600);
+    do_orgqr_test<fcomplex>(1000, 300);
+
+    // the blocks run forwards for Q' * c and c * Q and backwards otherwise
+    do_ormqr_test<float>('L', 'N', 700, 300, 50);
+    do_ormqr_test<float>('L', 'T', 700, 300, 50);
+    do_ormqr_test<float>('R', 'N', 700, 300, 50);
+    do_ormqr_test<float>('R', 'T', 700, 300, 50);
+    do_ormqr_test<fcomplex>('L', 'C', 700, 300, 50);
+    do_ormqr_test<fcomplex>('R', 'C', 700, 300, 50);
+
+    amplapack_set_crossover(amplapack_geqrf_routine, 'S', host_crossover[0], accelerator_crossover[0]);
+    amplapack_set_crossover(amplapack_geqrf_routine, 'C', host_crossover[1], accelerator_crossover[1]);
+}
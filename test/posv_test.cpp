@@ -0,0 +1,166 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <climits>
+#include <limits>
+
+#include "amplapack_test.h"
+#include "ampxlapack.h"
+
+// random n by n hermitian matrix with a dominant diagonal and an n by nrhs right hand side
+template <typename value_type>
+void make_hermitian_system(int n, int nrhs, std::vector<value_type>& a, std::vector<value_type>& b)
+{
+    a.resize(n*n);
+    b.resize(size_t(n)*nrhs);
+
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = j+1; i < n; i++)
+        {
+            value_type val = random_value(value_type(-1), value_type(1));
+            a[j*n+i] = val;
+            a[i*n+j] = conjugate(val);
+        }
+
+        a[j*n+j] = value_type(n);
+    }
+
+    std::for_each(b.begin(), b.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+}
+
+template <typename value_type>
+void do_posv_test(char uplo, int n, int nrhs)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "POSV for UPLO=" << uplo << " N=" << n << " NRHS=" << nrhs << "... ";
+
+    // create data
+    std::vector<value_type> a, b;
+    make_hermitian_system(n, nrhs, a, b);
+
+    std::vector<value_type> a_in(a), b_in(b);
+
+    int info = -1;
+    amplapack_status status = amplapack_posv(uplo, n, nrhs, cast(a.data()), n, cast(b.data()), n, &info);
+
+    report_solve(status, info, backward_error(n, nrhs, a_in, b_in, b));
+}
+
+// a matrix whose leading bad+1 by bad+1 block is not positive definite must report info = bad+1 
+// and, as LAPACK, still return the factor of its leading bad by bad block, with b left as it 
+// was; the crossovers are lifted so the matrix is factored on the accelerator
+template <typename value_type>
+void do_posv_indefinite_test(char uplo, int n, int nrhs, int bad)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "POSV not positive definite for UPLO=" << uplo << " N=" << n << " NRHS=" << nrhs << " COLUMN=" << bad << "... ";
+
+    // create data
+    std::vector<value_type> a, b;
+    make_hermitian_system(n, nrhs, a, b);
+
+    a[bad*n+bad] = value_type(-n);
+
+    std::vector<value_type> a_in(a), b_in(b);
+
+    const char precision = type_prefix<value_type>();
+    int host_crossover, accelerator_crossover;
+    amplapack_get_crossover(amplapack_potrf_routine, precision, &host_crossover, &accelerator_crossover);
+    amplapack_set_crossover(amplapack_potrf_routine, precision, 0, INT_MAX);
+
+    int info = -1;
+    amplapack_status status = amplapack_posv(uplo, n, nrhs, cast(a.data()), n, cast(b.data()), n, &info);
+
+    amplapack_set_crossover(amplapack_potrf_routine, precision, host_crossover, accelerator_crossover);
+
+    if (status != amplapack_data_error || info != bad+1)
+    {
+        std::cout << "Failed with status " << status << " info " << info << std::endl;
+        return;
+    }
+
+    // the factor of the leading block (the other triangle cleared)
+    std::vector<value_type> f(bad*bad, value_type());
+
+    for (int j = 0; j < bad; j++)
+        for (int i = 0; i < bad; i++)
+            if ((uplo == 'L' && i >= j) || (uplo == 'U' && i <= j))
+                f[j*bad+i] = a[j*n+i];
+
+    const double a_norm = one_norm(bad, bad, a_in.data(), n);
+
+    // a11 = a11 - l*l' (u'*u)
+    if (uplo == 'L')
+        gemm('n', 'c', bad, bad, bad, value_type(1), f.data(), bad, f.data(), bad, value_type(-1), a_in.data(), n);
+    else
+        gemm('c', 'n', bad, bad, bad, value_type(1), f.data(), bad, f.data(), bad, value_type(-1), a_in.data(), n);
+
+    const double error = one_norm(bad, bad, a_in.data(), n) / (a_norm * bad * std::numeric_limits<real_type>::epsilon());
+
+    if (error > 100)
+        std::cout << "Failed! Factor Error = " << error << std::endl;
+    else if (max_difference(n, nrhs, b, b_in, n) != 0)
+        std::cout << "Failed! B was modified" << std::endl;
+    else
+        std::cout << "Success! Factor Error = " << error << std::endl;
+}
+
+template <typename value_type>
+void do_potrs_test(char uplo, int n, int nrhs)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "POTRS for UPLO=" << uplo << " N=" << n << " NRHS=" << nrhs << "... ";
+
+    // create data
+    std::vector<value_type> a, b;
+    make_hermitian_system(n, nrhs, a, b);
+
+    std::vector<value_type> a_in(a), b_in(b);
+
+    int info = -1;
+    amplapack_status status = amplapack_potrf(uplo, n, cast(a.data()), n, &info);
+
+    if (status == amplapack_success)
+        status = amplapack_potrs(uplo, n, nrhs, cast(a.data()), n, cast(b.data()), n, &info);
+
+    report_solve(status, info, backward_error(n, nrhs, a_in, b_in, b));
+}
+
+// a right hand side larger than one streaming chunk; the crossovers are lifted so the 
+// small system still goes through the accelerator
+template <typename value_type>
+void do_potrs_stream_test(int n, int nrhs)
+{
+    const char precision = type_prefix<value_type>();
+    int host_crossover, accelerator_crossover;
+    amplapack_get_crossover(amplapack_potrf_routine, precision, &host_crossover, &accelerator_crossover);
+    amplapack_set_crossover(amplapack_potrf_routine, precision, 0, INT_MAX);
+
+    do_potrs_test<value_type>('L', n, nrhs);
+
+    amplapack_set_crossover(amplapack_potrf_routine, precision, host_crossover, accelerator_crossover);
+}
+
+void posv_test()
+{
+    do_posv_test<float>('L', 1024, 1);
+    do_posv_test<float>('U', 1000, 33);
+    do_posv_test<fcomplex>('L', 1000, 8);
+
+    // matrices that are not positive definite still return the factor of the leading block
+    do_posv_indefinite_test<float>('L', 1000, 4, 600);
+    do_posv_indefinite_test<float>('U', 1000, 4, 300);
+    do_posv_indefinite_test<fcomplex>('L', 1000, 4, 100);
+
+    do_potrs_test<float>('L', 1000, 8);
+    do_potrs_test<float>('U', 1000, 8);
+    do_potrs_test<fcomplex>('U', 1000, 8);
+
+    // several chunks, the last one partial
+    do_potrs_stream_test<float>(32, 600000);
+}
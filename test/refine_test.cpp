@@ -0,0 +1,115 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "amplapack_test.h"
+#include "ampxlapack.h"
+
+// reports a mixed precision solve, which must take the expected path (fall_back is 0 when the
+// refinement must converge, otherwise the negative iteration count it must report) and give a
+// backward stable solution. The refinement stops once the backward error is below 1/sqrt(n), so
+// rounding in the residual computed by the test is covered too.
+inline void report(amplapack_status status, int iter, int info, int fall_back, double error)
+{
+    if (status != amplapack_success)
+        std::cout << "Failed with status " << status << " info " << info << std::endl;
+    else if (fall_back == 0 ? iter < 0 : iter != fall_back)
+        std::cout << "Failed! Iterations = " << iter << std::endl;
+    else if (error > 1)
+        std::cout << "Failed! Iterations = " << iter << " Backward Error = " << error << std::endl;
+    else
+        std::cout << "Success! Iterations = " << iter << " Backward Error = " << error << std::endl;
+}
+
+// scale multiplies the matrix; a large scale overflows single precision and forces the double
+// precision fall back, reported as fall_back
+template <typename value_type>
+void do_gesv_mixed_test(int n, int nrhs, double scale = 1, int fall_back = 0)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GESV (mixed) for N=" << n << " NRHS=" << nrhs << " SCALE=" << scale << "... ";
+
+    // create data
+    std::vector<value_type> a(n*n), b(n*nrhs), x(n*nrhs);
+    std::vector<int> ipiv(n);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    for (int i = 0; i < (n*n); i += (n+1))
+        a[i] = random_value(value_type(1), value_type(2));
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val *= value_type(scale);
+    });
+
+    std::for_each(b.begin(), b.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> a_in(a);
+
+    int iter = 0;
+    int info = 0;
+    std::vector<value_type> b_in(b);
+    amplapack_status status = amplapack_gesv_mixed(n, nrhs, cast(a.data()), n, ipiv.data(), cast(b.data()), n, cast(x.data()), n, &iter, &info);
+
+    report(status, iter, info, fall_back, backward_error(n, nrhs, a_in, b_in, x));
+}
+
+template <typename value_type>
+void do_posv_mixed_test(char uplo, int n, int nrhs)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "POSV (mixed) for UPLO=" << uplo << " N=" << n << " NRHS=" << nrhs << "... ";
+
+    // create data (hermitian with a dominant diagonal)
+    std::vector<value_type> a(n*n), b(n*nrhs), x(n*nrhs);
+
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < j; i++)
+        {
+            value_type val = random_value(value_type(0), value_type(1));
+            a[j*n+i] = val;
+            a[i*n+j] = conjugate(val);
+        }
+
+        a[j*n+j] = value_type(n);
+    }
+
+    std::for_each(b.begin(), b.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> a_in(a);
+
+    // the other triangle must not be referenced
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < n; i++)
+            if ((uplo == 'L' && i < j) || (uplo == 'U' && i > j))
+                a[j*n+i] = value_type(-1);
+
+    int iter = 0;
+    int info = 0;
+    std::vector<value_type> b_in(b);
+    amplapack_status status = amplapack_posv_mixed(uplo, n, nrhs, cast(a.data()), n, cast(b.data()), n, cast(x.data()), n, &iter, &info);
+
+    report(status, iter, info, 0, backward_error(n, nrhs, a_in, b_in, x));
+}
+
+void refine_test()
+{
+    // refined single precision factorization
+    do_gesv_mixed_test<double>(1024, 1);
+    do_gesv_mixed_test<double>(1000, 16);
+    do_gesv_mixed_test<dcomplex>(1000, 4);
+
+    do_posv_mixed_test<double>('L', 1000, 4);
+    do_posv_mixed_test<double>('U', 1000, 4);
+    do_posv_mixed_test<dcomplex>('L', 1000, 4);
+
+    // out of single precision range (falls back to double precision, iter = -2)
+    do_gesv_mixed_test<double>(512, 2, 1e40, -2);
+}
@@ -0,0 +1,193 @@
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "amplapack_test.h"
+#include "ampxlapack.h"
+
+// the stream routines, selected by the value type
+inline amplapack_status potrf_stream(float, char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info) { return amplapack_spotrf_stream(uplo, n, a, workspace, info); }
+inline amplapack_status potrf_stream(dcomplex, char uplo, int n, const amplapack_tile_stream* a, size_t workspace, int* info) { return amplapack_zpotrf_stream(uplo, n, a, workspace, info); }
+inline amplapack_status potrf_file(float, char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info) { return amplapack_spotrf_file(uplo, n, file_name, offset, lda, workspace, progress, user_data, info); }
+inline amplapack_status potrf_file(dcomplex, char uplo, int n, const char* file_name, long long offset, int lda, size_t workspace, amplapack_progress progress, void* user_data, int* info) { return amplapack_zpotrf_file(uplo, n, file_name, offset, lda, workspace, progress, user_data, info); }
+
+// a matrix in memory behind the stream callbacks, counting the reads and the progress calls
+template <typename value_type>
+struct memory_stream
+{
+    std::vector<value_type>* a;
+    int lda;
+    int reads;
+    int last_done;
+
+    static int read(void* user_data, int i, int j, int m, int n, void* buffer, int ld)
+    {
+        memory_stream& self = *static_cast<memory_stream*>(user_data);
+        self.reads++;
+
+        for (int c = 0; c < n; c++)
+            std::memcpy(static_cast<value_type*>(buffer) + c*ld, self.a->data() + (j+c)*self.lda + i, m*sizeof(value_type));
+
+        return 0;
+    }
+
+    static int write(void* user_data, int i, int j, int m, int n, const void* buffer, int ld)
+    {
+        memory_stream& self = *static_cast<memory_stream*>(user_data);
+
+        for (int c = 0; c < n; c++)
+            std::memcpy(self.a->data() + (j+c)*self.lda + i, static_cast<const value_type*>(buffer) + c*ld, m*sizeof(value_type));
+
+        return 0;
+    }
+
+    static void progress(void* user_data, int done, int /*total*/)
+    {
+        static_cast<memory_stream*>(user_data)->last_done = done;
+    }
+};
+
+// a diagonally dominant n by n matrix
+template <typename value_type>
+std::vector<value_type> make_spd(int n)
+{
+    std::vector<value_type> a(n*n);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(0), value_type(1));
+    });
+
+    for (int i = 0; i < (n*n); i += (n+1))
+        a[i] = value_type(ampblas::real_type<value_type>::type(n));
+
+    return a;
+}
+
+// the streamed factor must match the in core factor
+template <typename value_type>
+void do_potrf_stream_test(char uplo, int n)
+{
+    // header
+    std::cout << "Testing streamed " << type_prefix<value_type>() << "POTRF for UPLO=" << uplo << " N=" << n << "... ";
+
+    std::vector<value_type> a = make_spd<value_type>(n);
+    std::vector<value_type> a_in_core(a);
+
+    memory_stream<value_type> state = { &a, n, 0, 0 };
+    amplapack_tile_stream stream = { memory_stream<value_type>::read, memory_stream<value_type>::write, memory_stream<value_type>::progress, &state };
+
+    int info;
+    amplapack_status status = amplapack_potrf(uplo, n, cast(a_in_core.data()), n, &info);
+
+    // half of a
+    if (status == amplapack_success)
+        status = potrf_stream(value_type(), uplo, n, &stream, n*n/2*sizeof(value_type), &info);
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+        return;
+    }
+
+    // every column of the factor was reported
+    if (state.last_done != n)
+    {
+        std::cout << "Failed (progress " << state.last_done << " of " << n << ")" << std::endl;
+        return;
+    }
+
+    std::cout << "Success! Reads = " << state.reads << " Difference = " << max_difference(n, n, a, a_in_core, n) << std::endl;
+}
+
+void count_progress(void* user_data, int /*done*/, int /*total*/)
+{
+    ++*static_cast<int*>(user_data);
+}
+
+// the matrix is written behind a header that the offset skips
+template <typename value_type>
+void do_potrf_file_test(char uplo, int n, int lda)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "POTRF on a mapped file for UPLO=" << uplo << " N=" << n << " LDA=" << lda << "... ";
+
+    const char* file_name = "potrf_file_test.bin";
+    const long long offset = 100;
+
+    std::vector<value_type> a(lda*n);
+    std::vector<value_type> spd = make_spd<value_type>(n);
+
+    for (int j = 0; j < n; j++)
+        std::copy(spd.begin() + j*n, spd.begin() + (j+1)*n, a.begin() + j*lda);
+
+    std::vector<value_type> a_in_core(a);
+
+    {
+        std::ofstream file(file_name, std::ios::binary);
+        std::vector<char> header(static_cast<size_t>(offset));
+        file.write(header.data(), header.size());
+        file.write(reinterpret_cast<const char*>(a.data()), a.size()*sizeof(value_type));
+    }
+
+    int info;
+    int progress_calls = 0;
+    amplapack_status status = amplapack_potrf(uplo, n, cast(a_in_core.data()), lda, &info);
+
+    if (status == amplapack_success)
+        status = potrf_file(value_type(), uplo, n, file_name, offset, lda, n*n/2*sizeof(value_type), count_progress, &progress_calls, &info);
+
+    if (status == amplapack_success)
+    {
+        std::ifstream file(file_name, std::ios::binary);
+        file.seekg(offset);
+        file.read(reinterpret_cast<char*>(a.data()), a.size()*sizeof(value_type));
+    }
+
+    std::remove(file_name);
+
+    if (status != amplapack_success)
+    {
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+        return;
+    }
+
+    std::cout << "Success! Slabs = " << progress_calls << " Difference = " << max_difference(n, n, a, a_in_core, lda) << std::endl;
+}
+
+// a failed read stops the factorization
+void do_potrf_stream_error_test()
+{
+    // header
+    std::cout << "Testing streamed SPOTRF with a failing read... ";
+
+    struct failing
+    {
+        static int read(void*, int, int, int, int, void*, int) { return 1; }
+        static int write(void*, int, int, int, int, const void*, int) { return 0; }
+    };
+
+    amplapack_tile_stream stream = { failing::read, failing::write, nullptr, nullptr };
+
+    int info = 0;
+    amplapack_status status = amplapack_spotrf_stream('L', 1024, &stream, 1024*1024*sizeof(float), &info);
+
+    if (status == amplapack_runtime_error)
+        std::cout << "Success!" << std::endl;
+    else
+        std::cout << "Failed (status " << status << ", info " << info << ")" << std::endl;
+}
+
+void stream_test()
+{
+    do_potrf_stream_test<float>('L', 2048);
+    do_potrf_stream_test<float>('U', 2048);
+    do_potrf_stream_test<dcomplex>('L', 1200);
+
+    do_potrf_file_test<float>('L', 2048, 2050);
+    do_potrf_file_test<dcomplex>('U', 1200, 1200);
+
+    do_potrf_stream_error_test();
+}
@@ -0,0 +1,172 @@
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <functional>
+#include <limits>
+
+#include "amplapack_test.h"
+
+// the tile major layout and factorizations
+#include "amplapack.h"
+
+using amplapack::context;
+using amplapack::ordering;
+using amplapack::tile_matrix;
+
+// every conversion must give back the matrix it started from; the tiles must hold element
+// (i,j) where get_index says
+template <typename value_type>
+void do_tile_conversion_test(ordering storage_type, int m, int n, int tile_size)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << " tile conversion from " << (storage_type == ordering::column_major ? "column" : "row") << " major for M=" << m << " N=" << n << " TILE=" << tile_size << "... ";
+
+    // padded for the copy, unpadded for the in place conversion
+    const int rows = (storage_type == ordering::column_major ? m : n);
+    const int cols = (storage_type == ordering::column_major ? n : m);
+    const int lda = rows + 3;
+
+    std::vector<value_type> a(lda*cols);
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(-1), value_type(1));
+    });
+
+    std::vector<value_type> tiles(m*n);
+    tile_matrix<value_type> a_tiles(m, n, tile_size, tiles.data());
+    amplapack::to_tile_major(storage_type, a.data(), lda, a_tiles);
+
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < m; i++)
+        {
+            const value_type expected = (storage_type == ordering::column_major ? a[j*lda+i] : a[i*lda+j]);
+
+            if (abs(tiles[a_tiles.get_index(i,j)] - expected) != 0)
+            {
+                std::cout << "Failed (element " << i << "," << j << ")" << std::endl;
+                return;
+            }
+        }
+    }
+
+    std::vector<value_type> b(a.size());
+    amplapack::from_tile_major(a_tiles, storage_type, b.data(), lda);
+
+    // unpadded copy of a converted in place both ways
+    std::vector<value_type> c(rows*cols);
+    for (int j = 0; j < cols; j++)
+        std::copy(a.begin() + j*lda, a.begin() + j*lda + rows, c.begin() + j*rows);
+
+    tile_matrix<value_type> c_tiles = amplapack::to_tile_major_in_place(storage_type, m, n, c.data(), tile_size);
+
+    if (std::memcmp(c.data(), tiles.data(), c.size()*sizeof(value_type)) != 0)
+    {
+        std::cout << "Failed (in place tiles)" << std::endl;
+        return;
+    }
+
+    amplapack::from_tile_major_in_place(c_tiles, storage_type);
+
+    double error = max_difference(rows, cols, a, b, lda);
+    for (int j = 0; j < cols; j++)
+        for (int i = 0; i < rows; i++)
+            error = std::max(error, double(abs(a[j*lda+i] - c[j*rows+i])));
+
+    if (error != 0)
+        std::cout << "Failed (round trip)" << std::endl;
+    else
+        std::cout << "Success!" << std::endl;
+}
+
+// the tile major factorizations must match the column major ones (within rounding, since
+// the updates are applied in a different order)
+template <typename value_type>
+void do_tile_factor_test(char routine, int m, int n, int tile_size)
+{
+    typedef typename ampblas::real_type<value_type>::type real_type;
+
+    // header
+    std::cout << "Testing tile major " << type_prefix<value_type>() << (routine == 'G' ? "GETRF" : routine == 'P' ? "POTRF" : "GEQRF") << " for M=" << m << " N=" << n << " TILE=" << tile_size << "... ";
+
+    std::vector<value_type> a(m*n);
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(0), value_type(1));
+    });
+
+    // diagonally dominant
+    for (int i = 0; i < std::min(m,n); i++)
+        a[i*m+i] = value_type(real_type(n));
+
+    std::vector<value_type> tiles(m*n);
+    tile_matrix<value_type> a_tiles(m, n, tile_size, tiles.data());
+    amplapack::to_tile_major(ordering::column_major, a.data(), m, a_tiles);
+
+    std::vector<int> ipiv(std::min(m,n));
+    std::vector<int> ipiv_tiles(ipiv);
+    std::vector<value_type> tau(std::min(m,n));
+    std::vector<value_type> tau_tiles(tau);
+
+    context ctx(concurrency::accelerator().default_view);
+
+    try
+    {
+        switch (routine)
+        {
+        case 'G':
+            amplapack::getrf(ctx, m, n, a.data(), m, ipiv.data());
+            amplapack::getrf(ctx, a_tiles, ipiv_tiles.data());
+            break;
+        case 'P':
+            amplapack::potrf(ctx, 'L', n, a.data(), m);
+            amplapack::potrf(ctx, 'L', a_tiles);
+            break;
+        default:
+            amplapack::geqrf(ctx, m, n, a.data(), m, tau.data());
+            amplapack::geqrf(ctx, a_tiles, tau_tiles.data());
+            break;
+        }
+    }
+    catch(const amplapack::argument_error_exception& e)
+    {
+        std::cout << "Failed (argument " << e.get() << ")" << std::endl;
+        return;
+    }
+    catch(const amplapack::data_error_exception& e)
+    {
+        std::cout << "Failed (data error " << e.get() << ")" << std::endl;
+        return;
+    }
+
+    if (ipiv != ipiv_tiles)
+    {
+        std::cout << "Failed (pivots)" << std::endl;
+        return;
+    }
+
+    std::vector<value_type> b(m*n);
+    amplapack::from_tile_major(a_tiles, ordering::column_major, b.data(), m);
+
+    // the entries are of order n
+    const double error = std::max(max_difference(m, n, a, b, m), max_difference(std::min(m,n), 1, tau, tau_tiles, 1));
+    const double tolerance = 100.0 * n * n * std::numeric_limits<real_type>::epsilon();
+
+    if (error > tolerance)
+        std::cout << "Failed! Difference = " << error << std::endl;
+    else
+        std::cout << "Success! Difference = " << error << std::endl;
+}
+
+void tile_test()
+{
+    do_tile_conversion_test<float>(ordering::column_major, 300, 200, 64);
+    do_tile_conversion_test<float>(ordering::row_major, 300, 200, 64);
+    do_tile_conversion_test<dcomplex>(ordering::column_major, 129, 257, 32);
+    do_tile_conversion_test<dcomplex>(ordering::row_major, 129, 257, 32);
+
+    do_tile_factor_test<float>('G', 1000, 800, 256);
+    do_tile_factor_test<float>('G', 600, 1000, 128);
+    do_tile_factor_test<float>('P', 1000, 1000, 256);
+    do_tile_factor_test<dcomplex>('Q', 700, 500, 128);
+    do_tile_factor_test<float>('Q', 500, 700, 128);
+}
@@ -0,0 +1,90 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "amplapack_test.h"
+
+// the tiled interface
+#include "amplapack.h"
+
+using amplapack::context;
+
+// the task scheduled factor must match the bulk synchronous one
+template <typename value_type>
+void do_potrf_tiled_test(context& ctx, char uplo, int n, int host_workers)
+{
+    // header
+    std::cout << "Testing tiled " << type_prefix<value_type>() << "POTRF for UPLO=" << uplo << " N=" << n << " on " << host_workers << " host workers... ";
+
+    // create data
+    int lda = n + 1;
+    std::vector<value_type> a(lda*n);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(0), value_type(1));
+    });
+
+    // diagonally dominant
+    for (int i = 0; i < (lda*n); i += (lda+1))
+        a[i] = value_type(ampblas::real_type<value_type>::type(n));
+
+    std::vector<value_type> a_bulk(a);
+
+    try
+    {
+        amplapack::potrf(ctx, uplo, n, a_bulk.data(), lda);
+        amplapack::potrf_tiled(ctx, uplo, n, a.data(), lda, host_workers);
+    }
+    catch(const amplapack::argument_error_exception& e)
+    {
+        std::cout << "Failed (argument " << e.get() << ")" << std::endl;
+        return;
+    }
+    catch(const amplapack::data_error_exception& e)
+    {
+        std::cout << "Failed (data error " << e.get() << ")" << std::endl;
+        return;
+    }
+
+    std::cout << "Success! Difference = " << max_difference(n, n, a, a_bulk, lda) << std::endl;
+}
+
+// the data error names the first leading minor that is not positive definite, as LAPACK does
+void do_potrf_tiled_error_test(context& ctx, int n, int failure)
+{
+    // header
+    std::cout << "Testing tiled SPOTRF with a leading minor of order " << failure << " that is not positive definite... ";
+
+    std::vector<float> a(n*n);
+    for (int i = 0; i < n; i++)
+        a[i*n+i] = (i == failure-1 ? -1.0f : 1.0f);
+
+    try
+    {
+        amplapack::potrf_tiled(ctx, 'L', n, a.data(), n, 4);
+    }
+    catch(const amplapack::data_error_exception& e)
+    {
+        if (static_cast<int>(e.get()) == failure)
+            std::cout << "Success!" << std::endl;
+        else
+            std::cout << "Failed (data error " << e.get() << ")" << std::endl;
+
+        return;
+    }
+
+    std::cout << "Failed (no data error)" << std::endl;
+}
+
+void tiled_potrf_test()
+{
+    context ctx(concurrency::accelerator().default_view);
+
+    do_potrf_tiled_test<float>(ctx, 'L', 2000, 0);
+    do_potrf_tiled_test<float>(ctx, 'U', 2000, 0);
+    do_potrf_tiled_test<float>(ctx, 'L', 1500, 1);
+    do_potrf_tiled_test<double>(ctx, 'L', 1500, 3);
+    do_potrf_tiled_test<dcomplex>(ctx, 'U', 1000, 2);
+
+    do_potrf_tiled_error_test(ctx, 1000, 700);
+}
@@ -0,0 +1,127 @@
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "amplapack_test.h"
+
+// the tsqr interface
+#include "amplapack.h"
+
+using amplapack::context;
+
+// R must match that of geqrf up to the signs (phases) of its rows, Q' * a must give R and
+// Q * R must give back a
+template <typename value_type>
+void do_tsqr_test(context& ctx, int m, int n, int host_workers)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "GEQRF_TSQR for M=" << m << " N=" << n << " on " << host_workers << " host workers... ";
+
+    // create data
+    int lda = m + 1;
+    std::vector<value_type> a(lda*n);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(0), value_type(1));
+    });
+
+    std::vector<value_type> a_tsqr(a);
+    std::vector<value_type> a_geqrf(a);
+    std::vector<value_type> c(a);
+    std::vector<value_type> tau(std::min(m,n));
+    amplapack::tsqr_factors<value_type> q;
+
+    try
+    {
+        amplapack::geqrf(ctx, m, n, a_geqrf.data(), lda, tau.data());
+        amplapack::geqrf_tsqr(ctx, m, n, a_tsqr.data(), lda, q, host_workers);
+        amplapack::ormqr_tsqr(ctx, 'C', n, a_tsqr.data(), lda, q, c.data(), lda, host_workers);
+    }
+    catch(const amplapack::argument_error_exception& e)
+    {
+        std::cout << "Failed (argument " << e.get() << ")" << std::endl;
+        return;
+    }
+
+    // R against geqrf and Q' * a against R (with zeros below it)
+    double r_error = 0;
+    double q_error = 0;
+
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < m; i++)
+        {
+            const value_type r = (i <= j ? a_tsqr[j*lda+i] : value_type(0));
+
+            if (i <= j)
+                r_error = std::max(r_error, double(abs(abs(r) - abs(a_geqrf[j*lda+i]))));
+
+            q_error = std::max(q_error, double(abs(c[j*lda+i] - r)));
+            c[j*lda+i] = r;
+        }
+    }
+
+    // Q * [R; 0]
+    amplapack::ormqr_tsqr(ctx, 'N', n, a_tsqr.data(), lda, q, c.data(), lda, host_workers);
+
+    double a_error = 0;
+
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            a_error = std::max(a_error, double(abs(c[j*lda+i] - a[j*lda+i])));
+
+    std::cout << "Success! " << q.get_blocks() << " blocks in " << q.get_levels() << " levels, R difference = " << r_error << ", Q'A difference = " << q_error << ", QR difference = " << a_error << std::endl;
+}
+
+// the explicit Q must have orthonormal columns (real types only)
+template <typename value_type>
+void do_orgqr_tsqr_test(context& ctx, int m, int n)
+{
+    // header
+    std::cout << "Testing " << type_prefix<value_type>() << "ORGQR_TSQR for M=" << m << " N=" << n << "... ";
+
+    std::vector<value_type> a(m*n);
+
+    std::for_each(a.begin(), a.end(), [&](value_type& val) {
+        val = random_value(value_type(0), value_type(1));
+    });
+
+    std::vector<value_type> b(m*n);
+    amplapack::tsqr_factors<value_type> q;
+
+    amplapack::geqrf_tsqr(ctx, m, n, a.data(), m, q);
+    amplapack::orgqr_tsqr(ctx, a.data(), m, q, b.data(), m);
+
+    // Q' * Q against the identity
+    double error = 0;
+
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            value_type dot = value_type(0);
+
+            for (int k = 0; k < m; k++)
+                dot += b[i*m+k] * b[j*m+k];
+
+            error = std::max(error, double(abs(dot - value_type(i == j ? 1 : 0))));
+        }
+    }
+
+    std::cout << "Success! Orthogonality error = " << error << std::endl;
+}
+
+void tsqr_test()
+{
+    context ctx(concurrency::accelerator().default_view);
+
+    // a single block, one level above the leaves and two
+    do_tsqr_test<float>(ctx, 1000, 50, 0);
+    do_tsqr_test<float>(ctx, 100000, 64, 0);
+    do_tsqr_test<float>(ctx, 140000, 200, 0);
+    do_tsqr_test<double>(ctx, 60000, 32, 1);
+    do_tsqr_test<fcomplex>(ctx, 50000, 16, 3);
+    do_tsqr_test<dcomplex>(ctx, 30000, 24, 0);
+
+    do_orgqr_tsqr_test<double>(ctx, 20000, 16);
+}